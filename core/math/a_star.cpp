@@ -51,6 +51,8 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 	ERR_FAIL_COND_MSG(p_id < 0, vformat("Can't add a point with negative id: %d.", p_id));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't add a point with weight scale less than 0.0: %f.", p_weight_scale));
 
+	_unfreeze();
+
 	Point *found_pt;
 	bool p_exists = points.lookup(p_id, found_pt);
 
@@ -83,6 +85,8 @@ void AStar3D::set_point_position(int64_t p_id, const Vector3 &p_pos) {
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set point's position. Point with id: %d doesn't exist.", p_id));
 
+	// The cached connection costs depend on the positions.
+	_unfreeze();
 	p->pos = p_pos;
 }
 
@@ -101,6 +105,9 @@ void AStar3D::set_point_weight_scale(int64_t p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 
 	p->weight_scale = p_weight_scale;
+	if (frozen) {
+		frozen_graph.weight_scales[frozen_graph.id_to_index[p_id]] = p_weight_scale;
+	}
 }
 
 void AStar3D::remove_point(int64_t p_id) {
@@ -108,6 +115,8 @@ void AStar3D::remove_point(int64_t p_id) {
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't remove point. Point with id: %d doesn't exist.", p_id));
 
+	_unfreeze();
+
 	for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 		Segment s(p_id, (*it.key));
 		segments.erase(s);
@@ -140,6 +149,8 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 	bool to_exists = points.lookup(p_with_id, b);
 	ERR_FAIL_COND_MSG(!to_exists, vformat("Can't connect points. Point with id: %d doesn't exist.", p_with_id));
 
+	_unfreeze();
+
 	a->neighbors.set(b->id, b);
 
 	if (bidirectional) {
@@ -181,6 +192,8 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectio
 
 	HashSet<Segment, Segment>::Iterator element = segments.find(s);
 	if (element) {
+		_unfreeze();
+
 		// s is the new segment
 		// Erase the directions to be removed
 		s.direction = (element->direction & ~remove_direction);
@@ -244,6 +257,7 @@ bool AStar3D::are_points_connected(int64_t p_id, int64_t p_with_id, bool bidirec
 }
 
 void AStar3D::clear() {
+	_unfreeze();
 	last_free_id = 0;
 	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
 		memdelete(*(it.value));
@@ -386,6 +400,246 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_
 	return found_route;
 }
 
+void AStar3D::_unfreeze() {
+	if (!frozen) {
+		return;
+	}
+	frozen = false;
+	frozen_graph = FrozenGraph();
+}
+
+template <typename T>
+void AStar3D::_freeze(T *p_owner) {
+	_unfreeze();
+
+	const uint32_t point_count = points.get_num_elements();
+	frozen_graph.id_to_index.reserve(point_count);
+	frozen_graph.ids.resize(point_count);
+	frozen_graph.positions.resize(point_count);
+	frozen_graph.weight_scales.resize(point_count);
+	frozen_graph.enabled.resize(point_count);
+	frozen_graph.neighbor_offsets.resize(point_count + 1);
+
+	uint32_t point_index = 0;
+	uint32_t neighbor_count = 0;
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		const Point *p = *(it.value);
+		frozen_graph.id_to_index.insert(p->id, point_index);
+		frozen_graph.ids[point_index] = p->id;
+		frozen_graph.positions[point_index] = p->pos;
+		frozen_graph.weight_scales[point_index] = p->weight_scale;
+		frozen_graph.enabled[point_index] = p->enabled;
+		frozen_graph.neighbor_offsets[point_index] = neighbor_count;
+		neighbor_count += p->neighbors.get_num_elements();
+		point_index++;
+	}
+	frozen_graph.neighbor_offsets[point_count] = neighbor_count;
+
+	// The connection costs are computed once here, instead of on every search.
+	frozen_graph.neighbor_indices.resize(neighbor_count);
+	frozen_graph.neighbor_costs.resize(neighbor_count);
+	for (point_index = 0; point_index < point_count; point_index++) {
+		Point *p = nullptr;
+		points.lookup(frozen_graph.ids[point_index], p);
+		uint32_t neighbor_slot = frozen_graph.neighbor_offsets[point_index];
+		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
+			frozen_graph.neighbor_indices[neighbor_slot] = frozen_graph.id_to_index[*(it.key)];
+			frozen_graph.neighbor_costs[neighbor_slot] = p_owner->_compute_cost(p->id, *(it.key));
+			neighbor_slot++;
+		}
+	}
+
+	frozen = true;
+}
+
+template <typename T>
+bool AStar3D::_solve_frozen(T *p_owner, FrozenSearch &r_search, uint32_t p_begin_index, uint32_t p_end_index, bool p_allow_partial_path, uint32_t &r_last_index) const {
+	r_last_index = UINT32_MAX;
+
+	if (!frozen_graph.enabled[p_end_index] && !p_allow_partial_path) {
+		return false;
+	}
+
+	const uint32_t point_count = frozen_graph.ids.size();
+	if (r_search.prev_indices.size() != point_count) {
+		r_search.prev_indices.resize(point_count);
+		r_search.g_scores.resize(point_count);
+		r_search.f_scores.resize(point_count);
+		r_search.heap_positions.resize(point_count);
+		r_search.open_passes.resize(point_count);
+		r_search.closed_passes.resize(point_count);
+		memset(r_search.open_passes.ptr(), 0, point_count * sizeof(uint32_t));
+		memset(r_search.closed_passes.ptr(), 0, point_count * sizeof(uint32_t));
+		r_search.pass = 0;
+	}
+	r_search.pass++;
+	if (r_search.pass == 0) {
+		// The pass counter wrapped around, old marks could match again.
+		memset(r_search.open_passes.ptr(), 0, point_count * sizeof(uint32_t));
+		memset(r_search.closed_passes.ptr(), 0, point_count * sizeof(uint32_t));
+		r_search.pass = 1;
+	}
+	const uint32_t pass = r_search.pass;
+
+	real_t *g_scores = r_search.g_scores.ptr();
+	real_t *f_scores = r_search.f_scores.ptr();
+	uint32_t *heap_positions = r_search.heap_positions.ptr();
+	LocalVector<uint32_t> &open_heap = r_search.open_heap;
+	open_heap.clear();
+
+	// Same order as SortPoints, lower f scores first and the points further from the start on ties.
+	auto is_better = [&](uint32_t p_a, uint32_t p_b) -> bool {
+		if (f_scores[p_a] != f_scores[p_b]) {
+			return f_scores[p_a] < f_scores[p_b];
+		}
+		return g_scores[p_a] > g_scores[p_b];
+	};
+	auto sift_up = [&](uint32_t p_heap_position) {
+		const uint32_t point = open_heap[p_heap_position];
+		while (p_heap_position > 0) {
+			const uint32_t parent_position = (p_heap_position - 1) / 2;
+			const uint32_t parent = open_heap[parent_position];
+			if (!is_better(point, parent)) {
+				break;
+			}
+			open_heap[p_heap_position] = parent;
+			heap_positions[parent] = p_heap_position;
+			p_heap_position = parent_position;
+		}
+		open_heap[p_heap_position] = point;
+		heap_positions[point] = p_heap_position;
+	};
+	auto sift_down = [&](uint32_t p_heap_position) {
+		const uint32_t heap_size = open_heap.size();
+		const uint32_t point = open_heap[p_heap_position];
+		while (true) {
+			uint32_t child_position = p_heap_position * 2 + 1;
+			if (child_position >= heap_size) {
+				break;
+			}
+			if (child_position + 1 < heap_size && is_better(open_heap[child_position + 1], open_heap[child_position])) {
+				child_position++;
+			}
+			const uint32_t child = open_heap[child_position];
+			if (!is_better(child, point)) {
+				break;
+			}
+			open_heap[p_heap_position] = child;
+			heap_positions[child] = p_heap_position;
+			p_heap_position = child_position;
+		}
+		open_heap[p_heap_position] = point;
+		heap_positions[point] = p_heap_position;
+	};
+
+	const int64_t end_id = frozen_graph.ids[p_end_index];
+
+	g_scores[p_begin_index] = 0;
+	f_scores[p_begin_index] = p_owner->_estimate_cost(frozen_graph.ids[p_begin_index], end_id);
+	r_search.open_passes[p_begin_index] = pass;
+	open_heap.push_back(p_begin_index);
+	heap_positions[p_begin_index] = 0;
+
+	while (!open_heap.is_empty()) {
+		const uint32_t p = open_heap[0]; // The currently processed point.
+
+		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
+		if (r_last_index == UINT32_MAX) {
+			r_last_index = p;
+		} else {
+			const real_t last_estimate = f_scores[r_last_index] - g_scores[r_last_index];
+			const real_t estimate = f_scores[p] - g_scores[p];
+			if (last_estimate > estimate || (last_estimate >= estimate && g_scores[r_last_index] > g_scores[p])) {
+				r_last_index = p;
+			}
+		}
+
+		if (p == p_end_index) {
+			return true;
+		}
+
+		// Remove the current point from the open list.
+		const uint32_t last = open_heap[open_heap.size() - 1];
+		open_heap.resize(open_heap.size() - 1);
+		if (!open_heap.is_empty()) {
+			open_heap[0] = last;
+			heap_positions[last] = 0;
+			sift_down(0);
+		}
+		r_search.closed_passes[p] = pass; // Mark the point as closed.
+
+		const uint32_t neighbor_end = frozen_graph.neighbor_offsets[p + 1];
+		for (uint32_t neighbor_slot = frozen_graph.neighbor_offsets[p]; neighbor_slot < neighbor_end; neighbor_slot++) {
+			const uint32_t e = frozen_graph.neighbor_indices[neighbor_slot]; // The neighbor point.
+
+			if (!frozen_graph.enabled[e] || r_search.closed_passes[e] == pass) {
+				continue;
+			}
+
+			const real_t tentative_g_score = g_scores[p] + frozen_graph.neighbor_costs[neighbor_slot] * frozen_graph.weight_scales[e];
+
+			bool new_point = false;
+
+			if (r_search.open_passes[e] != pass) { // The point wasn't inside the open list.
+				r_search.open_passes[e] = pass;
+				new_point = true;
+			} else if (tentative_g_score >= g_scores[e]) { // The new path is worse than the previous.
+				continue;
+			}
+
+			r_search.prev_indices[e] = p;
+			g_scores[e] = tentative_g_score;
+			f_scores[e] = tentative_g_score + p_owner->_estimate_cost(frozen_graph.ids[e], end_id);
+
+			if (new_point) {
+				open_heap.push_back(e);
+				heap_positions[e] = open_heap.size() - 1;
+			}
+			// Scores only ever improve, so the point can only move up.
+			sift_up(heap_positions[e]);
+		}
+	}
+
+	return false;
+}
+
+template <typename T>
+bool AStar3D::_get_frozen_path(T *p_owner, int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path, LocalVector<uint32_t> &r_path_indices) const {
+	const uint32_t begin_index = frozen_graph.id_to_index[p_from_id];
+	const uint32_t end_index = frozen_graph.id_to_index[p_to_id];
+
+	FrozenSearch *search = nullptr;
+	{
+		MutexLock search_lock(frozen_search_mutex);
+		if (frozen_search_pool.is_empty()) {
+			search = memnew(FrozenSearch);
+		} else {
+			search = frozen_search_pool[frozen_search_pool.size() - 1];
+			frozen_search_pool.resize(frozen_search_pool.size() - 1);
+		}
+	}
+
+	uint32_t last_index = UINT32_MAX;
+	const bool found_route = _solve_frozen(p_owner, *search, begin_index, end_index, p_allow_partial_path, last_index);
+
+	r_path_indices.clear();
+	if (found_route || (p_allow_partial_path && last_index != UINT32_MAX)) {
+		// Use the closest point instead when there is no route to the end point.
+		for (uint32_t point_index = found_route ? end_index : last_index; point_index != begin_index; point_index = search->prev_indices[point_index]) {
+			r_path_indices.push_back(point_index);
+		}
+		r_path_indices.push_back(begin_index);
+		r_path_indices.reverse();
+	}
+
+	{
+		MutexLock search_lock(frozen_search_mutex);
+		frozen_search_pool.push_back(search);
+	}
+
+	return !r_path_indices.is_empty();
+}
+
 real_t AStar3D::_estimate_cost(int64_t p_from_id, int64_t p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -435,6 +689,21 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
+	if (frozen) {
+		LocalVector<uint32_t> path_indices;
+		if (!_get_frozen_path(this, p_from_id, p_to_id, p_allow_partial_path, path_indices)) {
+			return Vector<Vector3>();
+		}
+
+		Vector<Vector3> path;
+		path.resize(path_indices.size());
+		Vector3 *w = path.ptrw();
+		for (uint32_t i = 0; i < path_indices.size(); i++) {
+			w[i] = frozen_graph.positions[path_indices[i]];
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -489,6 +758,21 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
+	if (frozen) {
+		LocalVector<uint32_t> path_indices;
+		if (!_get_frozen_path(this, p_from_id, p_to_id, p_allow_partial_path, path_indices)) {
+			return Vector<int64_t>();
+		}
+
+		Vector<int64_t> path;
+		path.resize(path_indices.size());
+		int64_t *w = path.ptrw();
+		for (uint32_t i = 0; i < path_indices.size(); i++) {
+			w[i] = frozen_graph.ids[path_indices[i]];
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -534,6 +818,9 @@ void AStar3D::set_point_disabled(int64_t p_id, bool p_disabled) {
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set if point is disabled. Point with id: %d doesn't exist.", p_id));
 
 	p->enabled = !p_disabled;
+	if (frozen) {
+		frozen_graph.enabled[frozen_graph.id_to_index[p_id]] = !p_disabled;
+	}
 }
 
 bool AStar3D::is_point_disabled(int64_t p_id) const {
@@ -568,6 +855,9 @@ void AStar3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar3D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar3D::clear);
 
+	ClassDB::bind_method(D_METHOD("freeze"), &AStar3D::freeze);
+	ClassDB::bind_method(D_METHOD("is_frozen"), &AStar3D::is_frozen);
+
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar3D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar3D::get_closest_position_in_segment);
 
@@ -578,8 +868,19 @@ void AStar3D::_bind_methods() {
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
 }
 
+void AStar3D::freeze() {
+	_freeze(this);
+}
+
+bool AStar3D::is_frozen() const {
+	return frozen;
+}
+
 AStar3D::~AStar3D() {
 	clear();
+	for (FrozenSearch *search : frozen_search_pool) {
+		memdelete(search);
+	}
 }
 
 /////////////////////////////////////////////////////////////
@@ -657,6 +958,14 @@ void AStar2D::clear() {
 	astar.clear();
 }
 
+void AStar2D::freeze() {
+	astar._freeze(this);
+}
+
+bool AStar2D::is_frozen() const {
+	return astar.is_frozen();
+}
+
 void AStar2D::reserve_space(int64_t p_num_nodes) {
 	astar.reserve_space(p_num_nodes);
 }
@@ -718,6 +1027,22 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
+	if (astar.frozen) {
+		LocalVector<uint32_t> path_indices;
+		if (!astar._get_frozen_path(this, p_from_id, p_to_id, p_allow_partial_path, path_indices)) {
+			return Vector<Vector2>();
+		}
+
+		Vector<Vector2> path;
+		path.resize(path_indices.size());
+		Vector2 *w = path.ptrw();
+		for (uint32_t i = 0; i < path_indices.size(); i++) {
+			const Vector3 &pos = astar.frozen_graph.positions[path_indices[i]];
+			w[i] = Vector2(pos.x, pos.y);
+		}
+		return path;
+	}
+
 	AStar3D::Point *begin_point = a;
 	AStar3D::Point *end_point = b;
 
@@ -772,6 +1097,21 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
+	if (astar.frozen) {
+		LocalVector<uint32_t> path_indices;
+		if (!astar._get_frozen_path(this, p_from_id, p_to_id, p_allow_partial_path, path_indices)) {
+			return Vector<int64_t>();
+		}
+
+		Vector<int64_t> path;
+		path.resize(path_indices.size());
+		int64_t *w = path.ptrw();
+		for (uint32_t i = 0; i < path_indices.size(); i++) {
+			w[i] = astar.frozen_graph.ids[path_indices[i]];
+		}
+		return path;
+	}
+
 	AStar3D::Point *begin_point = a;
 	AStar3D::Point *end_point = b;
 
@@ -907,6 +1247,9 @@ void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar2D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar2D::clear);
 
+	ClassDB::bind_method(D_METHOD("freeze"), &AStar2D::freeze);
+	ClassDB::bind_method(D_METHOD("is_frozen"), &AStar2D::is_frozen);
+
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar2D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar2D::get_closest_position_in_segment);
 
@@ -34,6 +34,7 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
 #include "core/templates/oa_hash_map.h"
 
 /**
@@ -109,6 +110,32 @@ class AStar3D : public RefCounted {
 		}
 	};
 
+	// Compact copy of the graph that searches run on once it is frozen. Points are
+	// stored by dense index, and the connections of point i are the entries
+	// neighbor_offsets[i] to neighbor_offsets[i + 1] of the neighbor arrays.
+	struct FrozenGraph {
+		HashMap<int64_t, uint32_t> id_to_index;
+		LocalVector<int64_t> ids;
+		LocalVector<Vector3> positions;
+		LocalVector<real_t> weight_scales;
+		LocalVector<uint8_t> enabled;
+		LocalVector<uint32_t> neighbor_offsets;
+		LocalVector<uint32_t> neighbor_indices;
+		LocalVector<real_t> neighbor_costs;
+	};
+
+	// Per-search state for frozen graphs, so searches never write to the shared graph.
+	struct FrozenSearch {
+		LocalVector<uint32_t> prev_indices;
+		LocalVector<real_t> g_scores;
+		LocalVector<real_t> f_scores;
+		LocalVector<uint32_t> open_passes;
+		LocalVector<uint32_t> closed_passes;
+		LocalVector<uint32_t> heap_positions;
+		LocalVector<uint32_t> open_heap;
+		uint32_t pass = 0;
+	};
+
 	mutable int64_t last_free_id = 0;
 	uint64_t pass = 1;
 
@@ -116,8 +143,21 @@ class AStar3D : public RefCounted {
 	HashSet<Segment, Segment> segments;
 	Point *last_closest_point = nullptr;
 
+	bool frozen = false;
+	FrozenGraph frozen_graph;
+	mutable Mutex frozen_search_mutex;
+	mutable LocalVector<FrozenSearch *> frozen_search_pool;
+
 	bool _solve(Point *begin_point, Point *end_point, bool p_allow_partial_path);
 
+	void _unfreeze();
+	template <typename T>
+	void _freeze(T *p_owner);
+	template <typename T>
+	bool _solve_frozen(T *p_owner, FrozenSearch &r_search, uint32_t p_begin_index, uint32_t p_end_index, bool p_allow_partial_path, uint32_t &r_last_index) const;
+	template <typename T>
+	bool _get_frozen_path(T *p_owner, int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path, LocalVector<uint32_t> &r_path_indices) const;
+
 protected:
 	static void _bind_methods();
 
@@ -158,6 +198,9 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void freeze();
+	bool is_frozen() const;
+
 	int64_t get_closest_point(const Vector3 &p_point, bool p_include_disabled = false) const;
 	Vector3 get_closest_position_in_segment(const Vector3 &p_point) const;
 
@@ -170,6 +213,7 @@ public:
 
 class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
+	friend class AStar3D;
 	AStar3D astar;
 
 	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path);
@@ -214,6 +258,9 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void freeze();
+	bool is_frozen() const;
+
 	int64_t get_closest_point(const Vector2 &p_point, bool p_include_disabled = false) const;
 	Vector2 get_closest_position_in_segment(const Vector2 &p_point) const;
 
@@ -62,6 +62,15 @@ static real_t heuristic_chebyshev(const Vector2i &p_from, const Vector2i &p_to)
 
 static real_t (*heuristics[AStarGrid2D::HEURISTIC_MAX])(const Vector2i &, const Vector2i &) = { heuristic_euclidean, heuristic_manhattan, heuristic_octile, heuristic_chebyshev };
 
+static const Vector2i jump_directions[4] = { Vector2i(1, 0), Vector2i(-1, 0), Vector2i(0, 1), Vector2i(0, -1) };
+
+static _FORCE_INLINE_ int get_jump_direction(int32_t p_dx, int32_t p_dy) {
+	if (p_dx != 0) {
+		return p_dx > 0 ? 0 : 1;
+	}
+	return p_dy > 0 ? 2 : 3;
+}
+
 void AStarGrid2D::set_region(const Rect2i &p_region) {
 	ERR_FAIL_COND(p_region.size.x < 0 || p_region.size.y < 0);
 	if (p_region != region) {
@@ -168,6 +177,7 @@ void AStarGrid2D::update() {
 	}
 
 	dirty = false;
+	search_data_dirty = true;
 }
 
 bool AStarGrid2D::is_in_bounds(int32_t p_x, int32_t p_y) const {
@@ -183,13 +193,30 @@ bool AStarGrid2D::is_dirty() const {
 }
 
 void AStarGrid2D::set_jumping_enabled(bool p_enabled) {
+	if (jumping_enabled == p_enabled) {
+		return;
+	}
 	jumping_enabled = p_enabled;
+	search_data_dirty = true;
 }
 
 bool AStarGrid2D::is_jumping_enabled() const {
 	return jumping_enabled;
 }
 
+void AStarGrid2D::set_chunk_size(int32_t p_chunk_size) {
+	ERR_FAIL_COND_MSG(p_chunk_size < 0, vformat("Can't set chunk size less than 0: %d.", p_chunk_size));
+	if (chunk_size == p_chunk_size) {
+		return;
+	}
+	chunk_size = p_chunk_size;
+	search_data_dirty = true;
+}
+
+int32_t AStarGrid2D::get_chunk_size() const {
+	return chunk_size;
+}
+
 int64_t AStarGrid2D::get_max_traversals() const {
 	return max_traversals;
 }
@@ -201,6 +228,7 @@ void AStarGrid2D::set_max_traversals(int64_t p_max_traversals) {
 void AStarGrid2D::set_diagonal_mode(DiagonalMode p_diagonal_mode) {
 	ERR_FAIL_INDEX((int)p_diagonal_mode, (int)DIAGONAL_MODE_MAX);
 	diagonal_mode = p_diagonal_mode;
+	search_data_dirty = true;
 }
 
 AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
@@ -229,6 +257,7 @@ void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
 	_set_solid_unchecked(p_id, p_solid);
+	search_data_dirty = true;
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -262,6 +291,7 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 			_set_solid_unchecked(x, y, p_solid);
 		}
 	}
+	search_data_dirty = true;
 }
 
 void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weight_scale) {
@@ -279,7 +309,7 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 	}
 }
 
-AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
+AStarGrid2D::Point *AStarGrid2D::_jump(const SearchState &p_search, Point *p_from, Point *p_to) {
 	int32_t from_x = p_from->id.x;
 	int32_t from_y = p_from->id.y;
 
@@ -291,19 +321,19 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(to_x, to_y, dx, dy);
+			return _forced_successor(p_search, to_x, to_y, dx, dy);
 		}
 
 		while (_is_walkable(to_x, to_y) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || _is_walkable(to_x, to_y - dy) || _is_walkable(to_x - dx, to_y))) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_search.end->id.x == to_x && p_search.end->id.y == to_y) {
+				return p_search.end;
 			}
 
 			if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
-			if (_forced_successor(to_x + dx, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y + dy, 0, dy) != nullptr) {
+			if (_forced_successor(p_search, to_x + dx, to_y, dx, 0) != nullptr || _forced_successor(p_search, to_x, to_y + dy, 0, dy) != nullptr) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
@@ -313,19 +343,19 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(from_x, from_y, dx, dy, true);
+			return _forced_successor(p_search, from_x, from_y, dx, dy, true);
 		}
 
 		while (_is_walkable(to_x, to_y) && _is_walkable(to_x, to_y - dy) && _is_walkable(to_x - dx, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_search.end->id.x == to_x && p_search.end->id.y == to_y) {
+				return p_search.end;
 			}
 
 			if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
-			if (_forced_successor(to_x, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y, 0, dy) != nullptr) {
+			if (_forced_successor(p_search, to_x, to_y, dx, 0) != nullptr || _forced_successor(p_search, to_x, to_y, 0, dy) != nullptr) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
@@ -335,19 +365,19 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else { // DIAGONAL_MODE_NEVER
 		if (dy == 0) {
-			return _forced_successor(from_x, from_y, dx, 0, true);
+			return _forced_successor(p_search, from_x, from_y, dx, 0, true);
 		}
 
 		while (_is_walkable(to_x, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_search.end->id.x == to_x && p_search.end->id.y == to_y) {
+				return p_search.end;
 			}
 
 			if ((_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy)) || (_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy))) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
-			if (_forced_successor(to_x, to_y, 1, 0, true) != nullptr || _forced_successor(to_x, to_y, -1, 0, true) != nullptr) {
+			if (_forced_successor(p_search, to_x, to_y, 1, 0, true) != nullptr || _forced_successor(p_search, to_x, to_y, -1, 0, true) != nullptr) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
@@ -358,43 +388,51 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 	return nullptr;
 }
 
-AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive) {
-	// Remembering previous results can improve performance.
-	bool l_prev = false, r_prev = false, l = false, r = false;
-
-	int32_t o_x = p_x, o_y = p_y;
+AStarGrid2D::Point *AStarGrid2D::_forced_successor(const SearchState &p_search, int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive) {
+	// Looks up the next jump point along the line in the jump distances, which is the
+	// point after the first point whose side opens up when p_inclusive is true.
 	if (p_inclusive) {
-		o_x += p_dx;
-		o_y += p_dy;
-	}
-
-	int32_t l_x = p_x - p_dy, l_y = p_y - p_dx;
-	int32_t r_x = p_x + p_dy, r_y = p_y + p_dx;
-
-	while (_is_walkable(o_x, o_y)) {
-		if (end->id.x == o_x && end->id.y == o_y) {
-			return end;
+		if (!_is_walkable(p_x + p_dx, p_y + p_dy)) {
+			return nullptr;
 		}
+		if (_is_jump_point(p_x, p_y, p_dx, p_dy)) {
+			return _get_point_unchecked(p_x + p_dx, p_y + p_dy);
+		}
+		p_x += p_dx;
+		p_y += p_dy;
+	} else if (!_is_walkable(p_x, p_y)) {
+		return nullptr;
+	}
 
-		l_prev = l || _is_walkable(l_x, l_y);
-		r_prev = r || _is_walkable(r_x, r_y);
-
-		l_x += p_dx;
-		l_y += p_dy;
-		r_x += p_dx;
-		r_y += p_dy;
-
-		l = _is_walkable(l_x, l_y);
-		r = _is_walkable(r_x, r_y);
+	const int32_t distance = jump_distances[get_jump_direction(p_dx, p_dy)][_to_point_index(p_x, p_y)];
+
+	int32_t last_step = 0;
+	int32_t jump_step = -1;
+	if (distance < 0) {
+		last_step = -distance - 1;
+	} else if (!p_inclusive) {
+		last_step = distance;
+		jump_step = distance;
+	} else if (_is_walkable(p_x + (distance + 1) * p_dx, p_y + (distance + 1) * p_dy)) {
+		last_step = distance + 1;
+		jump_step = distance + 1;
+	} else {
+		last_step = distance;
+	}
 
-		if ((l && !l_prev) || (r && !r_prev)) {
-			return _get_point_unchecked(o_x, o_y);
+	// The end point is returned as soon as the line reaches it.
+	const Vector2i &end_id = p_search.end->id;
+	if (p_dx != 0 ? end_id.y == p_y : end_id.x == p_x) {
+		const int32_t end_step = p_dx != 0 ? (end_id.x - p_x) * p_dx : (end_id.y - p_y) * p_dy;
+		if (end_step >= 0 && end_step <= last_step) {
+			return p_search.end;
 		}
+	}
 
-		o_x += p_dx;
-		o_y += p_dy;
+	if (jump_step < 0) {
+		return nullptr;
 	}
-	return nullptr;
+	return _get_point_unchecked(p_x + jump_step * p_dx, p_y + jump_step * p_dy);
 }
 
 void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
@@ -501,37 +539,307 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 	}
 }
 
-bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
-	last_closest_point = nullptr;
-	pass++;
+void AStarGrid2D::_update_jump_distances() {
+	const int32_t width = region.size.x;
+	const int32_t height = region.size.y;
+
+	for (int direction = 0; direction < 4; direction++) {
+		const int32_t dx = jump_directions[direction].x;
+		const int32_t dy = jump_directions[direction].y;
+		LocalVector<int32_t> &distances = jump_distances[direction];
+		distances.resize(width * height);
+
+		// Walk against the direction, so the next point along it is always done first.
+		for (int32_t j = 0; j < height; j++) {
+			const int32_t y = dy > 0 ? region.position.y + height - 1 - j : region.position.y + j;
+			for (int32_t i = 0; i < width; i++) {
+				const int32_t x = dx > 0 ? region.position.x + width - 1 - i : region.position.x + i;
+				if (!_is_walkable(x, y)) {
+					continue;
+				}
 
-	if (_get_solid_unchecked(p_end_point->id) && !p_allow_partial_path) {
+				int32_t &distance = distances[_to_point_index(x, y)];
+				if (_is_jump_point(x, y, dx, dy)) {
+					distance = 0;
+				} else if (_is_walkable(x + dx, y + dy)) {
+					const int32_t next_distance = distances[_to_point_index(x + dx, y + dy)];
+					distance = next_distance >= 0 ? next_distance + 1 : next_distance - 1;
+				} else {
+					distance = -1;
+				}
+			}
+		}
+	}
+}
+
+void AStarGrid2D::_update_chunk_graph() {
+	chunk_count = Size2i(Math::division_round_up(region.size.x, chunk_size), Math::division_round_up(region.size.y, chunk_size));
+
+	// Any step between walkable points of two chunks connects them. This can only
+	// overestimate the connections, so a missing chunk route means there is no path.
+	const int offset_count = diagonal_mode == DIAGONAL_MODE_NEVER ? 4 : 8;
+	static const Vector2i offsets[8] = { Vector2i(1, 0), Vector2i(-1, 0), Vector2i(0, 1), Vector2i(0, -1), Vector2i(1, 1), Vector2i(-1, 1), Vector2i(1, -1), Vector2i(-1, -1) };
+
+	LocalVector<uint64_t> chunk_pairs;
+	const int32_t end_x = region.get_end().x;
+	const int32_t end_y = region.get_end().y;
+	for (int32_t y = region.position.y; y < end_y; y++) {
+		const int32_t chunk_y = (y - region.position.y) % chunk_size;
+		const bool on_chunk_row_border = chunk_y == 0 || chunk_y == chunk_size - 1;
+		for (int32_t x = region.position.x; x < end_x; x++) {
+			const int32_t chunk_x = (x - region.position.x) % chunk_size;
+			if (!on_chunk_row_border && chunk_x != 0 && chunk_x != chunk_size - 1) {
+				continue;
+			}
+			if (!_is_walkable(x, y)) {
+				continue;
+			}
+
+			const uint32_t chunk_index = _to_chunk_index(x, y);
+			for (int i = 0; i < offset_count; i++) {
+				const int32_t neighbor_x = x + offsets[i].x;
+				const int32_t neighbor_y = y + offsets[i].y;
+				if (!_is_walkable(neighbor_x, neighbor_y)) {
+					continue;
+				}
+				const uint32_t neighbor_chunk_index = _to_chunk_index(neighbor_x, neighbor_y);
+				if (neighbor_chunk_index != chunk_index) {
+					chunk_pairs.push_back(((uint64_t)chunk_index << 32) | neighbor_chunk_index);
+				}
+			}
+		}
+	}
+	chunk_pairs.sort();
+
+	const uint32_t total_chunk_count = chunk_count.x * chunk_count.y;
+	chunk_neighbor_offsets.resize(total_chunk_count + 1);
+	chunk_neighbors.clear();
+	uint32_t pair_index = 0;
+	for (uint32_t chunk_index = 0; chunk_index < total_chunk_count; chunk_index++) {
+		chunk_neighbor_offsets[chunk_index] = chunk_neighbors.size();
+		while (pair_index < chunk_pairs.size() && (chunk_pairs[pair_index] >> 32) == chunk_index) {
+			const uint32_t neighbor_chunk_index = chunk_pairs[pair_index] & UINT32_MAX;
+			if (chunk_neighbors.size() == chunk_neighbor_offsets[chunk_index] || chunk_neighbors[chunk_neighbors.size() - 1] != neighbor_chunk_index) {
+				chunk_neighbors.push_back(neighbor_chunk_index);
+			}
+			pair_index++;
+		}
+	}
+	chunk_neighbor_offsets[total_chunk_count] = chunk_neighbors.size();
+}
+
+void AStarGrid2D::_update_search_data() {
+	for (int direction = 0; direction < 4; direction++) {
+		jump_distances[direction].clear();
+	}
+	chunk_count = Size2i();
+	chunk_neighbor_offsets.clear();
+	chunk_neighbors.clear();
+
+	if (region.has_area()) {
+		if (jumping_enabled) {
+			_update_jump_distances();
+		}
+		if (chunk_size > 0) {
+			_update_chunk_graph();
+		}
+	}
+
+	search_data_dirty = false;
+}
+
+AStarGrid2D::SearchState *AStarGrid2D::_acquire_search_state() {
+	MutexLock search_lock(search_mutex);
+
+	if (search_data_dirty) {
+		_update_search_data();
+	}
+
+	SearchState *search = nullptr;
+	if (search_state_pool.is_empty()) {
+		search = memnew(SearchState);
+	} else {
+		search = search_state_pool[search_state_pool.size() - 1];
+		search_state_pool.resize(search_state_pool.size() - 1);
+	}
+
+	const uint32_t point_count = region.size.x * region.size.y;
+	if (search->prev_indices.size() != point_count) {
+		search->prev_indices.resize(point_count);
+		search->g_scores.resize(point_count);
+		search->f_scores.resize(point_count);
+		search->heap_positions.resize(point_count);
+		search->open_passes.resize(point_count);
+		search->closed_passes.resize(point_count);
+		memset(search->open_passes.ptr(), 0, point_count * sizeof(uint32_t));
+		memset(search->closed_passes.ptr(), 0, point_count * sizeof(uint32_t));
+		search->pass = 0;
+	}
+
+	const uint32_t total_chunk_count = chunk_count.x * chunk_count.y;
+	if (search->chunk_prev_indices.size() != total_chunk_count) {
+		search->chunk_prev_indices.resize(total_chunk_count);
+		search->chunk_visited_passes.resize(total_chunk_count);
+		search->chunk_route_passes.resize(total_chunk_count);
+		memset(search->chunk_visited_passes.ptr(), 0, total_chunk_count * sizeof(uint32_t));
+		memset(search->chunk_route_passes.ptr(), 0, total_chunk_count * sizeof(uint32_t));
+		search->chunk_pass = 0;
+	}
+
+	return search;
+}
+
+void AStarGrid2D::_release_search_state(SearchState *p_search) {
+	MutexLock search_lock(search_mutex);
+	search_state_pool.push_back(p_search);
+}
+
+bool AStarGrid2D::_find_chunk_route(SearchState &r_search, const Point *p_begin_point, const Point *p_end_point) {
+	r_search.chunk_pass++;
+	if (r_search.chunk_pass == 0) {
+		// The pass counter wrapped around, old marks could match again.
+		memset(r_search.chunk_visited_passes.ptr(), 0, r_search.chunk_visited_passes.size() * sizeof(uint32_t));
+		memset(r_search.chunk_route_passes.ptr(), 0, r_search.chunk_route_passes.size() * sizeof(uint32_t));
+		r_search.chunk_pass = 1;
+	}
+	const uint32_t chunk_pass = r_search.chunk_pass;
+
+	const uint32_t begin_chunk_index = _to_chunk_index(p_begin_point->id.x, p_begin_point->id.y);
+	const uint32_t end_chunk_index = _to_chunk_index(p_end_point->id.x, p_end_point->id.y);
+
+	// Breadth-first search for the route with the fewest chunks.
+	r_search.chunk_queue.clear();
+	r_search.chunk_queue.push_back(begin_chunk_index);
+	r_search.chunk_visited_passes[begin_chunk_index] = chunk_pass;
+	bool found_route = begin_chunk_index == end_chunk_index;
+	for (uint32_t queue_index = 0; queue_index < r_search.chunk_queue.size() && !found_route; queue_index++) {
+		const uint32_t chunk_index = r_search.chunk_queue[queue_index];
+		for (uint32_t i = chunk_neighbor_offsets[chunk_index]; i < chunk_neighbor_offsets[chunk_index + 1]; i++) {
+			const uint32_t neighbor_chunk_index = chunk_neighbors[i];
+			if (r_search.chunk_visited_passes[neighbor_chunk_index] == chunk_pass) {
+				continue;
+			}
+			r_search.chunk_visited_passes[neighbor_chunk_index] = chunk_pass;
+			r_search.chunk_prev_indices[neighbor_chunk_index] = chunk_index;
+			if (neighbor_chunk_index == end_chunk_index) {
+				found_route = true;
+				break;
+			}
+			r_search.chunk_queue.push_back(neighbor_chunk_index);
+		}
+	}
+
+	if (!found_route) {
 		return false;
 	}
 
+	// The points may leave the route chunks for the chunks next to them, so paths can
+	// round corners the chunk route cuts.
+	uint32_t chunk_index = end_chunk_index;
+	while (true) {
+		r_search.chunk_route_passes[chunk_index] = chunk_pass;
+		for (uint32_t i = chunk_neighbor_offsets[chunk_index]; i < chunk_neighbor_offsets[chunk_index + 1]; i++) {
+			r_search.chunk_route_passes[chunk_neighbors[i]] = chunk_pass;
+		}
+		if (chunk_index == begin_chunk_index) {
+			break;
+		}
+		chunk_index = r_search.chunk_prev_indices[chunk_index];
+	}
+
+	return true;
+}
+
+bool AStarGrid2D::_solve_points(SearchState &r_search, Point *p_begin_point, Point *p_end_point, bool p_use_chunk_route) {
+	r_search.last_closest_index = UINT32_MAX;
+	r_search.pass++;
+	if (r_search.pass == 0) {
+		// The pass counter wrapped around, old marks could match again.
+		memset(r_search.open_passes.ptr(), 0, r_search.open_passes.size() * sizeof(uint32_t));
+		memset(r_search.closed_passes.ptr(), 0, r_search.closed_passes.size() * sizeof(uint32_t));
+		r_search.pass = 1;
+	}
+	const uint32_t pass = r_search.pass;
+
 	bool found_route = false;
 	int64_t traversal_count = 0;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	real_t *g_scores = r_search.g_scores.ptr();
+	real_t *f_scores = r_search.f_scores.ptr();
+	uint32_t *heap_positions = r_search.heap_positions.ptr();
+	LocalVector<uint32_t> &open_heap = r_search.open_heap;
+	open_heap.clear();
 	LocalVector<Point *> nbors;
 
-	p_begin_point->g_score = 0;
-	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	p_begin_point->abs_g_score = 0;
-	p_begin_point->abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	open_list.push_back(p_begin_point);
-	end = p_end_point;
+	// Lower f scores first, and the points further from the start on ties.
+	auto is_better = [&](uint32_t p_a, uint32_t p_b) -> bool {
+		if (f_scores[p_a] != f_scores[p_b]) {
+			return f_scores[p_a] < f_scores[p_b];
+		}
+		return g_scores[p_a] > g_scores[p_b];
+	};
+	auto sift_up = [&](uint32_t p_heap_position) {
+		const uint32_t point_index = open_heap[p_heap_position];
+		while (p_heap_position > 0) {
+			const uint32_t parent_position = (p_heap_position - 1) / 2;
+			const uint32_t parent_index = open_heap[parent_position];
+			if (!is_better(point_index, parent_index)) {
+				break;
+			}
+			open_heap[p_heap_position] = parent_index;
+			heap_positions[parent_index] = p_heap_position;
+			p_heap_position = parent_position;
+		}
+		open_heap[p_heap_position] = point_index;
+		heap_positions[point_index] = p_heap_position;
+	};
+	auto sift_down = [&](uint32_t p_heap_position) {
+		const uint32_t heap_size = open_heap.size();
+		const uint32_t point_index = open_heap[p_heap_position];
+		while (true) {
+			uint32_t child_position = p_heap_position * 2 + 1;
+			if (child_position >= heap_size) {
+				break;
+			}
+			if (child_position + 1 < heap_size && is_better(open_heap[child_position + 1], open_heap[child_position])) {
+				child_position++;
+			}
+			const uint32_t child_index = open_heap[child_position];
+			if (!is_better(child_index, point_index)) {
+				break;
+			}
+			open_heap[p_heap_position] = child_index;
+			heap_positions[child_index] = p_heap_position;
+			p_heap_position = child_position;
+		}
+		open_heap[p_heap_position] = point_index;
+		heap_positions[point_index] = p_heap_position;
+	};
 
-	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+	const uint32_t begin_index = _to_point_index(p_begin_point->id.x, p_begin_point->id.y);
+	const uint32_t end_index = _to_point_index(p_end_point->id.x, p_end_point->id.y);
+	g_scores[begin_index] = 0;
+	f_scores[begin_index] = _estimate_cost(p_begin_point->id, p_end_point->id);
+	r_search.open_passes[begin_index] = pass;
+	open_heap.push_back(begin_index);
+	heap_positions[begin_index] = 0;
+
+	while (!open_heap.is_empty()) {
+		const uint32_t p_index = open_heap[0]; // The currently processed point.
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+		if (r_search.last_closest_index == UINT32_MAX) {
+			r_search.last_closest_index = p_index;
+		} else {
+			const uint32_t last_index = r_search.last_closest_index;
+			const real_t last_estimate = f_scores[last_index] - g_scores[last_index];
+			const real_t estimate = f_scores[p_index] - g_scores[p_index];
+			if (last_estimate > estimate || (last_estimate >= estimate && g_scores[last_index] > g_scores[p_index])) {
+				r_search.last_closest_index = p_index;
+			}
 		}
 
-		if (p == p_end_point) {
+		if (p_index == end_index) {
 			found_route = true;
 			break;
 		}
@@ -544,10 +852,17 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 		// Increment traversals for each node we process.
 		traversal_count++;
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		// Remove the current point from the open list.
+		const uint32_t last_heap_index = open_heap[open_heap.size() - 1];
+		open_heap.resize(open_heap.size() - 1);
+		if (!open_heap.is_empty()) {
+			open_heap[0] = last_heap_index;
+			heap_positions[last_heap_index] = 0;
+			sift_down(0);
+		}
+		r_search.closed_passes[p_index] = pass; // Mark the point as closed.
 
+		Point *p = _get_point_by_index(p_index);
 		nbors.clear();
 		_get_nbors(p, nbors);
 
@@ -556,46 +871,75 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 
 			if (jumping_enabled) {
 				// TODO: Make it works with weight_scale.
-				e = _jump(p, e);
-				if (!e || e->closed_pass == pass) {
+				e = _jump(r_search, p, e);
+				if (!e) {
 					continue;
 				}
 			} else {
-				if (_get_solid_unchecked(e->id) || e->closed_pass == pass) {
+				if (_get_solid_unchecked(e->id)) {
 					continue;
 				}
 				weight_scale = e->weight_scale;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * weight_scale;
+			const uint32_t e_index = _to_point_index(e->id.x, e->id.y);
+			if (r_search.closed_passes[e_index] == pass) {
+				continue;
+			}
+			if (p_use_chunk_route && r_search.chunk_route_passes[_to_chunk_index(e->id.x, e->id.y)] != r_search.chunk_pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = g_scores[p_index] + _compute_cost(p->id, e->id) * weight_scale;
 			bool new_point = false;
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
-				open_list.push_back(e);
+			if (r_search.open_passes[e_index] != pass) { // The point wasn't inside the open list.
+				r_search.open_passes[e_index] = pass;
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= g_scores[e_index]) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, p_end_point->id);
-
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			r_search.prev_indices[e_index] = p_index;
+			g_scores[e_index] = tentative_g_score;
+			f_scores[e_index] = tentative_g_score + _estimate_cost(e->id, p_end_point->id);
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			if (new_point) {
+				open_heap.push_back(e_index);
+				heap_positions[e_index] = open_heap.size() - 1;
 			}
+			// Scores only ever improve, so the point can only move up.
+			sift_up(heap_positions[e_index]);
 		}
 	}
 
 	return found_route;
 }
 
+bool AStarGrid2D::_solve(SearchState &r_search, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
+	r_search.end = p_end_point;
+	r_search.last_closest_index = UINT32_MAX;
+
+	if (_get_solid_unchecked(p_end_point->id) && !p_allow_partial_path) {
+		return false;
+	}
+
+	// On grids split into chunks, first find a route over the chunks and only search the
+	// points along it. Searching the whole grid is the fallback when that finds no path.
+	bool use_chunk_route = false;
+	if (!chunk_neighbor_offsets.is_empty() && !_get_solid_unchecked(p_begin_point->id)) {
+		use_chunk_route = _find_chunk_route(r_search, p_begin_point, p_end_point);
+		if (!use_chunk_route && !p_allow_partial_path) {
+			return false;
+		}
+	}
+
+	if (use_chunk_route && _solve_points(r_search, p_begin_point, p_end_point, true)) {
+		return true;
+	}
+	return _solve_points(r_search, p_begin_point, p_end_point, false);
+}
+
 real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -615,6 +959,7 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 void AStarGrid2D::clear() {
 	points.clear();
 	region = Rect2i();
+	search_data_dirty = true;
 }
 
 Vector2 AStarGrid2D::get_point_position(const Vector2i &p_id) const {
@@ -664,24 +1009,26 @@ Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vec
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	const uint32_t begin_index = _to_point_index(a->id.x, a->id.y);
+	SearchState *search = _acquire_search_state();
 
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
+	uint32_t end_index = _to_point_index(b->id.x, b->id.y);
+	bool found_route = _solve(*search, a, b, p_allow_partial_path);
 	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
+		if (!p_allow_partial_path || search->last_closest_index == UINT32_MAX) {
+			_release_search_state(search);
 			return Vector<Vector2>();
 		}
 
 		// Use closest point instead.
-		end_point = last_closest_point;
+		end_index = search->last_closest_index;
 	}
 
-	Point *p = end_point;
+	uint32_t index = end_index;
 	int32_t pc = 1;
-	while (p != begin_point) {
+	while (index != begin_index) {
 		pc++;
-		p = p->prev_point;
+		index = search->prev_indices[index];
 	}
 
 	Vector<Vector2> path;
@@ -690,16 +1037,17 @@ Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vec
 	{
 		Vector2 *w = path.ptrw();
 
-		p = end_point;
+		index = end_index;
 		int32_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->pos;
-			p = p->prev_point;
+		while (index != begin_index) {
+			w[idx--] = _get_point_by_index(index)->pos;
+			index = search->prev_indices[index];
 		}
 
-		w[0] = p->pos;
+		w[0] = a->pos;
 	}
 
+	_release_search_state(search);
 	return path;
 }
 
@@ -717,43 +1065,52 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	const uint32_t begin_index = _to_point_index(a->id.x, a->id.y);
+	SearchState *search = _acquire_search_state();
 
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
+	uint32_t end_index = _to_point_index(b->id.x, b->id.y);
+	bool found_route = _solve(*search, a, b, p_allow_partial_path);
 	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
+		if (!p_allow_partial_path || search->last_closest_index == UINT32_MAX) {
+			_release_search_state(search);
 			return TypedArray<Vector2i>();
 		}
 
 		// Use closest point instead.
-		end_point = last_closest_point;
+		end_index = search->last_closest_index;
 	}
 
-	Point *p = end_point;
+	uint32_t index = end_index;
 	int32_t pc = 1;
-	while (p != begin_point) {
+	while (index != begin_index) {
 		pc++;
-		p = p->prev_point;
+		index = search->prev_indices[index];
 	}
 
 	TypedArray<Vector2i> path;
 	path.resize(pc);
 
 	{
-		p = end_point;
+		index = end_index;
 		int32_t idx = pc - 1;
-		while (p != begin_point) {
-			path[idx--] = p->id;
-			p = p->prev_point;
+		while (index != begin_index) {
+			path[idx--] = _get_point_by_index(index)->id;
+			index = search->prev_indices[index];
 		}
 
-		path[0] = p->id;
+		path[0] = a->id;
 	}
 
+	_release_search_state(search);
 	return path;
 }
 
+AStarGrid2D::~AStarGrid2D() {
+	for (SearchState *search : search_state_pool) {
+		memdelete(search);
+	}
+}
+
 void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_region", "region"), &AStarGrid2D::set_region);
 	ClassDB::bind_method(D_METHOD("get_region"), &AStarGrid2D::get_region);
@@ -769,6 +1126,8 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_in_boundsv", "id"), &AStarGrid2D::is_in_boundsv);
 	ClassDB::bind_method(D_METHOD("is_dirty"), &AStarGrid2D::is_dirty);
 	ClassDB::bind_method(D_METHOD("update"), &AStarGrid2D::update);
+	ClassDB::bind_method(D_METHOD("set_chunk_size", "chunk_size"), &AStarGrid2D::set_chunk_size);
+	ClassDB::bind_method(D_METHOD("get_chunk_size"), &AStarGrid2D::get_chunk_size);
 	ClassDB::bind_method(D_METHOD("set_jumping_enabled", "enabled"), &AStarGrid2D::set_jumping_enabled);
 	ClassDB::bind_method(D_METHOD("is_jumping_enabled"), &AStarGrid2D::is_jumping_enabled);
 	ClassDB::bind_method(D_METHOD("set_max_traversals", "max_traversals"), &AStarGrid2D::set_max_traversals);
@@ -802,6 +1161,7 @@ void AStarGrid2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "cell_shape", PropertyHint::HINT_ENUM, "Square,IsometricRight,IsometricDown"), "set_cell_shape", "get_cell_shape");
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "jumping_enabled"), "set_jumping_enabled", "is_jumping_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "chunk_size", PropertyHint::HINT_RANGE, "0,256,1,or_greater"), "set_chunk_size", "get_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_traversals", PropertyHint::HINT_RANGE, "0,65536,0"), "set_max_traversals", "get_max_traversals");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_compute_heuristic", PropertyHint::HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev"), "set_default_compute_heuristic", "get_default_compute_heuristic");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_estimate_heuristic", PropertyHint::HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev"), "set_default_estimate_heuristic", "get_default_estimate_heuristic");
@@ -34,6 +34,7 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
 #include "core/templates/local_vector.h"
 
 class AStarGrid2D : public RefCounted {
@@ -71,6 +72,7 @@ private:
 	CellShape cell_shape = CELL_SHAPE_SQUARE;
 
 	bool jumping_enabled = false;
+	int32_t chunk_size = 0;
 	int64_t max_traversals = 0;
 	DiagonalMode diagonal_mode = DIAGONAL_MODE_ALWAYS;
 	Heuristic default_compute_heuristic = HEURISTIC_EUCLIDEAN;
@@ -82,41 +84,50 @@ private:
 		Vector2 pos;
 		real_t weight_scale = 1.0;
 
-		// Used for pathfinding.
-		Point *prev_point = nullptr;
-		real_t g_score = 0;
-		real_t f_score = 0;
-		uint64_t open_pass = 0;
-		uint64_t closed_pass = 0;
-
-		// Used for getting last_closest_point.
-		real_t abs_g_score = 0;
-		real_t abs_f_score = 0;
-
 		Point() {}
 
 		Point(const Vector2i &p_id, const Vector2 &p_pos) :
 				id(p_id), pos(p_pos) {}
 	};
 
-	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
-				return true;
-			} else if (A->f_score < B->f_score) {
-				return false;
-			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
-			}
-		}
+	// Scores of a single path query, indexed like the points. Queries take one from a
+	// pool instead of writing into the points, so they can run on several threads.
+	struct SearchState {
+		LocalVector<uint32_t> prev_indices;
+		LocalVector<real_t> g_scores;
+		LocalVector<real_t> f_scores;
+		LocalVector<uint32_t> open_passes;
+		LocalVector<uint32_t> closed_passes;
+		LocalVector<uint32_t> heap_positions;
+		LocalVector<uint32_t> open_heap;
+		uint32_t pass = 0;
+
+		// Route over the chunk graph that limits the search when chunks are used.
+		LocalVector<uint32_t> chunk_prev_indices;
+		LocalVector<uint32_t> chunk_visited_passes;
+		LocalVector<uint32_t> chunk_route_passes;
+		LocalVector<uint32_t> chunk_queue;
+		uint32_t chunk_pass = 0;
+
+		Point *end = nullptr;
+		uint32_t last_closest_index = UINT32_MAX;
 	};
 
 	LocalVector<bool> solid_mask;
 	LocalVector<LocalVector<Point>> points;
-	Point *end = nullptr;
-	Point *last_closest_point = nullptr;
 
-	uint64_t pass = 1;
+	// Data derived from the solid cells, rebuilt by the first query after they changed.
+	bool search_data_dirty = true;
+	// Distances along +x, -x, +y and -y from each walkable point to the next jump point.
+	// Negative values are the number of walkable points before the next solid one instead.
+	LocalVector<int32_t> jump_distances[4];
+	// Chunks next to each other with walkable points on both sides of their border, in CSR layout.
+	Size2i chunk_count;
+	LocalVector<uint32_t> chunk_neighbor_offsets;
+	LocalVector<uint32_t> chunk_neighbors;
+
+	Mutex search_mutex;
+	LocalVector<SearchState *> search_state_pool;
 
 private: // Internal routines.
 	_FORCE_INLINE_ size_t _to_mask_index(int32_t p_x, int32_t p_y) const {
@@ -158,10 +169,35 @@ private: // Internal routines.
 		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
 	}
 
+	_FORCE_INLINE_ uint32_t _to_point_index(int32_t p_x, int32_t p_y) const {
+		return (p_y - region.position.y) * region.size.x + p_x - region.position.x;
+	}
+
+	_FORCE_INLINE_ Point *_get_point_by_index(uint32_t p_index) {
+		return &points[p_index / region.size.x][p_index % region.size.x];
+	}
+
+	_FORCE_INLINE_ uint32_t _to_chunk_index(int32_t p_x, int32_t p_y) const {
+		return ((p_y - region.position.y) / chunk_size) * chunk_count.x + (p_x - region.position.x) / chunk_size;
+	}
+
+	// Whether a side of the line in the given direction opens up after this point.
+	_FORCE_INLINE_ bool _is_jump_point(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy) const {
+		return (_is_walkable(p_x + p_dx - p_dy, p_y + p_dy - p_dx) && !_is_walkable(p_x - p_dy, p_y - p_dx)) || (_is_walkable(p_x + p_dx + p_dy, p_y + p_dy + p_dx) && !_is_walkable(p_x + p_dy, p_y + p_dx));
+	}
+
+	void _update_search_data();
+	void _update_jump_distances();
+	void _update_chunk_graph();
+	SearchState *_acquire_search_state();
+	void _release_search_state(SearchState *p_search);
+
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
-	Point *_jump(Point *p_from, Point *p_to);
-	bool _solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
-	Point *_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive = false);
+	Point *_jump(const SearchState &p_search, Point *p_from, Point *p_to);
+	bool _find_chunk_route(SearchState &r_search, const Point *p_begin_point, const Point *p_end_point);
+	bool _solve_points(SearchState &r_search, Point *p_begin_point, Point *p_end_point, bool p_use_chunk_route);
+	bool _solve(SearchState &r_search, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
+	Point *_forced_successor(const SearchState &p_search, int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive = false);
 
 protected:
 	static void _bind_methods();
@@ -203,6 +239,9 @@ public:
 	void set_jumping_enabled(bool p_enabled);
 	bool is_jumping_enabled() const;
 
+	void set_chunk_size(int32_t p_chunk_size);
+	int32_t get_chunk_size() const;
+
 	void set_max_traversals(int64_t p_max_traversals);
 	int64_t get_max_traversals() const;
 
@@ -230,6 +269,8 @@ public:
 	TypedArray<Dictionary> get_point_data_in_region(const Rect2i &p_region) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
+
+	~AStarGrid2D();
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
@@ -106,6 +106,22 @@ public:
 		return true;
 	}
 
+	// Removes the least recently used entry. Returns false if the cache is empty.
+	bool evict_oldest() {
+		if (_list.is_empty()) {
+			return false;
+		}
+		Element d = _list.back();
+		GODOT_GCC_WARNING_PUSH_AND_IGNORE("-Waddress")
+		if constexpr (BeforeEvict != nullptr) {
+			BeforeEvict(d->get().key, d->get().data);
+		}
+		GODOT_GCC_WARNING_POP
+		_map.erase(d->get().key);
+		_list.pop_back();
+		return true;
+	}
+
 	const TData &get(const TKey &p_key) {
 		Element *e = _map.getptr(p_key);
 		CRASH_COND(!e);
@@ -75,6 +75,7 @@
 #include "servers/movie_writer/movie_writer.h"
 #include "servers/movie_writer/movie_writer_mjpeg.h"
 #include "servers/register_server_types.h"
+#include "servers/rendering/dummy/storage/utilities.h"
 #include "servers/rendering/rendering_server_default.h"
 #include "servers/text/text_server_dummy.h"
 #include "servers/text_server.h"
@@ -600,6 +601,8 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--text-driver <driver>", "Text driver (used for font rendering, bidirectional support and shaping).\n");
 	print_help_option("--tablet-driver <driver>", "Pen tablet input driver.\n");
 	print_help_option("--headless", "Enable headless mode (--display-driver headless --audio-driver Dummy). Useful for servers and with --script.\n");
+	print_help_option("--headless-render-cull", "With the dummy renderer, still run scene and canvas culling for every viewport without drawing anything.\n");
+	print_help_option("", "Useful to profile the CPU side of rendering on machines without a GPU.\n");
 	print_help_option("--log-file <file>", "Write output/error log to the specified path instead of the default location defined by the project.\n");
 	print_help_option("", "<file> path should be absolute or relative to the project directory.\n");
 	print_help_option("--write-movie <file>", "Write a video to the specified path (usually with .avi or .png extension).\n");
@@ -1399,6 +1402,10 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			audio_driver = NULL_AUDIO_DRIVER;
 			display_driver = NULL_DISPLAY_DRIVER;
 
+		} else if (arg == "--headless-render-cull") { // cull scenes and canvases with the dummy renderer.
+
+			RendererDummy::Utilities::set_culling_enabled(true);
+
 		} else if (arg == "--log-file") { // write to log file
 
 			if (N) {
@@ -131,6 +131,12 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(PHYSICS_3D_BROAD_PHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_NARROW_PHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_SOLVER_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_TEMP_MEMORY_PEAK);
+	BIND_ENUM_CONSTANT(AUDIO_REAL_VOICES);
+	BIND_ENUM_CONSTANT(AUDIO_VIRTUAL_VOICES);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -211,6 +217,12 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("physics_3d/broad_phase_thread_time"),
+		PNAME("physics_3d/narrow_phase_thread_time"),
+		PNAME("physics_3d/solver_thread_time"),
+		PNAME("physics_3d/temp_memory_peak"),
+		PNAME("audio/voices/real"),
+		PNAME("audio/voices/virtual"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -435,6 +447,22 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
 
+#ifndef PHYSICS_3D_DISABLED
+		case PHYSICS_3D_BROAD_PHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_BROAD_PHASE_TIME));
+		case PHYSICS_3D_NARROW_PHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_NARROW_PHASE_TIME));
+		case PHYSICS_3D_SOLVER_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_SOLVER_TIME));
+		case PHYSICS_3D_TEMP_MEMORY_PEAK:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_TEMP_MEMORY_PEAK);
+#endif // PHYSICS_3D_DISABLED
+
+		case AUDIO_REAL_VOICES:
+			return AudioServer::get_singleton()->get_real_voice_count();
+		case AUDIO_VIRTUAL_VOICES:
+			return AudioServer::get_singleton()->get_virtual_voice_count();
+
 		default: {
 		}
 	}
@@ -505,6 +533,12 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
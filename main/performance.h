@@ -127,6 +127,12 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		PHYSICS_3D_BROAD_PHASE_TIME,
+		PHYSICS_3D_NARROW_PHASE_TIME,
+		PHYSICS_3D_SOLVER_TIME,
+		PHYSICS_3D_TEMP_MEMORY_PEAK,
+		AUDIO_REAL_VOICES,
+		AUDIO_VIRTUAL_VOICES,
 		MONITOR_MAX
 	};
 
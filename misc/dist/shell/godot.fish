@@ -68,6 +68,7 @@ complete -c redot -l gpu-index -d "Use a specific GPU (run with --verbose to get
 complete -c redot -l text-driver -d "Set the text driver" -x
 complete -c redot -l tablet-driver -d "Set the pen tablet input driver" -x
 complete -c redot -l headless -d "Enable headless mode (--display-driver headless --audio-driver Dummy). Useful for servers and with --script"
+complete -c redot -l headless-render-cull -d "With the dummy renderer, still run scene and canvas culling for every viewport without drawing anything"
 complete -c redot -l log-file -d "Write output/error log to the specified path instead of the default location defined by the project" -x
 complete -c redot -l write-movie -d "Write a video to the specified path (usually with .avi or .png extension). --fixed-fps is forced when enabled" -x
 
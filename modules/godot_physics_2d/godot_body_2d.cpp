@@ -621,7 +621,7 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 
 	ERR_FAIL_NULL(get_space());
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
+	if ((fi_callback_data || body_state_callback.is_valid()) && !direct_state_query_list.in_list()) {
 		get_space()->body_add_to_state_query_list(&direct_state_query_list);
 	}
 
@@ -722,6 +722,40 @@ bool GodotBody2D::sleep_test(real_t p_step) {
 	}
 }
 
+void GodotBody2D::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.rid = get_self().get_id();
+	r_snapshot.transform = get_transform();
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.still_time = still_time;
+	r_snapshot.active = active;
+}
+
+void GodotBody2D::restore_snapshot(const Snapshot &p_snapshot) {
+	ERR_FAIL_NULL(get_space());
+
+	// Same inverses as the integration, so a resimulation matches the original step for step.
+	_set_transform(p_snapshot.transform);
+	if (mode >= PhysicsServer2D::BODY_MODE_RIGID) {
+		_set_inv_transform(get_transform().inverse());
+	} else {
+		_set_inv_transform(get_transform().affine_inverse());
+	}
+	new_transform = p_snapshot.transform;
+	_update_transform_dependent();
+
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	biased_linear_velocity = Vector2();
+	biased_angular_velocity = 0.0;
+	still_time = p_snapshot.still_time;
+	set_active(p_snapshot.active);
+
+	if ((fi_callback_data || body_state_callback.is_valid()) && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void GodotBody2D::set_state_sync_callback(const Callable &p_callable) {
 	body_state_callback = p_callable;
 }
@@ -158,6 +158,19 @@ class GodotBody2D : public GodotCollisionObject2D {
 	friend class GodotPhysicsDirectBodyState2D; // i give up, too many functions to expose
 
 public:
+	// Simulated state saved in space snapshots, forces and everything else set through the server are left alone.
+	struct Snapshot {
+		uint64_t rid = 0;
+		Transform2D transform;
+		Vector2 linear_velocity;
+		real_t angular_velocity = 0.0;
+		real_t still_time = 0.0;
+		bool active = false;
+	};
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
 	void set_state_sync_callback(const Callable &p_callable);
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
@@ -54,7 +54,9 @@ void GodotBodyPair2D::_contact_added_callback(const Vector2 &p_point_A, const Ve
 
 	ERR_FAIL_COND(new_index >= (MAX_CONTACTS + 1));
 
+	// Contacts are saved as is in snapshots, so their padding is kept zeroed.
 	Contact contact;
+	memset(&contact, 0, sizeof(Contact));
 	contact.local_A = local_A;
 	contact.local_B = local_B;
 	contact.normal = (p_point_A - p_point_B).normalized();
@@ -595,8 +597,51 @@ void GodotBodyPair2D::solve(real_t p_step) {
 	}
 }
 
+GodotBodyPair2D::SnapshotHeader GodotBodyPair2D::get_snapshot_header() const {
+	// Zeroed first, so the padding is too and equal states save to equal bytes.
+	SnapshotHeader header;
+	memset(&header, 0, sizeof(SnapshotHeader));
+	header.body_A = A->get_self().get_id();
+	header.body_B = B->get_self().get_id();
+	header.shape_A = shape_A;
+	header.shape_B = shape_B;
+	header.sep_axis = sep_axis;
+	header.contact_count = contact_count;
+	header.collided = collided;
+	return header;
+}
+
+int GodotBodyPair2D::save_snapshot(uint8_t *r_buffer) const {
+	const SnapshotHeader header = get_snapshot_header();
+
+	if (r_buffer) {
+		memcpy(r_buffer, &header, sizeof(SnapshotHeader));
+		memcpy(r_buffer + sizeof(SnapshotHeader), contacts, contact_count * sizeof(Contact));
+	}
+
+	return get_snapshot_size(header);
+}
+
+void GodotBodyPair2D::restore_snapshot(const uint8_t *p_buffer) {
+	SnapshotHeader header;
+	memcpy(&header, p_buffer, sizeof(SnapshotHeader));
+
+	sep_axis = header.sep_axis;
+	collided = header.collided;
+	contact_count = CLAMP(header.contact_count, 0, (int)MAX_CONTACTS);
+	memcpy(contacts, p_buffer + sizeof(SnapshotHeader), contact_count * sizeof(Contact));
+}
+
+void GodotBodyPair2D::clear_contacts() {
+	sep_axis = Vector2();
+	collided = false;
+	contact_count = 0;
+}
+
 GodotBodyPair2D::GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B) :
-		GodotConstraint2D(_arr, 2) {
+		GodotConstraint2D(_arr, 2),
+		pair_list(this) {
+	memset(contacts, 0, sizeof(contacts));
 	A = p_A;
 	B = p_B;
 	shape_A = p_shape_A;
@@ -604,9 +649,11 @@ GodotBodyPair2D::GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p
 	space = A->get_space();
 	A->add_constraint(this, 0);
 	B->add_constraint(this, 1);
+	space->body_pair_add_to_list(&pair_list);
 }
 
 GodotBodyPair2D::~GodotBodyPair2D() {
 	A->remove_constraint(this, 0);
 	B->remove_constraint(this, 1);
+	space->body_pair_remove_from_list(&pair_list);
 }
@@ -85,12 +85,36 @@ class GodotBodyPair2D : public GodotConstraint2D {
 	bool oneway_disabled = false;
 	bool report_contacts_only = false;
 
+	SelfList<GodotBodyPair2D> pair_list;
+
 	bool _test_ccd(real_t p_step, GodotBody2D *p_A, int p_shape_A, const Transform2D &p_xform_A, GodotBody2D *p_B, int p_shape_B, const Transform2D &p_xform_B);
 	void _validate_contacts();
 	static void _add_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_self);
 	_FORCE_INLINE_ void _contact_added_callback(const Vector2 &p_point_A, const Vector2 &p_point_B);
 
 public:
+	// Warm-start state saved in space snapshots, followed by `contact_count` contacts.
+	struct SnapshotHeader {
+		uint64_t body_A = 0;
+		uint64_t body_B = 0;
+		int32_t shape_A = 0;
+		int32_t shape_B = 0;
+		Vector2 sep_axis;
+		int32_t contact_count = 0;
+		bool collided = false;
+	};
+
+	static int get_snapshot_size(const SnapshotHeader &p_header) { return sizeof(SnapshotHeader) + p_header.contact_count * sizeof(Contact); }
+
+	SnapshotHeader get_snapshot_header() const;
+
+	// Returns the size of the snapshot, only writes it if `r_buffer` isn't null.
+	int save_snapshot(uint8_t *r_buffer) const;
+	void restore_snapshot(const uint8_t *p_buffer);
+	void clear_contacts();
+
+	virtual uint64_t get_order_key() const override { return (uint64_t(shape_A) << 32) | uint32_t(shape_B); }
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
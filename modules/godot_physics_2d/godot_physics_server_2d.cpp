@@ -260,6 +260,45 @@ real_t GodotPhysicsServer2D::space_get_param(RID p_space, SpaceParameter p_param
 	return space->get_param(p_param);
 }
 
+PackedByteArray GodotPhysicsServer2D::space_save_state(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Space state can't be saved while the space is being stepped.");
+
+	PackedByteArray state;
+	space->save_state(state);
+	return state;
+}
+
+bool GodotPhysicsServer2D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	ERR_FAIL_COND_V_MSG(space->is_locked() || flushing_queries, false, "Space state can't be restored while the space is being stepped or flushing queries.");
+
+	// The broadphase is updated by the restore, so it has to see the latest shapes.
+	_update_shapes();
+
+	return space->restore_state(p_state);
+}
+
+void GodotPhysicsServer2D::space_set_deterministic(RID p_space, bool p_enabled) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	space->set_deterministic(p_enabled);
+}
+
+bool GodotPhysicsServer2D::space_is_deterministic(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	return space->is_deterministic();
+}
+
+uint32_t GodotPhysicsServer2D::space_get_step_checksum(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, 0);
+	return space->get_step_checksum();
+}
+
 void GodotPhysicsServer2D::space_set_debug_contacts(RID p_space, int p_max_contacts) {
 	GodotSpace2D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
@@ -113,6 +113,13 @@ public:
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) override;
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const override;
 
+	virtual PackedByteArray space_save_state(RID p_space) const override;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override;
+
+	virtual void space_set_deterministic(RID p_space, bool p_enabled) override;
+	virtual bool space_is_deterministic(RID p_space) const override;
+	virtual uint32_t space_get_step_checksum(RID p_space) const override;
+
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
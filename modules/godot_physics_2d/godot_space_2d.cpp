@@ -39,6 +39,42 @@
 #include "godot_area_pair_2d.h"
 #include "godot_body_pair_2d.h"
 
+namespace {
+
+struct StateHeader {
+	uint32_t magic = 0x32535047; // "GPS2"
+	uint32_t real_size = sizeof(real_t);
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+};
+
+struct BodyPairKey {
+	uint64_t body_A = 0;
+	uint64_t body_B = 0;
+	int32_t shape_A = 0;
+	int32_t shape_B = 0;
+
+	static uint32_t hash(const BodyPairKey &p_key) {
+		uint32_t h = hash_murmur3_one_64(p_key.body_A);
+		h = hash_murmur3_one_64(p_key.body_B, h);
+		h = hash_murmur3_one_32(p_key.shape_A, h);
+		h = hash_murmur3_one_32(p_key.shape_B, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const BodyPairKey &p_other) const {
+		return body_A == p_other.body_A && body_B == p_other.body_B && shape_A == p_other.shape_A && shape_B == p_other.shape_B;
+	}
+
+	explicit BodyPairKey(const GodotBodyPair2D::SnapshotHeader &p_header) :
+			body_A(p_header.body_A),
+			body_B(p_header.body_B),
+			shape_A(p_header.shape_A),
+			shape_B(p_header.shape_B) {}
+};
+
+} // namespace
+
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
@@ -1037,6 +1073,11 @@ void *GodotSpace2D::_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A
 		}
 
 	} else {
+		// The broadphase reports the moving object first, ordering by RID keeps pairs recognizable for state restores.
+		if (B->get_self() < A->get_self()) {
+			SWAP(A, B);
+			SWAP(p_subindex_A, p_subindex_B);
+		}
 		GodotBodyPair2D *b = memnew(GodotBodyPair2D(static_cast<GodotBody2D *>(A), p_subindex_A, static_cast<GodotBody2D *>(B), p_subindex_B));
 		return b;
 	}
@@ -1073,6 +1114,14 @@ void GodotSpace2D::body_remove_from_mass_properties_update_list(SelfList<GodotBo
 	mass_properties_update_list.remove(p_body);
 }
 
+void GodotSpace2D::body_pair_add_to_list(SelfList<GodotBodyPair2D> *p_pair) {
+	body_pair_list.add(p_pair);
+}
+
+void GodotSpace2D::body_pair_remove_from_list(SelfList<GodotBodyPair2D> *p_pair) {
+	body_pair_list.remove(p_pair);
+}
+
 GodotBroadPhase2D *GodotSpace2D::get_broadphase() {
 	return broadphase;
 }
@@ -1146,6 +1195,115 @@ void GodotSpace2D::update() {
 	broadphase->update();
 }
 
+void GodotSpace2D::save_state(Vector<uint8_t> &r_state) const {
+	StateHeader header;
+
+	for (const GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			header.body_count++;
+		}
+	}
+
+	int pairs_size = 0;
+	for (const SelfList<GodotBodyPair2D> *E = body_pair_list.first(); E; E = E->next()) {
+		header.pair_count++;
+		pairs_size += E->self()->save_snapshot(nullptr);
+	}
+
+	r_state.resize(sizeof(StateHeader) + header.body_count * sizeof(GodotBody2D::Snapshot) + pairs_size);
+	uint8_t *w = r_state.ptrw();
+
+	memcpy(w, &header, sizeof(StateHeader));
+	w += sizeof(StateHeader);
+
+	for (const GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			// Zeroed first, so the padding is too and equal states save to equal bytes.
+			GodotBody2D::Snapshot snapshot;
+			memset(&snapshot, 0, sizeof(GodotBody2D::Snapshot));
+			static_cast<const GodotBody2D *>(E)->save_snapshot(snapshot);
+			memcpy(w, &snapshot, sizeof(GodotBody2D::Snapshot));
+			w += sizeof(GodotBody2D::Snapshot);
+		}
+	}
+
+	for (const SelfList<GodotBodyPair2D> *E = body_pair_list.first(); E; E = E->next()) {
+		w += E->self()->save_snapshot(w);
+	}
+}
+
+bool GodotSpace2D::restore_state(const Vector<uint8_t> &p_state) {
+	ERR_FAIL_COND_V_MSG(p_state.size() < (int)sizeof(StateHeader), false, "Invalid physics space state.");
+
+	const uint8_t *r = p_state.ptr();
+	const uint8_t *end = r + p_state.size();
+
+	StateHeader header;
+	memcpy(&header, r, sizeof(StateHeader));
+	r += sizeof(StateHeader);
+
+	ERR_FAIL_COND_V_MSG(header.magic != StateHeader().magic || header.real_size != sizeof(real_t), false, "Physics space state was saved by a different physics engine or build.");
+	ERR_FAIL_COND_V_MSG(uint64_t(end - r) < uint64_t(header.body_count) * sizeof(GodotBody2D::Snapshot), false, "Invalid physics space state.");
+
+	HashMap<uint64_t, GodotBody2D *> bodies_by_rid;
+	for (GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			bodies_by_rid.insert(E->get_self().get_id(), static_cast<GodotBody2D *>(E));
+		}
+	}
+
+	// Everything is validated before the first body is touched, so a failed restore leaves the space as it was.
+	LocalVector<GodotBody2D::Snapshot> snapshots;
+	LocalVector<GodotBody2D *> bodies;
+	snapshots.resize(header.body_count);
+	bodies.resize(header.body_count);
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		memcpy(&snapshots[i], r, sizeof(GodotBody2D::Snapshot));
+		r += sizeof(GodotBody2D::Snapshot);
+
+		GodotBody2D **body = bodies_by_rid.getptr(snapshots[i].rid);
+		ERR_FAIL_NULL_V_MSG(body, false, "Physics space state refers to a body that is no longer in the space.");
+		bodies[i] = *body;
+	}
+
+	const uint8_t *pairs = r;
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		GodotBodyPair2D::SnapshotHeader pair_header;
+		ERR_FAIL_COND_V_MSG(end - r < (int)sizeof(GodotBodyPair2D::SnapshotHeader), false, "Invalid physics space state.");
+		memcpy(&pair_header, r, sizeof(GodotBodyPair2D::SnapshotHeader));
+		ERR_FAIL_COND_V_MSG(pair_header.contact_count < 0 || end - r < GodotBodyPair2D::get_snapshot_size(pair_header), false, "Invalid physics space state.");
+		r += GodotBodyPair2D::get_snapshot_size(pair_header);
+	}
+
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		bodies[i]->restore_snapshot(snapshots[i]);
+	}
+
+	// Brings the pairs in line with the restored transforms, the contacts of pairs that existed are then put back.
+	broadphase->update();
+
+	HashMap<BodyPairKey, GodotBodyPair2D *, BodyPairKey> pairs_by_key;
+	for (SelfList<GodotBodyPair2D> *E = body_pair_list.first(); E; E = E->next()) {
+		GodotBodyPair2D *pair = E->self();
+		pair->clear_contacts();
+		pairs_by_key.insert(BodyPairKey(pair->get_snapshot_header()), pair);
+	}
+
+	r = pairs;
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		GodotBodyPair2D::SnapshotHeader pair_header;
+		memcpy(&pair_header, r, sizeof(GodotBodyPair2D::SnapshotHeader));
+
+		GodotBodyPair2D **pair = pairs_by_key.getptr(BodyPairKey(pair_header));
+		if (pair) {
+			(*pair)->restore_snapshot(r);
+		}
+		r += GodotBodyPair2D::get_snapshot_size(pair_header);
+	}
+
+	return true;
+}
+
 void GodotSpace2D::set_param(PhysicsServer2D::SpaceParameter p_param, real_t p_value) {
 	switch (p_param) {
 		case PhysicsServer2D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS:
@@ -1202,6 +1360,36 @@ real_t GodotSpace2D::get_param(PhysicsServer2D::SpaceParameter p_param) const {
 	return 0;
 }
 
+void GodotSpace2D::set_deterministic(bool p_enabled) {
+	deterministic = p_enabled;
+	step_checksum = 0;
+}
+
+void GodotSpace2D::update_step_checksum() {
+	// Per-body hashes are summed, so the result doesn't depend on iteration order.
+	// RIDs are left out, they differ between runs in the same process.
+	uint32_t checksum = 0;
+	for (const GodotCollisionObject2D *E : objects) {
+		if (E->get_type() != GodotCollisionObject2D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody2D *body = static_cast<const GodotBody2D *>(E);
+		const Transform2D &transform = body->get_transform();
+
+		uint32_t h = hash_murmur3_one_real(transform.columns[0].x);
+		h = hash_murmur3_one_real(transform.columns[0].y, h);
+		h = hash_murmur3_one_real(transform.columns[1].x, h);
+		h = hash_murmur3_one_real(transform.columns[1].y, h);
+		h = hash_murmur3_one_real(transform.columns[2].x, h);
+		h = hash_murmur3_one_real(transform.columns[2].y, h);
+		h = hash_murmur3_one_real(body->get_linear_velocity().x, h);
+		h = hash_murmur3_one_real(body->get_linear_velocity().y, h);
+		h = hash_murmur3_one_real(body->get_angular_velocity(), h);
+		checksum += hash_fmix32(h);
+	}
+	step_checksum = checksum;
+}
+
 void GodotSpace2D::lock() {
 	locked = true;
 }
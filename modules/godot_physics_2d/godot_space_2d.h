@@ -39,6 +39,8 @@
 
 #include "core/typedefs.h"
 
+class GodotBodyPair2D;
+
 class GodotPhysicsDirectSpaceState2D : public PhysicsDirectSpaceState2D {
 	GDCLASS(GodotPhysicsDirectSpaceState2D, PhysicsDirectSpaceState2D);
 
@@ -85,6 +87,7 @@ private:
 	SelfList<GodotBody2D>::List state_query_list;
 	SelfList<GodotArea2D>::List monitor_query_list;
 	SelfList<GodotArea2D>::List area_moved_list;
+	SelfList<GodotBodyPair2D>::List body_pair_list;
 
 	static void *_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_data, void *p_self);
@@ -114,6 +117,9 @@ private:
 
 	bool locked = false;
 
+	bool deterministic = false;
+	uint32_t step_checksum = 0;
+
 	real_t last_step = 0.001;
 
 	int island_count = 0;
@@ -149,6 +155,9 @@ public:
 	void area_add_to_monitor_query_list(SelfList<GodotArea2D> *p_area);
 	void area_remove_from_monitor_query_list(SelfList<GodotArea2D> *p_area);
 
+	void body_pair_add_to_list(SelfList<GodotBodyPair2D> *p_pair);
+	void body_pair_remove_from_list(SelfList<GodotBodyPair2D> *p_pair);
+
 	GodotBroadPhase2D *get_broadphase();
 
 	void add_object(GodotCollisionObject2D *p_object);
@@ -169,6 +178,10 @@ public:
 	void setup();
 	void call_queries();
 
+	// Bodies and contacts, joints and areas only keep their configuration.
+	void save_state(Vector<uint8_t> &r_state) const;
+	bool restore_state(const Vector<uint8_t> &p_state);
+
 	bool is_locked() const;
 	void lock();
 	void unlock();
@@ -179,6 +192,12 @@ public:
 	void set_param(PhysicsServer2D::SpaceParameter p_param, real_t p_value);
 	real_t get_param(PhysicsServer2D::SpaceParameter p_param) const;
 
+	void set_deterministic(bool p_enabled);
+	_FORCE_INLINE_ bool is_deterministic() const { return deterministic; }
+
+	void update_step_checksum();
+	uint32_t get_step_checksum() const { return step_checksum; }
+
 	void set_island_count(int p_island_count) { island_count = p_island_count; }
 	int get_island_count() const { return island_count; }
 
@@ -80,6 +80,41 @@ void GodotStep2D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
+void GodotStep2D::_sort_constraint_island(LocalVector<GodotConstraint2D *> &p_constraint_island) {
+	// Orders constraints by the RIDs of the bodies they connect, then by their shapes or joint RID, so the
+	// solving order depends on what is in the island rather than on the order the broadphase reported the
+	// pairs in. Body pairs are already oriented by RID when the broadphase creates them.
+	uint32_t constraint_count = p_constraint_island.size();
+	constraint_sort_keys.resize(constraint_count);
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		GodotConstraint2D *constraint = p_constraint_island[constraint_index];
+		ConstraintSortKey &key = constraint_sort_keys[constraint_index];
+		key.first_body = 0;
+		key.second_body = 0;
+		key.order_key = constraint->get_order_key();
+		key.index = constraint_index;
+		key.constraint = constraint;
+
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			uint64_t id = constraint->get_body_ptr()[i]->get_self().get_id();
+			if (i == 0) {
+				key.first_body = id;
+			} else if (id < key.first_body) {
+				key.second_body = key.first_body;
+				key.first_body = id;
+			} else {
+				key.second_body = id;
+			}
+		}
+	}
+
+	constraint_sort_keys.sort();
+
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		p_constraint_island[constraint_index] = constraint_sort_keys[constraint_index].constraint;
+	}
+}
+
 void GodotStep2D::_pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const {
 	uint32_t constraint_count = p_constraint_island.size();
 	uint32_t valid_constraint_count = 0;
@@ -234,6 +269,12 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	p_space->set_island_count((int)island_count);
 
+	if (p_space->is_deterministic()) {
+		for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+			_sort_constraint_island(constraint_islands[island_index]);
+		}
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace2D::ELAPSED_TIME_GENERATE_ISLANDS, profile_endtime - profile_begtime);
@@ -287,6 +328,10 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 		_check_suspend(body_islands[island_index]);
 	}
 
+	if (p_space->is_deterministic()) {
+		p_space->update_step_checksum();
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace2D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
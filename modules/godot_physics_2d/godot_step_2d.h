@@ -46,8 +46,31 @@ class GodotStep2D {
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
 
+	struct ConstraintSortKey {
+		uint64_t first_body = 0;
+		uint64_t second_body = 0;
+		uint64_t order_key = 0;
+		uint32_t index = 0;
+		GodotConstraint2D *constraint = nullptr;
+
+		bool operator<(const ConstraintSortKey &p_other) const {
+			if (first_body != p_other.first_body) {
+				return first_body < p_other.first_body;
+			}
+			if (second_body != p_other.second_body) {
+				return second_body < p_other.second_body;
+			}
+			if (order_key != p_other.order_key) {
+				return order_key < p_other.order_key;
+			}
+			return index < p_other.index;
+		}
+	};
+	LocalVector<ConstraintSortKey> constraint_sort_keys;
+
 	void _populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _sort_constraint_island(LocalVector<GodotConstraint2D *> &p_constraint_island);
 	void _pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
 	void _check_suspend(LocalVector<GodotBody2D *> &p_body_island) const;
@@ -666,13 +666,20 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_angular_velocity = Vector3();
 	biased_linear_velocity = Vector3();
 
-	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
-	}
+	// Shapes temporarily extend for raycast, done in integrate_forces_apply().
+	integrated_motion = motion;
+	integrated_motion_pending = do_motion;
 
 	contact_count = 0;
 }
 
+void GodotBody3D::integrate_forces_apply() {
+	if (integrated_motion_pending) {
+		integrated_motion_pending = false;
+		_update_shapes_with_motion(integrated_motion);
+	}
+}
+
 void GodotBody3D::integrate_velocities(real_t p_step) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
@@ -680,10 +687,6 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	ERR_FAIL_NULL(get_space());
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
-
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
 		if (is_axis_locked((PhysicsServer3D::BodyAxis)(1 << i))) {
@@ -703,10 +706,6 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
-		if (contacts.is_empty() && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
-		}
-
 		return;
 	}
 
@@ -733,12 +732,38 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	// Shapes are moved in the broadphase by integrate_velocities_apply().
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
+	integrated_transform_pending = true;
 
 	_update_transform_dependent();
 }
 
+void GodotBody3D::integrate_velocities_apply() {
+	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
+		return;
+	}
+
+	ERR_FAIL_NULL(get_space());
+
+	if ((fi_callback_data || body_state_callback.is_valid()) && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+		if (contacts.is_empty() && linear_velocity == Vector3() && angular_velocity == Vector3()) {
+			set_active(false); //stopped moving, deactivate
+		}
+		return;
+	}
+
+	if (integrated_transform_pending) {
+		integrated_transform_pending = false;
+		_update_shapes();
+	}
+}
+
 void GodotBody3D::wakeup_neighbours() {
 	for (const KeyValue<GodotConstraint3D *, int> &E : constraint_map) {
 		const GodotConstraint3D *c = E.key;
@@ -801,6 +826,40 @@ bool GodotBody3D::sleep_test(real_t p_step) {
 	}
 }
 
+void GodotBody3D::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.rid = get_self().get_id();
+	r_snapshot.transform = get_transform();
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.still_time = still_time;
+	r_snapshot.active = active;
+}
+
+void GodotBody3D::restore_snapshot(const Snapshot &p_snapshot) {
+	ERR_FAIL_NULL(get_space());
+
+	// Same inverses as the integration, so a resimulation matches the original step for step.
+	_set_transform(p_snapshot.transform);
+	if (mode >= PhysicsServer3D::BODY_MODE_RIGID) {
+		_set_inv_transform(get_transform().inverse());
+	} else {
+		_set_inv_transform(get_transform().affine_inverse());
+	}
+	new_transform = p_snapshot.transform;
+	_update_transform_dependent();
+
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	biased_linear_velocity = Vector3();
+	biased_angular_velocity = Vector3();
+	still_time = p_snapshot.still_time;
+	set_active(p_snapshot.active);
+
+	if ((fi_callback_data || body_state_callback.is_valid()) && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void GodotBody3D::set_state_sync_callback(const Callable &p_callable) {
 	body_state_callback = p_callable;
 }
@@ -113,6 +113,11 @@ class GodotBody3D : public GodotCollisionObject3D {
 	virtual void _shapes_changed() override;
 	Transform3D new_transform;
 
+	// Left by the integration passes for the single-threaded apply passes.
+	Vector3 integrated_motion;
+	bool integrated_motion_pending = false;
+	bool integrated_transform_pending = false;
+
 	HashMap<GodotConstraint3D *, int> constraint_map;
 
 	Vector<AreaCMP> areas;
@@ -152,6 +157,19 @@ class GodotBody3D : public GodotCollisionObject3D {
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
 public:
+	// Simulated state saved in space snapshots, forces and everything else set through the server are left alone.
+	struct Snapshot {
+		uint64_t rid = 0;
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		real_t still_time = 0.0;
+		bool active = false;
+	};
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
 	void set_state_sync_callback(const Callable &p_callable);
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
@@ -318,8 +336,12 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
+	// Integration only touches this body and can run on worker threads. The matching
+	// apply call must follow on a single thread, it updates the broadphase and space lists.
 	void integrate_forces(real_t p_step);
+	void integrate_forces_apply();
 	void integrate_velocities(real_t p_step);
+	void integrate_velocities_apply();
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
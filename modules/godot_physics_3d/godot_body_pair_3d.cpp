@@ -51,7 +51,9 @@ void GodotBodyPair3D::contact_added_callback(const Vector3 &p_point_A, int p_ind
 
 	ERR_FAIL_COND(new_index >= (MAX_CONTACTS + 1));
 
+	// Contacts are saved as is in snapshots, so their padding is kept zeroed.
 	Contact contact;
+	memset(&contact, 0, sizeof(Contact));
 	contact.index_A = p_index_A;
 	contact.index_B = p_index_B;
 	contact.local_A = local_A;
@@ -597,8 +599,51 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+GodotBodyPair3D::SnapshotHeader GodotBodyPair3D::get_snapshot_header() const {
+	// Zeroed first, so the padding is too and equal states save to equal bytes.
+	SnapshotHeader header;
+	memset(&header, 0, sizeof(SnapshotHeader));
+	header.body_A = A->get_self().get_id();
+	header.body_B = B->get_self().get_id();
+	header.shape_A = shape_A;
+	header.shape_B = shape_B;
+	header.sep_axis = sep_axis;
+	header.contact_count = contact_count;
+	header.collided = collided;
+	return header;
+}
+
+int GodotBodyPair3D::save_snapshot(uint8_t *r_buffer) const {
+	const SnapshotHeader header = get_snapshot_header();
+
+	if (r_buffer) {
+		memcpy(r_buffer, &header, sizeof(SnapshotHeader));
+		memcpy(r_buffer + sizeof(SnapshotHeader), contacts, contact_count * sizeof(Contact));
+	}
+
+	return get_snapshot_size(header);
+}
+
+void GodotBodyPair3D::restore_snapshot(const uint8_t *p_buffer) {
+	SnapshotHeader header;
+	memcpy(&header, p_buffer, sizeof(SnapshotHeader));
+
+	sep_axis = header.sep_axis;
+	collided = header.collided;
+	contact_count = CLAMP(header.contact_count, 0, (int)MAX_CONTACTS);
+	memcpy(contacts, p_buffer + sizeof(SnapshotHeader), contact_count * sizeof(Contact));
+}
+
+void GodotBodyPair3D::clear_contacts() {
+	sep_axis = Vector3();
+	collided = false;
+	contact_count = 0;
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
-		GodotBodyContact3D(_arr, 2) {
+		GodotBodyContact3D(_arr, 2),
+		pair_list(this) {
+	memset(contacts, 0, sizeof(contacts));
 	A = p_A;
 	B = p_B;
 	shape_A = p_shape_A;
@@ -606,11 +651,13 @@ GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p
 	space = A->get_space();
 	A->add_constraint(this, 0);
 	B->add_constraint(this, 1);
+	space->body_pair_add_to_list(&pair_list);
 }
 
 GodotBodyPair3D::~GodotBodyPair3D() {
 	A->remove_constraint(this);
 	B->remove_constraint(this);
+	space->body_pair_remove_from_list(&pair_list);
 }
 
 void GodotBodySoftBodyPair3D::_contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata) {
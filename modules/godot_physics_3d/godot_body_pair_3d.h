@@ -98,6 +98,8 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	SelfList<GodotBodyPair3D> pair_list;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
@@ -106,6 +108,26 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
+	// Warm-start state saved in space snapshots, followed by `contact_count` contacts.
+	struct SnapshotHeader {
+		uint64_t body_A = 0;
+		uint64_t body_B = 0;
+		int32_t shape_A = 0;
+		int32_t shape_B = 0;
+		Vector3 sep_axis;
+		int32_t contact_count = 0;
+		bool collided = false;
+	};
+
+	static int get_snapshot_size(const SnapshotHeader &p_header) { return sizeof(SnapshotHeader) + p_header.contact_count * sizeof(Contact); }
+
+	SnapshotHeader get_snapshot_header() const;
+
+	// Returns the size of the snapshot, only writes it if `r_buffer` isn't null.
+	int save_snapshot(uint8_t *r_buffer) const;
+	void restore_snapshot(const uint8_t *p_buffer);
+	void clear_contacts();
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
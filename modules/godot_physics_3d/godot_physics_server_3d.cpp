@@ -40,7 +40,9 @@
 #include "joints/godot_pin_joint_3d.h"
 #include "joints/godot_slider_joint_3d.h"
 
+#include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #define FLUSH_QUERY_CHECK(m_object) \
@@ -190,6 +192,27 @@ real_t GodotPhysicsServer3D::space_get_param(RID p_space, SpaceParameter p_param
 	return space->get_param(p_param);
 }
 
+PackedByteArray GodotPhysicsServer3D::space_save_state(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Space state can't be saved while the space is being stepped.");
+
+	PackedByteArray state;
+	space->save_state(state);
+	return state;
+}
+
+bool GodotPhysicsServer3D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	ERR_FAIL_COND_V_MSG(space->is_locked() || flushing_queries, false, "Space state can't be restored while the space is being stepped or flushing queries.");
+
+	// The broadphase is updated by the restore, so it has to see the latest shapes.
+	_update_shapes();
+
+	return space->restore_state(p_state);
+}
+
 PhysicsDirectSpaceState3D *GodotPhysicsServer3D::space_get_direct_state(RID p_space) {
 	GodotSpace3D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
@@ -1628,6 +1651,11 @@ void GodotPhysicsServer3D::set_active(bool p_active) {
 
 void GodotPhysicsServer3D::init() {
 	stepper = memnew(GodotStep3D);
+	step_spaces_in_parallel = GLOBAL_GET("physics/3d/step_spaces_in_parallel");
+}
+
+void GodotPhysicsServer3D::_step_space(uint32_t p_index, void *p_userdata) {
+	parallel_steppers[p_index]->step(parallel_step_spaces[p_index], parallel_step_delta);
 }
 
 void GodotPhysicsServer3D::step(real_t p_step) {
@@ -1640,8 +1668,31 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
-	for (GodotSpace3D *E : active_spaces) {
-		stepper->step(E, p_step);
+
+	if (step_spaces_in_parallel && active_spaces.size() > 1) {
+		// Spaces share no bodies or broadphase, so each one gets its own stepper on a worker thread.
+		// The stages within a space run serially there, query callbacks are still flushed per space on the main thread.
+		for (GodotSpace3D *E : active_spaces) {
+			parallel_step_spaces.push_back(E);
+		}
+		while (parallel_steppers.size() < parallel_step_spaces.size()) {
+			GodotStep3D *space_stepper = memnew(GodotStep3D);
+			space_stepper->set_use_threads(false);
+			parallel_steppers.push_back(space_stepper);
+		}
+		parallel_step_delta = p_step;
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsServer3D::_step_space, nullptr, parallel_step_spaces.size(), -1, true, SNAME("Physics3DStepSpaces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		parallel_step_spaces.clear();
+	} else {
+		for (GodotSpace3D *E : active_spaces) {
+			stepper->step(E, p_step);
+		}
+	}
+
+	for (const GodotSpace3D *E : active_spaces) {
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
@@ -1708,6 +1759,10 @@ void GodotPhysicsServer3D::end_sync() {
 
 void GodotPhysicsServer3D::finish() {
 	memdelete(stepper);
+	for (GodotStep3D *space_stepper : parallel_steppers) {
+		memdelete(space_stepper);
+	}
+	parallel_steppers.clear();
 }
 
 int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
@@ -1721,6 +1776,12 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_BROAD_PHASE_TIME:
+		case INFO_NARROW_PHASE_TIME:
+		case INFO_SOLVER_TIME:
+		case INFO_TEMP_MEMORY_PEAK: {
+			// Per-stage timings are only collected by the profiler here.
+		} break;
 	}
 
 	return 0;
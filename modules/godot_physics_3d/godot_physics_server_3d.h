@@ -57,6 +57,13 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	GodotStep3D *stepper = nullptr;
 	HashSet<GodotSpace3D *> active_spaces;
 
+	bool step_spaces_in_parallel = false;
+	real_t parallel_step_delta = 0.0;
+	LocalVector<GodotSpace3D *> parallel_step_spaces;
+	LocalVector<GodotStep3D *> parallel_steppers;
+
+	void _step_space(uint32_t p_index, void *p_userdata = nullptr);
+
 	mutable RID_PtrOwner<GodotShape3D, true> shape_owner;
 	mutable RID_PtrOwner<GodotSpace3D, true> space_owner;
 	mutable RID_PtrOwner<GodotArea3D, true> area_owner;
@@ -111,6 +118,9 @@ public:
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) override;
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const override;
 
+	virtual PackedByteArray space_save_state(RID p_space) const override;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override;
+
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
 
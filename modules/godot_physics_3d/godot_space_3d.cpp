@@ -36,9 +36,46 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
+namespace {
+
+struct StateHeader {
+	uint32_t magic = 0x33535047; // "GPS3"
+	uint32_t real_size = sizeof(real_t);
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+};
+
+struct BodyPairKey {
+	uint64_t body_A = 0;
+	uint64_t body_B = 0;
+	int32_t shape_A = 0;
+	int32_t shape_B = 0;
+
+	static uint32_t hash(const BodyPairKey &p_key) {
+		uint32_t h = hash_murmur3_one_64(p_key.body_A);
+		h = hash_murmur3_one_64(p_key.body_B, h);
+		h = hash_murmur3_one_32(p_key.shape_A, h);
+		h = hash_murmur3_one_32(p_key.shape_B, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const BodyPairKey &p_other) const {
+		return body_A == p_other.body_A && body_B == p_other.body_B && shape_A == p_other.shape_A && shape_B == p_other.shape_B;
+	}
+
+	explicit BodyPairKey(const GodotBodyPair3D::SnapshotHeader &p_header) :
+			body_A(p_header.body_A),
+			body_B(p_header.body_B),
+			shape_A(p_header.shape_A),
+			shape_B(p_header.shape_B) {}
+};
+
+} // namespace
+
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
@@ -109,16 +146,8 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V(space->locked, false);
-
-	Vector3 begin, end;
-	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
-	normal = (end - begin).normalized();
-
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+static bool _intersect_ray_culled(const PhysicsDirectSpaceState3D::RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_cull_results, const int *p_cull_subindex_results, int p_amount, PhysicsDirectSpaceState3D::RayResult &r_result) {
+	Vector3 normal = (p_to - p_from).normalized();
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -129,26 +158,26 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_cull_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_cull_results[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_cull_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_cull_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_cull_subindex_results[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
-		Vector3 local_from = inv_xform.xform(begin);
-		Vector3 local_to = inv_xform.xform(end);
+		Vector3 local_from = inv_xform.xform(p_from);
+		Vector3 local_to = inv_xform.xform(p_to);
 
 		const GodotShape3D *shape = col_obj->get_shape(shape_idx);
 
@@ -159,7 +188,7 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 			if (p_parameters.hit_from_inside) {
 				// Hit shape at starting point.
 				min_d = 0;
-				res_point = begin;
+				res_point = p_from;
 				res_normal = Vector3();
 				res_shape = shape_idx;
 				res_obj = col_obj;
@@ -209,6 +238,64 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
+bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V(space->locked, false);
+
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	return _intersect_ray_culled(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
+
+void GodotPhysicsDirectSpaceState3D::_append_batch_cull_results(int p_amount) {
+	for (int i = 0; i < p_amount; i++) {
+		batch_cull_results.push_back(space->intersection_query_results[i]);
+		batch_cull_subindex_results.push_back(space->intersection_query_subindex_results[i]);
+	}
+	batch_cull_offsets.push_back(batch_cull_results.size());
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_rays_task(uint32_t p_index, void *p_userdata) {
+	const uint32_t offset = batch_cull_offsets[p_index];
+	const int amount = batch_cull_offsets[p_index + 1] - offset;
+	RayResult &result = ray_batch.results[p_index];
+	result = RayResult();
+	_intersect_ray_culled(*ray_batch.parameters, ray_batch.from[p_index], ray_batch.to[p_index], batch_cull_results.ptr() + offset, batch_cull_subindex_results.ptr() + offset, amount, result);
+}
+
+int GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results) {
+	ERR_FAIL_COND_V(space->locked, 0);
+	if (p_count <= 0) {
+		return 0;
+	}
+
+	// The BVH cull is not reentrant, so the broadphase runs here and only the narrowphase is threaded.
+	batch_cull_results.clear();
+	batch_cull_subindex_results.clear();
+	batch_cull_offsets.clear();
+	batch_cull_offsets.push_back(0);
+	for (int i = 0; i < p_count; i++) {
+		int amount = space->broadphase->cull_segment(p_from[i], p_to[i], space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+		_append_batch_cull_results(amount);
+	}
+
+	ray_batch.parameters = &p_parameters;
+	ray_batch.from = p_from;
+	ray_batch.to = p_to;
+	ray_batch.results = r_results;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_rays_task, nullptr, p_count, -1, true, SNAME("Physics3DIntersectRays"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	ray_batch = RayBatch();
+
+	int hit_count = 0;
+	for (int i = 0; i < p_count; i++) {
+		if (r_results[i].rid.is_valid()) {
+			hit_count++;
+		}
+	}
+	return hit_count;
+}
+
 int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -264,55 +351,52 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
-	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
-	ERR_FAIL_NULL_V(shape, false);
-
-	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
-	aabb = aabb.merge(AABB(aabb.position + p_parameters.motion, aabb.size)); //motion
-	aabb = aabb.grow(p_parameters.margin);
-
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+static AABB _cast_motion_aabb(GodotShape3D *p_shape, const Transform3D &p_transform, const Vector3 &p_motion, real_t p_margin) {
+	AABB aabb = p_transform.xform(p_shape->get_aabb());
+	aabb = aabb.merge(AABB(aabb.position + p_motion, aabb.size)); //motion
+	return aabb.grow(p_margin);
+}
 
+static void _cast_motion_culled(GodotShape3D *p_shape, const PhysicsDirectSpaceState3D::ShapeParameters &p_parameters, const Transform3D &p_transform, const Vector3 &p_motion, const AABB &p_aabb, GodotCollisionObject3D *const *p_cull_results, const int *p_cull_subindex_results, int p_amount, real_t &p_closest_safe, real_t &p_closest_unsafe, PhysicsDirectSpaceState3D::ShapeRestInfo *r_info) {
 	real_t best_safe = 1;
 	real_t best_unsafe = 1;
 
-	Transform3D xform_inv = p_parameters.transform.affine_inverse();
+	Transform3D xform_inv = p_transform.affine_inverse();
 	GodotMotionShape3D mshape;
-	mshape.shape = shape;
-	mshape.motion = xform_inv.basis.xform(p_parameters.motion);
+	mshape.shape = p_shape;
+	mshape.motion = xform_inv.basis.xform(p_motion);
 
 	bool best_first = true;
 
-	Vector3 motion_normal = p_parameters.motion.normalized();
+	Vector3 motion_normal = p_motion.normalized();
 
 	Vector3 closest_A, closest_B;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_cull_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_cull_results[i]->get_self())) {
 			continue; //ignore excluded
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = p_cull_results[i];
+		int shape_idx = p_cull_subindex_results[i];
 
 		Vector3 point_A, point_B;
 		Vector3 sep_axis = motion_normal;
 
 		Transform3D col_obj_xform = col_obj->get_transform() * col_obj->get_shape_transform(shape_idx);
 		//test initial overlap, does it collide if going all the way?
-		if (GodotCollisionSolver3D::solve_distance(&mshape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
+		if (GodotCollisionSolver3D::solve_distance(&mshape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, p_aabb, &sep_axis)) {
 			continue;
 		}
 
 		//test initial overlap, ignore objects it's inside of.
 		sep_axis = motion_normal;
 
-		if (!GodotCollisionSolver3D::solve_distance(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
+		if (!GodotCollisionSolver3D::solve_distance(p_shape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, p_aabb, &sep_axis)) {
 			continue;
 		}
 
@@ -323,11 +407,11 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 		for (int j = 0; j < 8; j++) { //steps should be customizable..
 			real_t fraction = low + (hi - low) * fraction_coeff;
 
-			mshape.motion = xform_inv.basis.xform(p_parameters.motion * fraction);
+			mshape.motion = xform_inv.basis.xform(p_motion * fraction);
 
 			Vector3 lA, lB;
 			Vector3 sep = motion_normal; //important optimization for this to work fast enough
-			bool collided = !GodotCollisionSolver3D::solve_distance(&mshape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, lA, lB, aabb, &sep);
+			bool collided = !GodotCollisionSolver3D::solve_distance(&mshape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, lA, lB, p_aabb, &sep);
 
 			if (collided) {
 				hi = fraction;
@@ -379,6 +463,60 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 
 	p_closest_safe = best_safe;
 	p_closest_unsafe = best_unsafe;
+}
+
+bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, false);
+
+	AABB aabb = _cast_motion_aabb(shape, p_parameters.transform, p_parameters.motion, p_parameters.margin);
+
+	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	_cast_motion_culled(shape, p_parameters, p_parameters.transform, p_parameters.motion, aabb, space->intersection_query_results, space->intersection_query_subindex_results, amount, p_closest_safe, p_closest_unsafe, r_info);
+
+	return true;
+}
+
+void GodotPhysicsDirectSpaceState3D::_cast_motions_task(uint32_t p_index, void *p_userdata) {
+	const uint32_t offset = batch_cull_offsets[p_index];
+	const int amount = batch_cull_offsets[p_index + 1] - offset;
+	Transform3D transform = motion_batch.parameters->transform;
+	transform.origin = motion_batch.origins[p_index];
+	const Vector3 &motion = motion_batch.motions[p_index];
+	const AABB aabb = _cast_motion_aabb(motion_batch.shape, transform, motion, motion_batch.parameters->margin);
+	_cast_motion_culled(motion_batch.shape, *motion_batch.parameters, transform, motion, aabb, batch_cull_results.ptr() + offset, batch_cull_subindex_results.ptr() + offset, amount, motion_batch.closest_safe[p_index], motion_batch.closest_unsafe[p_index], nullptr);
+}
+
+bool GodotPhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, false);
+	if (p_count <= 0) {
+		return true;
+	}
+
+	batch_cull_results.clear();
+	batch_cull_subindex_results.clear();
+	batch_cull_offsets.clear();
+	batch_cull_offsets.push_back(0);
+	Transform3D transform = p_parameters.transform;
+	for (int i = 0; i < p_count; i++) {
+		transform.origin = p_origins[i];
+		AABB aabb = _cast_motion_aabb(shape, transform, p_motions[i], p_parameters.margin);
+		int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+		_append_batch_cull_results(amount);
+	}
+
+	motion_batch.parameters = &p_parameters;
+	motion_batch.shape = shape;
+	motion_batch.origins = p_origins;
+	motion_batch.motions = p_motions;
+	motion_batch.closest_safe = r_closest_safe;
+	motion_batch.closest_unsafe = r_closest_unsafe;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_cast_motions_task, nullptr, p_count, -1, true, SNAME("Physics3DCastMotions"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	motion_batch = MotionBatch();
 
 	return true;
 }
@@ -1066,6 +1204,11 @@ void *GodotSpace3D::_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A
 			GodotBodySoftBodyPair3D *soft_pair = memnew(GodotBodySoftBodyPair3D(static_cast<GodotBody3D *>(A), p_subindex_A, static_cast<GodotSoftBody3D *>(B)));
 			return soft_pair;
 		} else {
+			// The broadphase reports the moving object first, ordering by RID keeps pairs recognizable for state restores.
+			if (B->get_self() < A->get_self()) {
+				SWAP(A, B);
+				SWAP(p_subindex_A, p_subindex_B);
+			}
 			GodotBodyPair3D *b = memnew(GodotBodyPair3D(static_cast<GodotBody3D *>(A), p_subindex_A, static_cast<GodotBody3D *>(B), p_subindex_B));
 			return b;
 		}
@@ -1107,6 +1250,14 @@ void GodotSpace3D::body_remove_from_mass_properties_update_list(SelfList<GodotBo
 	mass_properties_update_list.remove(p_body);
 }
 
+void GodotSpace3D::body_pair_add_to_list(SelfList<GodotBodyPair3D> *p_pair) {
+	body_pair_list.add(p_pair);
+}
+
+void GodotSpace3D::body_pair_remove_from_list(SelfList<GodotBodyPair3D> *p_pair) {
+	body_pair_list.remove(p_pair);
+}
+
 GodotBroadPhase3D *GodotSpace3D::get_broadphase() {
 	return broadphase;
 }
@@ -1191,6 +1342,115 @@ void GodotSpace3D::update() {
 	broadphase->update();
 }
 
+void GodotSpace3D::save_state(Vector<uint8_t> &r_state) const {
+	StateHeader header;
+
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			header.body_count++;
+		}
+	}
+
+	int pairs_size = 0;
+	for (const SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		header.pair_count++;
+		pairs_size += E->self()->save_snapshot(nullptr);
+	}
+
+	r_state.resize(sizeof(StateHeader) + header.body_count * sizeof(GodotBody3D::Snapshot) + pairs_size);
+	uint8_t *w = r_state.ptrw();
+
+	memcpy(w, &header, sizeof(StateHeader));
+	w += sizeof(StateHeader);
+
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			// Zeroed first, so the padding is too and equal states save to equal bytes.
+			GodotBody3D::Snapshot snapshot;
+			memset(&snapshot, 0, sizeof(GodotBody3D::Snapshot));
+			static_cast<const GodotBody3D *>(E)->save_snapshot(snapshot);
+			memcpy(w, &snapshot, sizeof(GodotBody3D::Snapshot));
+			w += sizeof(GodotBody3D::Snapshot);
+		}
+	}
+
+	for (const SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		w += E->self()->save_snapshot(w);
+	}
+}
+
+bool GodotSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	ERR_FAIL_COND_V_MSG(p_state.size() < (int)sizeof(StateHeader), false, "Invalid physics space state.");
+
+	const uint8_t *r = p_state.ptr();
+	const uint8_t *end = r + p_state.size();
+
+	StateHeader header;
+	memcpy(&header, r, sizeof(StateHeader));
+	r += sizeof(StateHeader);
+
+	ERR_FAIL_COND_V_MSG(header.magic != StateHeader().magic || header.real_size != sizeof(real_t), false, "Physics space state was saved by a different physics engine or build.");
+	ERR_FAIL_COND_V_MSG(uint64_t(end - r) < uint64_t(header.body_count) * sizeof(GodotBody3D::Snapshot), false, "Invalid physics space state.");
+
+	HashMap<uint64_t, GodotBody3D *> bodies_by_rid;
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies_by_rid.insert(E->get_self().get_id(), static_cast<GodotBody3D *>(E));
+		}
+	}
+
+	// Everything is validated before the first body is touched, so a failed restore leaves the space as it was.
+	LocalVector<GodotBody3D::Snapshot> snapshots;
+	LocalVector<GodotBody3D *> bodies;
+	snapshots.resize(header.body_count);
+	bodies.resize(header.body_count);
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		memcpy(&snapshots[i], r, sizeof(GodotBody3D::Snapshot));
+		r += sizeof(GodotBody3D::Snapshot);
+
+		GodotBody3D **body = bodies_by_rid.getptr(snapshots[i].rid);
+		ERR_FAIL_NULL_V_MSG(body, false, "Physics space state refers to a body that is no longer in the space.");
+		bodies[i] = *body;
+	}
+
+	const uint8_t *pairs = r;
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		GodotBodyPair3D::SnapshotHeader pair_header;
+		ERR_FAIL_COND_V_MSG(end - r < (int)sizeof(GodotBodyPair3D::SnapshotHeader), false, "Invalid physics space state.");
+		memcpy(&pair_header, r, sizeof(GodotBodyPair3D::SnapshotHeader));
+		ERR_FAIL_COND_V_MSG(pair_header.contact_count < 0 || end - r < GodotBodyPair3D::get_snapshot_size(pair_header), false, "Invalid physics space state.");
+		r += GodotBodyPair3D::get_snapshot_size(pair_header);
+	}
+
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		bodies[i]->restore_snapshot(snapshots[i]);
+	}
+
+	// Brings the pairs in line with the restored transforms, the contacts of pairs that existed are then put back.
+	broadphase->update();
+
+	HashMap<BodyPairKey, GodotBodyPair3D *, BodyPairKey> pairs_by_key;
+	for (SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		GodotBodyPair3D *pair = E->self();
+		pair->clear_contacts();
+		pairs_by_key.insert(BodyPairKey(pair->get_snapshot_header()), pair);
+	}
+
+	r = pairs;
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		GodotBodyPair3D::SnapshotHeader pair_header;
+		memcpy(&pair_header, r, sizeof(GodotBodyPair3D::SnapshotHeader));
+
+		GodotBodyPair3D **pair = pairs_by_key.getptr(BodyPairKey(pair_header));
+		if (pair) {
+			(*pair)->restore_snapshot(r);
+		}
+		r += GodotBodyPair3D::get_snapshot_size(pair_header);
+	}
+
+	return true;
+}
+
 void GodotSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_value) {
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS:
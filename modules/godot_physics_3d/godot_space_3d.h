@@ -40,9 +40,40 @@
 
 #include "core/typedefs.h"
 
+class GodotBodyPair3D;
+
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		RayResult *results = nullptr;
+	};
+
+	struct MotionBatch {
+		const ShapeParameters *parameters = nullptr;
+		GodotShape3D *shape = nullptr;
+		const Vector3 *origins = nullptr;
+		const Vector3 *motions = nullptr;
+		real_t *closest_safe = nullptr;
+		real_t *closest_unsafe = nullptr;
+	};
+
+	// Broadphase candidates of every query in a batch, query i owns
+	// [batch_cull_offsets[i], batch_cull_offsets[i + 1]).
+	LocalVector<GodotCollisionObject3D *> batch_cull_results;
+	LocalVector<int> batch_cull_subindex_results;
+	LocalVector<uint32_t> batch_cull_offsets;
+
+	RayBatch ray_batch;
+	MotionBatch motion_batch;
+
+	void _append_batch_cull_results(int p_amount);
+	void _intersect_rays_task(uint32_t p_index, void *p_userdata = nullptr);
+	void _cast_motions_task(uint32_t p_index, void *p_userdata = nullptr);
+
 public:
 	GodotSpace3D *space = nullptr;
 
@@ -54,6 +85,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
 
+	virtual int intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results) override;
+	virtual bool cast_motions(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override;
+
 	GodotPhysicsDirectSpaceState3D();
 };
 
@@ -82,6 +116,7 @@ private:
 	SelfList<GodotArea3D>::List monitor_query_list;
 	SelfList<GodotArea3D>::List area_moved_list;
 	SelfList<GodotSoftBody3D>::List active_soft_body_list;
+	SelfList<GodotBodyPair3D>::List body_pair_list;
 
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
@@ -151,6 +186,9 @@ public:
 	void soft_body_add_to_active_list(SelfList<GodotSoftBody3D> *p_soft_body);
 	void soft_body_remove_from_active_list(SelfList<GodotSoftBody3D> *p_soft_body);
 
+	void body_pair_add_to_list(SelfList<GodotBodyPair3D> *p_pair);
+	void body_pair_remove_from_list(SelfList<GodotBodyPair3D> *p_pair);
+
 	GodotBroadPhase3D *get_broadphase();
 
 	void add_object(GodotCollisionObject3D *p_object);
@@ -170,6 +208,10 @@ public:
 	void setup();
 	void call_queries();
 
+	// Bodies and contacts, joints and areas only keep their configuration.
+	void save_state(Vector<uint8_t> &r_state) const;
+	bool restore_state(const Vector<uint8_t> &p_state);
+
 	bool is_locked() const;
 	void lock();
 	void unlock();
@@ -42,6 +42,9 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define ACTIVE_BODY_COUNT_RESERVE 1024
+
+SafeNumeric<uint64_t> GodotStep3D::step_counter;
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -114,6 +117,23 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
+void GodotStep3D::_populate_active_bodies(const SelfList<GodotBody3D>::List *p_body_list) {
+	active_bodies.clear();
+	const SelfList<GodotBody3D> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+}
+
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
 void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -184,7 +204,21 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 	}
 }
 
+void GodotStep3D::_run_group(void (GodotStep3D::*p_method)(uint32_t, void *), uint32_t p_count, const StringName &p_name) {
+	if (!use_threads) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			(this->*p_method)(i, nullptr);
+		}
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, nullptr, p_count, -1, true, p_name);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
+	_step = step_counter.increment();
+
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
@@ -203,15 +237,19 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	// Bodies are integrated independently, so the result doesn't depend on the thread count.
+	// The broadphase isn't thread-safe, shapes are moved afterwards in list order.
+	_populate_active_bodies(body_list);
+	uint32_t active_body_count = active_bodies.size();
 
-	const SelfList<GodotBody3D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	_run_group(&GodotStep3D::_integrate_forces, active_body_count, SNAME("Physics3DIntegrateForces"));
+
+	for (uint32_t body_index = 0; body_index < active_body_count; ++body_index) {
+		active_bodies[body_index]->integrate_forces_apply();
 	}
 
+	int active_count = active_body_count;
+
 	/* UPDATE SOFT BODY MOTION */
 
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
@@ -262,7 +300,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	const SelfList<GodotBody3D> *b = body_list->first();
 
 	uint32_t body_island_count = 0;
 
@@ -346,8 +384,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	_run_group(&GodotStep3D::_setup_constraint, total_constraint_count, SNAME("Physics3DConstraintSetup"));
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -366,8 +403,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	_run_group(&GodotStep3D::_solve_island, island_count, SNAME("Physics3DConstraintSolveIslands"));
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -377,11 +413,15 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+	// Solving may have woken up bodies, so the list is gathered again.
+	_populate_active_bodies(body_list);
+	active_body_count = active_bodies.size();
+
+	_run_group(&GodotStep3D::_integrate_velocities, active_body_count, SNAME("Physics3DIntegrateVelocities"));
+
+	// May deactivate kinematic bodies, which removes them from the active list.
+	for (uint32_t body_index = 0; body_index < active_body_count; ++body_index) {
+		active_bodies[body_index]->integrate_velocities_apply();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -405,15 +445,16 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	}
 
 	all_constraints.clear();
+	active_bodies.clear();
 
 	p_space->unlock();
-	_step++;
 }
 
 GodotStep3D::GodotStep3D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+	active_bodies.reserve(ACTIVE_BODY_COUNT_RESERVE);
 }
 
 GodotStep3D::~GodotStep3D() {
@@ -35,9 +35,15 @@
 #include "godot_space_3d.h"
 
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 class GodotStep3D {
-	uint64_t _step = 1;
+	// Island markers are compared against this, so it must be unique across all steppers.
+	static SafeNumeric<uint64_t> step_counter;
+	uint64_t _step = 0;
+
+	// Disabled when the stepper itself runs on a worker thread, nested group tasks can starve the pool.
+	bool use_threads = true;
 
 	int iterations = 0;
 	real_t delta = 0.0;
@@ -45,15 +51,21 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<GodotBody3D *> active_bodies;
 
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _populate_active_bodies(const SelfList<GodotBody3D>::List *p_body_list);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	void _run_group(void (GodotStep3D::*p_method)(uint32_t, void *), uint32_t p_count, const StringName &p_name);
 
 public:
+	void set_use_threads(bool p_use_threads) { use_threads = p_use_threads; }
 	void step(GodotSpace3D *p_space, real_t p_delta);
 	GodotStep3D();
 	~GodotStep3D();
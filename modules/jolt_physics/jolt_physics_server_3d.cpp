@@ -55,6 +55,9 @@
 #include "spaces/jolt_physics_direct_space_state_3d.h"
 #include "spaces/jolt_space_3d.h"
 
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+
 JoltPhysicsServer3D::JoltPhysicsServer3D(bool p_on_separate_thread) :
 		on_separate_thread(p_on_separate_thread) {
 	singleton = this;
@@ -230,6 +233,24 @@ real_t JoltPhysicsServer3D::space_get_param(RID p_space, SpaceParameter p_param)
 	return (real_t)space->get_param(p_param);
 }
 
+PackedByteArray JoltPhysicsServer3D::space_save_state(RID p_space) const {
+	const JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), PackedByteArray(), "Space state can't be saved while the space is being stepped.");
+
+	PackedByteArray state;
+	space->save_state(state);
+	return state;
+}
+
+bool JoltPhysicsServer3D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	ERR_FAIL_COND_V_MSG(space->is_stepping() || flushing_queries, false, "Space state can't be restored while the space is being stepped or flushing queries.");
+
+	return space->restore_state(p_state);
+}
+
 PhysicsDirectSpaceState3D *JoltPhysicsServer3D::space_get_direct_state(RID p_space) {
 	JoltSpace3D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
@@ -1562,8 +1583,13 @@ void JoltPhysicsServer3D::set_active(bool p_active) {
 	active = p_active;
 }
 
+void JoltPhysicsServer3D::_step_space(uint32_t p_index, void *p_userdata) {
+	parallel_step_spaces[p_index]->step_simulation();
+}
+
 void JoltPhysicsServer3D::init() {
 	job_system = new JoltJobSystem();
+	step_spaces_in_parallel = GLOBAL_GET("physics/3d/step_spaces_in_parallel");
 }
 
 void JoltPhysicsServer3D::finish() {
@@ -1578,13 +1604,47 @@ void JoltPhysicsServer3D::step(real_t p_step) {
 		return;
 	}
 
-	for (JoltSpace3D *active_space : active_spaces) {
+	job_system->reset_stage_times();
+	temp_memory_peak = 0;
+
+	if (step_spaces_in_parallel && active_spaces.size() > 1) {
+		// Syncing bodies and shapes before and after the update touches state that can be shared between spaces,
+		// such as shapes, so only the simulation itself runs concurrently. The update's own jobs all go through
+		// the one job system, and a space waiting on its barrier runs its own jobs, so pool threads can't starve it.
 		job_system->pre_step();
 
-		active_space->step((float)p_step);
+		for (JoltSpace3D *active_space : active_spaces) {
+			active_space->begin_step((float)p_step);
+			parallel_step_spaces.push_back(active_space);
+		}
+
+		const int task_count = MIN((int)parallel_step_spaces.size(), JoltJobSystem::MAX_CONCURRENT_STEPS);
+		const WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsServer3D::_step_space, nullptr, parallel_step_spaces.size(), task_count, true, SNAME("JoltPhysicsStepSpaces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (JoltSpace3D *active_space : parallel_step_spaces) {
+			active_space->end_step();
+			temp_memory_peak = MAX(temp_memory_peak, active_space->get_temp_memory_peak());
+		}
+
+		parallel_step_spaces.clear();
 
 		job_system->post_step();
+	} else {
+		for (JoltSpace3D *active_space : active_spaces) {
+			job_system->pre_step();
+
+			active_space->step((float)p_step);
+
+			job_system->post_step();
+
+			temp_memory_peak = MAX(temp_memory_peak, active_space->get_temp_memory_peak());
+		}
 	}
+
+	broad_phase_usec = job_system->get_stage_time_usec(JoltJobSystem::STAGE_BROAD_PHASE);
+	narrow_phase_usec = job_system->get_stage_time_usec(JoltJobSystem::STAGE_NARROW_PHASE);
+	solver_usec = job_system->get_stage_time_usec(JoltJobSystem::STAGE_SOLVER);
 }
 
 void JoltPhysicsServer3D::sync() {
@@ -1618,6 +1678,24 @@ bool JoltPhysicsServer3D::is_flushing_queries() const {
 }
 
 int JoltPhysicsServer3D::get_process_info(ProcessInfo p_process_info) {
+	switch (p_process_info) {
+		case INFO_BROAD_PHASE_TIME: {
+			return (int)broad_phase_usec;
+		} break;
+		case INFO_NARROW_PHASE_TIME: {
+			return (int)narrow_phase_usec;
+		} break;
+		case INFO_SOLVER_TIME: {
+			return (int)solver_usec;
+		} break;
+		case INFO_TEMP_MEMORY_PEAK: {
+			return (int)MIN(temp_memory_peak, (uint64_t)INT32_MAX);
+		} break;
+		default: {
+			// Not tracked.
+		} break;
+	}
+
 	return 0;
 }
 
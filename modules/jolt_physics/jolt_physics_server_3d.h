@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "servers/physics_server_3d.h"
 
@@ -56,14 +57,24 @@ class JoltPhysicsServer3D final : public PhysicsServer3D {
 	mutable RID_PtrOwner<JoltJoint3D, true> joint_owner;
 
 	HashSet<JoltSpace3D *> active_spaces;
+	LocalVector<JoltSpace3D *> parallel_step_spaces;
 
 	JoltJobSystem *job_system = nullptr;
 
+	// Stats of the last step, for `get_process_info`.
+	uint64_t broad_phase_usec = 0;
+	uint64_t narrow_phase_usec = 0;
+	uint64_t solver_usec = 0;
+	uint64_t temp_memory_peak = 0;
+
 	bool on_separate_thread = false;
+	bool step_spaces_in_parallel = false;
 	bool active = true;
 	bool flushing_queries = false;
 	bool doing_sync = false;
 
+	void _step_space(uint32_t p_index, void *p_userdata = nullptr);
+
 public:
 	enum HingeJointParamJolt {
 		HINGE_JOINT_LIMIT_SPRING_FREQUENCY = 100,
@@ -158,6 +169,9 @@ public:
 	virtual void space_set_param(RID p_space, PhysicsServer3D::SpaceParameter p_param, real_t p_value) override;
 	virtual real_t space_get_param(RID p_space, PhysicsServer3D::SpaceParameter p_param) const override;
 
+	virtual PackedByteArray space_save_state(RID p_space) const override;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override;
+
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
@@ -1187,6 +1187,12 @@ void JoltBody3D::remove_joint(JoltJoint3D *p_joint) {
 	_joints_changed();
 }
 
+void JoltBody3D::state_restored() {
+	if (_should_call_queries()) {
+		_enqueue_call_queries();
+	}
+}
+
 void JoltBody3D::call_queries() {
 	if (custom_integration_callback.is_valid()) {
 		const Variant direct_state_variant = get_direct_state();
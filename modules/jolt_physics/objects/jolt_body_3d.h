@@ -245,6 +245,8 @@ public:
 	void remove_joint(JoltJoint3D *p_joint);
 
 	void call_queries();
+	// Queues the callbacks so nodes pick up a restored space state on the next flush.
+	void state_restored();
 
 	virtual void pre_step(float p_step, JPH::Body &p_jolt_body) override;
 
@@ -39,44 +39,88 @@
 #include "core/os/os.h"
 #include "core/os/time.h"
 
-#include "Jolt/Physics/PhysicsSettings.h"
+#ifdef DEBUG_ENABLED
 
-void JoltJobSystem::Job::_execute(void *p_user_data) {
-	Job *job = static_cast<Job *>(p_user_data);
+JoltJobSystem::Stage JoltJobSystem::Job::_get_stage(const char *p_name) {
+	static const char *broad_phase_jobs[] = {
+		"UpdateBroadPhasePrepare",
+		"UpdateBroadPhaseFinalize",
+	};
+	static const char *narrow_phase_jobs[] = {
+		"FindCollisions",
+		"FindCCDContacts",
+	};
+	static const char *solver_jobs[] = {
+		"ApplyGravity",
+		"DetermineActiveConstraints",
+		"SetupVelocityConstraints",
+		"BuildIslandsFromConstraints",
+		"FinalizeIslands",
+		"BodySetIslandIndex",
+		"SolveVelocityConstraints",
+		"PreIntegrateVelocity",
+		"IntegrateVelocity",
+		"PostIntegrateVelocity",
+		"ResolveCCDContacts",
+		"SolvePositionConstraints",
+	};
+
+	for (const char *job_name : broad_phase_jobs) {
+		if (strcmp(p_name, job_name) == 0) {
+			return STAGE_BROAD_PHASE;
+		}
+	}
+	for (const char *job_name : narrow_phase_jobs) {
+		if (strcmp(p_name, job_name) == 0) {
+			return STAGE_NARROW_PHASE;
+		}
+	}
+	for (const char *job_name : solver_jobs) {
+		if (strcmp(p_name, job_name) == 0) {
+			return STAGE_SOLVER;
+		}
+	}
+	return STAGE_OTHER;
+}
 
-#ifdef DEBUG_ENABLED
+void JoltJobSystem::Job::_execute() {
 	const uint64_t time_start = Time::get_singleton()->get_ticks_usec();
-#endif
 
-	job->Execute();
+	function();
 
-#ifdef DEBUG_ENABLED
 	const uint64_t time_end = Time::get_singleton()->get_ticks_usec();
 	const uint64_t time_elapsed = time_end - time_start;
 
 	timings_lock.lock();
-	timings_by_job[job->name] += time_elapsed;
+
+	timings_by_job[name] += time_elapsed;
+
+	// Job names are literals, so the stage only has to be resolved the first time a name is seen.
+	Stage *stage = stages_by_job.getptr(name);
+	if (stage == nullptr) {
+		stage = &stages_by_job.insert(name, _get_stage(name))->value;
+	}
+	const Stage job_stage = *stage;
+
 	timings_lock.unlock();
-#endif
 
-	job->Release();
+	static_cast<JoltJobSystem *>(GetJobSystem())->stage_usec[job_stage].fetch_add(time_elapsed, std::memory_order_relaxed);
 }
 
+#endif
+
+// In debug builds the job function is wrapped so that timings also cover jobs that barriers run on the waiting thread.
 JoltJobSystem::Job::Job(const char *p_name, JPH::ColorArg p_color, JPH::JobSystem *p_job_system, const JPH::JobSystem::JobFunction &p_job_function, JPH::uint32 p_dependency_count) :
-		JPH::JobSystem::Job(p_name, p_color, p_job_system, p_job_function, p_dependency_count)
 #ifdef DEBUG_ENABLED
-		,
-		name(p_name)
+		JPH::JobSystem::Job(p_name, p_color, p_job_system, [this]() { _execute(); }, p_dependency_count),
+		name(p_name),
+		function(p_job_function)
+#else
+		JPH::JobSystem::Job(p_name, p_color, p_job_system, p_job_function, p_dependency_count)
 #endif
 {
 }
 
-JoltJobSystem::Job::~Job() {
-	if (task_id != -1) {
-		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
-	}
-}
-
 void JoltJobSystem::Job::push_completed(Job *p_job) {
 	Job *prev_head = nullptr;
 
@@ -99,14 +143,27 @@ JoltJobSystem::Job *JoltJobSystem::Job::pop_completed() {
 	return prev_head;
 }
 
-void JoltJobSystem::Job::queue() {
-	AddRef();
+void JoltJobSystem::_drain(void *p_user_data) {
+	JoltJobSystem *job_system = static_cast<JoltJobSystem *>(p_user_data);
 
-	// Ideally we would use Jolt's actual job name here, but I'd rather not incur the overhead of a memory allocation or
-	// thread-safe lookup every time we create/queue a task. So instead we use the same cached description for all of them.
-	static const String task_name("Jolt Physics");
+	while (true) {
+		job_system->queue_lock.lock();
+
+		if (job_system->queue.is_empty()) {
+			job_system->active_drain_tasks--;
+			job_system->queue_lock.unlock();
+			return;
+		}
+
+		Job *job = job_system->queue[job_system->queue.size() - 1];
+		job_system->queue.resize(job_system->queue.size() - 1);
 
-	task_id = WorkerThreadPool::get_singleton()->add_native_task(&_execute, this, true, task_name);
+		job_system->queue_lock.unlock();
+
+		// Barriers may have run this job already, in which case this does nothing.
+		job->Execute();
+		job->Release();
+	}
 }
 
 int JoltJobSystem::GetMaxConcurrency() const {
@@ -142,13 +199,31 @@ JPH::JobHandle JoltJobSystem::CreateJob(const char *p_name, JPH::ColorArg p_colo
 }
 
 void JoltJobSystem::QueueJob(JPH::JobSystem::Job *p_job) {
-	static_cast<Job *>(p_job)->queue();
+	QueueJobs(&p_job, 1);
 }
 
 void JoltJobSystem::QueueJobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count) {
+	queue_lock.lock();
+
 	for (JPH::uint i = 0; i < p_job_count; ++i) {
-		QueueJob(p_jobs[i]);
+		Job *job = static_cast<Job *>(p_jobs[i]);
+		job->AddRef();
+		queue.push_back(job);
+	}
+
+	const int tasks_to_add = MIN(thread_count - active_drain_tasks, (int)queue.size());
+	active_drain_tasks += MAX(tasks_to_add, 0);
+
+	// Ideally we would use Jolt's actual job name here, but I'd rather not incur the overhead of a memory allocation or
+	// thread-safe lookup every time we create/queue a task. So instead we use the same cached description for all of them.
+	static const String task_name("Jolt Physics");
+
+	// The task IDs are pushed while still holding the lock, so `post_step` can't miss a task that was just added.
+	for (int i = 0; i < tasks_to_add; ++i) {
+		drain_tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(&_drain, this, true, task_name));
 	}
+
+	queue_lock.unlock();
 }
 
 void JoltJobSystem::FreeJob(JPH::JobSystem::Job *p_job) {
@@ -164,7 +239,8 @@ void JoltJobSystem::_reclaim_jobs() {
 JoltJobSystem::JoltJobSystem() :
 		JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers),
 		thread_count(MAX(1, WorkerThreadPool::get_singleton()->get_thread_count())) {
-	jobs.Init(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsJobs);
+	// Pages are allocated on demand, so the extra room is only paid for when spaces step concurrently.
+	jobs.Init(JPH::cMaxPhysicsJobs * MAX_CONCURRENT_STEPS, JPH::cMaxPhysicsJobs);
 }
 
 void JoltJobSystem::pre_step() {
@@ -172,9 +248,25 @@ void JoltJobSystem::pre_step() {
 }
 
 void JoltJobSystem::post_step() {
+	// Every job of the step has run by now, so the remaining drain tasks are about to return.
+	queue_lock.lock();
+	LocalVector<WorkerThreadPool::TaskID> finished_tasks = std::move(drain_tasks);
+	drain_tasks.clear();
+	queue_lock.unlock();
+
+	for (const WorkerThreadPool::TaskID task_id : finished_tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+
 	_reclaim_jobs();
 }
 
+void JoltJobSystem::reset_stage_times() {
+	for (std::atomic<uint64_t> &usec : stage_usec) {
+		usec.store(0, std::memory_order_relaxed);
+	}
+}
+
 #ifdef DEBUG_ENABLED
 
 void JoltJobSystem::flush_timings() {
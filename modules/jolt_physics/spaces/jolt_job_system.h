@@ -32,41 +32,57 @@
 
 #pragma once
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/spin_lock.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
 #include "Jolt/Jolt.h"
 
 #include "Jolt/Core/FixedSizeFreeList.h"
 #include "Jolt/Core/JobSystemWithBarrier.h"
+#include "Jolt/Physics/PhysicsSettings.h"
 
 #include <atomic>
 
 class JoltJobSystem final : public JPH::JobSystemWithBarrier {
+public:
+	enum Stage {
+		STAGE_BROAD_PHASE,
+		STAGE_NARROW_PHASE,
+		STAGE_SOLVER,
+		STAGE_OTHER,
+		STAGE_MAX,
+	};
+
+	// Every `PhysicsSystem::Update` holds a barrier for its duration, which bounds how many spaces can step at once.
+	static constexpr int MAX_CONCURRENT_STEPS = JPH::cMaxPhysicsBarriers;
+
+private:
 	class Job : public JPH::JobSystem::Job {
 		inline static std::atomic<Job *> completed_head = nullptr;
 
 #ifdef DEBUG_ENABLED
 		const char *name = nullptr;
+		JPH::JobSystem::JobFunction function;
 #endif
 
-		int64_t task_id = -1;
-
 		std::atomic<Job *> completed_next = nullptr;
 
-		static void _execute(void *p_user_data);
+#ifdef DEBUG_ENABLED
+		static Stage _get_stage(const char *p_name);
+
+		void _execute();
+#endif
 
 	public:
 		Job(const char *p_name, JPH::ColorArg p_color, JPH::JobSystem *p_job_system, const JPH::JobSystem::JobFunction &p_job_function, JPH::uint32 p_dependency_count);
 		Job(const Job &p_other) = delete;
 		Job(Job &&p_other) = delete;
-		~Job();
 
 		static void push_completed(Job *p_job);
 		static Job *pop_completed();
 
-		void queue();
-
 		Job &operator=(const Job &p_other) = delete;
 		Job &operator=(Job &&p_other) = delete;
 	};
@@ -75,6 +91,7 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 	// We use `const void*` here to avoid the cost of hashing the actual string, since the job names
 	// are always literals and as such will point to the same address every time.
 	inline static HashMap<const void *, uint64_t> timings_by_job;
+	inline static HashMap<const void *, Stage> stages_by_job;
 
 	// TODO: Check whether the usage of SpinLock is justified or if this should be a mutex instead.
 	inline static SpinLock timings_lock;
@@ -82,6 +99,15 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 
 	JPH::FixedSizeFreeList<Job> jobs;
 
+	// Jobs that are ready to run. Rather than adding one pool task per job, up to `thread_count`
+	// drain tasks are kept on the WorkerThreadPool, each running queued jobs until none are left.
+	SpinLock queue_lock;
+	LocalVector<Job *> queue;
+	LocalVector<WorkerThreadPool::TaskID> drain_tasks;
+	int active_drain_tasks = 0;
+
+	std::atomic<uint64_t> stage_usec[STAGE_MAX] = {};
+
 	int thread_count = 0;
 
 	virtual int GetMaxConcurrency() const override;
@@ -91,6 +117,8 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 	virtual void QueueJobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count) override;
 	virtual void FreeJob(JPH::JobSystem::Job *p_job) override;
 
+	static void _drain(void *p_user_data);
+
 	void _reclaim_jobs();
 
 public:
@@ -99,6 +127,10 @@ public:
 	void pre_step();
 	void post_step();
 
+	// Time spent in jobs of each stage since the last reset, summed over all threads. Only measured in debug builds.
+	void reset_stage_times();
+	uint64_t get_stage_time_usec(Stage p_stage) const { return stage_usec[p_stage].load(std::memory_order_relaxed); }
+
 #ifdef DEBUG_ENABLED
 	void flush_timings();
 #endif
@@ -46,6 +46,8 @@
 #include "jolt_query_filter_3d.h"
 #include "jolt_space_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include "Jolt/Geometry/GJKClosestPoint.h"
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Body/BodyFilter.h"
@@ -467,15 +469,9 @@ JoltPhysicsDirectSpaceState3D::JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_spac
 		space(p_space) {
 }
 
-bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
-
-	space->try_optimize();
-
-	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
-
-	const JPH::RVec3 from = to_jolt_r(p_parameters.from);
-	const JPH::RVec3 to = to_jolt_r(p_parameters.to);
+bool JoltPhysicsDirectSpaceState3D::_intersect_ray_impl(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, const JoltQueryFilter3D &p_query_filter, RayResult &r_result) {
+	const JPH::RVec3 from = to_jolt_r(p_from);
+	const JPH::RVec3 to = to_jolt_r(p_to);
 	const JPH::Vec3 vector = JPH::Vec3(to - from);
 	const JPH::RRayCast ray(from, vector);
 
@@ -486,7 +482,7 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	settings.mBackFaceModeTriangles = back_face_mode;
 
 	JoltQueryCollectorClosest<JPH::CastRayCollector> collector;
-	space->get_narrow_phase_query().CastRay(ray, settings, collector, query_filter, query_filter, query_filter);
+	space->get_narrow_phase_query().CastRay(ray, settings, collector, p_query_filter, p_query_filter, p_query_filter);
 
 	if (!collector.had_hit()) {
 		return false;
@@ -531,6 +527,53 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	return true;
 }
 
+bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
+
+	space->try_optimize();
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+	return _intersect_ray_impl(p_parameters, p_parameters.from, p_parameters.to, query_filter, r_result);
+}
+
+void JoltPhysicsDirectSpaceState3D::_intersect_rays_task(uint32_t p_index, void *p_userdata) {
+	RayResult &result = ray_batch.results[p_index];
+	result = RayResult();
+	_intersect_ray_impl(*ray_batch.parameters, ray_batch.from[p_index], ray_batch.to[p_index], *ray_batch.query_filter, result);
+}
+
+int JoltPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), 0, "intersect_rays must not be called while the physics space is being stepped.");
+
+	if (p_count <= 0) {
+		return 0;
+	}
+
+	space->try_optimize();
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+
+	// Narrow phase queries only read the physics system, so the rays can be cast side by side.
+	ray_batch.parameters = &p_parameters;
+	ray_batch.query_filter = &query_filter;
+	ray_batch.from = p_from;
+	ray_batch.to = p_to;
+	ray_batch.results = r_results;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_intersect_rays_task, nullptr, p_count, -1, true, SNAME("JoltIntersectRays"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	ray_batch = RayBatch();
+
+	int hit_count = 0;
+	for (int i = 0; i < p_count; i++) {
+		if (r_results[i].rid.is_valid()) {
+			hit_count++;
+		}
+	}
+	return hit_count;
+}
+
 int JoltPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_point must not be called while the physics space is being stepped.");
 
@@ -661,6 +704,61 @@ bool JoltPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_paramet
 	return true;
 }
 
+void JoltPhysicsDirectSpaceState3D::_cast_motions_task(uint32_t p_index, void *p_userdata) {
+	Transform3D transform_com = motion_batch.transform;
+	transform_com.origin = motion_batch.origins[p_index];
+	transform_com = transform_com.translated_local(motion_batch.com_scaled);
+
+	_cast_motion_impl(*motion_batch.jolt_shape, transform_com, motion_batch.scale, motion_batch.motions[p_index], JoltProjectSettings::use_enhanced_internal_edge_removal_for_queries, true, *motion_batch.settings, *motion_batch.query_filter, *motion_batch.query_filter, *motion_batch.query_filter, JPH::ShapeFilter(), motion_batch.closest_safe[p_index], motion_batch.closest_unsafe[p_index]);
+}
+
+bool JoltPhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "cast_motions must not be called while the physics space is being stepped.");
+
+	if (p_count <= 0) {
+		return true;
+	}
+
+	space->try_optimize();
+
+	JoltShape3D *shape = JoltPhysicsServer3D::get_singleton()->get_shape(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, false);
+
+	const JPH::ShapeRefC jolt_shape = shape->try_build();
+	ERR_FAIL_NULL_V(jolt_shape, false);
+
+	Transform3D transform = p_parameters.transform;
+	JOLT_ENSURE_SCALE_NOT_ZERO(transform, "cast_motions was passed an invalid transform.");
+
+	Vector3 scale;
+	JoltMath::decompose(transform, scale);
+	JOLT_ENSURE_SCALE_VALID(jolt_shape, scale, "cast_motions was passed an invalid transform.");
+
+	JPH::CollideShapeSettings settings;
+	settings.mMaxSeparationDistance = (float)p_parameters.margin;
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
+
+	// Narrow phase queries only read the physics system, so the casts can run side by side.
+	motion_batch.jolt_shape = jolt_shape.GetPtr();
+	motion_batch.settings = &settings;
+	motion_batch.query_filter = &query_filter;
+	motion_batch.transform = transform;
+	motion_batch.scale = scale;
+	motion_batch.com_scaled = to_godot(jolt_shape->GetCenterOfMass());
+	motion_batch.origins = p_origins;
+	motion_batch.motions = p_motions;
+	motion_batch.closest_safe = r_closest_safe;
+	motion_batch.closest_unsafe = r_closest_unsafe;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_cast_motions_task, nullptr, p_count, -1, true, SNAME("JoltCastMotions"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	motion_batch = MotionBatch();
+
+	return true;
+}
+
 bool JoltPhysicsDirectSpaceState3D::collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) {
 	r_result_count = 0;
 
@@ -45,16 +45,45 @@
 #include "Jolt/Physics/Collision/ShapeFilter.h"
 
 class JoltBody3D;
+class JoltQueryFilter3D;
 class JoltShape3D;
 class JoltSpace3D;
 
 class JoltPhysicsDirectSpaceState3D final : public PhysicsDirectSpaceState3D {
 	GDCLASS(JoltPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D)
 
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const JoltQueryFilter3D *query_filter = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		RayResult *results = nullptr;
+	};
+
+	struct MotionBatch {
+		const JPH::Shape *jolt_shape = nullptr;
+		const JPH::CollideShapeSettings *settings = nullptr;
+		const JoltQueryFilter3D *query_filter = nullptr;
+		Transform3D transform;
+		Vector3 scale;
+		Vector3 com_scaled;
+		const Vector3 *origins = nullptr;
+		const Vector3 *motions = nullptr;
+		real_t *closest_safe = nullptr;
+		real_t *closest_unsafe = nullptr;
+	};
+
 	JoltSpace3D *space = nullptr;
 
+	RayBatch ray_batch;
+	MotionBatch motion_batch;
+
 	static void _bind_methods() {}
 
+	bool _intersect_ray_impl(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, const JoltQueryFilter3D &p_query_filter, RayResult &r_result);
+	void _intersect_rays_task(uint32_t p_index, void *p_userdata = nullptr);
+	void _cast_motions_task(uint32_t p_index, void *p_userdata = nullptr);
+
 	bool _cast_motion_impl(const JPH::Shape &p_jolt_shape, const Transform3D &p_transform_com, const Vector3 &p_scale, const Vector3 &p_motion, bool p_use_edge_removal, bool p_ignore_overlaps, const JPH::CollideShapeSettings &p_settings, const JPH::BroadPhaseLayerFilter &p_broad_phase_layer_filter, const JPH::ObjectLayerFilter &p_object_layer_filter, const JPH::BodyFilter &p_body_filter, const JPH::ShapeFilter &p_shape_filter, real_t &r_closest_safe, real_t &r_closest_unsafe) const;
 
 	bool _body_motion_recover(const JoltBody3D &p_body, const Transform3D &p_transform, float p_margin, const HashSet<RID> &p_excluded_bodies, const HashSet<ObjectID> &p_excluded_objects, Vector3 &r_recovery) const;
@@ -80,6 +109,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, Vector3 p_point) const override;
 
+	virtual int intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results) override;
+	virtual bool cast_motions(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override;
+
 	bool body_test_motion(const JoltBody3D &p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result) const;
 
 	JoltSpace3D &get_space() const { return *space; }
@@ -35,6 +35,7 @@
 #include "../joints/jolt_joint_3d.h"
 #include "../jolt_physics_server_3d.h"
 #include "../jolt_project_settings.h"
+#include "../misc/jolt_state_recorder.h"
 #include "../misc/jolt_stream_wrappers.h"
 #include "../objects/jolt_area_3d.h"
 #include "../objects/jolt_body_3d.h"
@@ -62,6 +63,8 @@ constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math::PI / 180;
 constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
 
+constexpr uint32_t STATE_MAGIC = 0x3353504A; // "JPS3"
+
 } // namespace
 
 void JoltSpace3D::_pre_step(float p_step) {
@@ -160,12 +163,23 @@ JoltSpace3D::~JoltSpace3D() {
 }
 
 void JoltSpace3D::step(float p_step) {
+	begin_step(p_step);
+	step_simulation();
+	end_step();
+}
+
+void JoltSpace3D::begin_step(float p_step) {
 	stepping = true;
 	last_step = p_step;
 
 	_pre_step(p_step);
 
-	const JPH::EPhysicsUpdateError update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
+	temp_allocator->fit_high_water_mark();
+	temp_allocator->reset_step_peak();
+}
+
+void JoltSpace3D::step_simulation() {
+	const JPH::EPhysicsUpdateError update_error = physics_system->Update(last_step, 1, temp_allocator, job_system);
 
 	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) != JPH::EPhysicsUpdateError::None) {
 		WARN_PRINT_ONCE(vformat("Jolt Physics manifold cache exceeded capacity and contacts were ignored. "
@@ -187,8 +201,10 @@ void JoltSpace3D::step(float p_step) {
 								"Maximum number of contact constraints is currently set to %d.",
 				JoltProjectSettings::max_contact_constraints));
 	}
+}
 
-	_post_step(p_step);
+void JoltSpace3D::end_step() {
+	_post_step(last_step);
 
 	bodies_added_since_optimizing = 0;
 	stepping = false;
@@ -208,6 +224,44 @@ void JoltSpace3D::call_queries() {
 	}
 }
 
+void JoltSpace3D::save_state(Vector<uint8_t> &r_state) const {
+	JoltStateRecorder recorder;
+	recorder.Write(STATE_MAGIC);
+	physics_system->SaveState(recorder);
+
+	r_state = recorder.get_data();
+}
+
+bool JoltSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	JoltStateRecorder recorder(p_state);
+
+	uint32_t magic = 0;
+	recorder.Read(magic);
+	ERR_FAIL_COND_V_MSG(magic != STATE_MAGIC, false, "Physics space state was saved by a different physics engine.");
+
+	const bool restored = physics_system->RestoreState(recorder) && !recorder.IsFailed();
+	ERR_FAIL_COND_V_MSG(!restored, false, "Physics space state doesn't match the bodies in the space, the space is left partially restored.");
+
+	JPH::BodyIDVector body_ids;
+	physics_system->GetBodies(body_ids);
+
+	const JPH::BodyLockInterface &lock_iface = get_lock_iface();
+	for (const JPH::BodyID &body_id : body_ids) {
+		const JPH::Body *jolt_body = lock_iface.TryGetBody(body_id);
+		if (jolt_body == nullptr) {
+			// Skip bodies which were removed in the meantime, they have nothing to restore.
+			continue;
+		}
+		JoltObject3D *object = reinterpret_cast<JoltObject3D *>(jolt_body->GetUserData());
+		JoltBody3D *body = object != nullptr ? object->as_body() : nullptr;
+		if (body != nullptr) {
+			body->state_restored();
+		}
+	}
+
+	return true;
+}
+
 double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS: {
@@ -272,6 +326,14 @@ void JoltSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, double p_va
 	}
 }
 
+JPH::TempAllocator &JoltSpace3D::get_temp_allocator() const {
+	return *temp_allocator;
+}
+
+uint64_t JoltSpace3D::get_temp_memory_peak() const {
+	return temp_allocator->get_step_peak();
+}
+
 JPH::BodyInterface &JoltSpace3D::get_body_iface() {
 	return physics_system->GetBodyInterfaceNoLock();
 }
@@ -54,6 +54,7 @@ class JoltLayers;
 class JoltObject3D;
 class JoltPhysicsDirectSpaceState3D;
 class JoltShapedObject3D;
+class JoltTempAllocator;
 
 class JoltSpace3D {
 	SelfList<JoltBody3D>::List body_call_queries_list;
@@ -64,7 +65,7 @@ class JoltSpace3D {
 	RID rid;
 
 	JPH::JobSystem *job_system = nullptr;
-	JPH::TempAllocator *temp_allocator = nullptr;
+	JoltTempAllocator *temp_allocator = nullptr;
 	JoltLayers *layers = nullptr;
 	JoltContactListener3D *contact_listener = nullptr;
 	JPH::PhysicsSystem *physics_system = nullptr;
@@ -87,8 +88,17 @@ public:
 
 	void step(float p_step);
 
+	// `step` split in three, so that only `step_simulation` needs to run concurrently with other spaces.
+	void begin_step(float p_step);
+	void step_simulation();
+	void end_step();
+
 	void call_queries();
 
+	// Bodies, contacts and constraints, through Jolt's own state recording.
+	void save_state(Vector<uint8_t> &r_state) const;
+	bool restore_state(const Vector<uint8_t> &p_state);
+
 	RID get_rid() const { return rid; }
 	void set_rid(const RID &p_rid) { rid = p_rid; }
 
@@ -102,7 +112,8 @@ public:
 
 	JPH::PhysicsSystem &get_physics_system() const { return *physics_system; }
 
-	JPH::TempAllocator &get_temp_allocator() const { return *temp_allocator; }
+	JPH::TempAllocator &get_temp_allocator() const;
+	uint64_t get_temp_memory_peak() const;
 
 	JPH::BodyInterface &get_body_iface();
 	const JPH::BodyInterface &get_body_iface() const;
@@ -52,6 +52,7 @@ ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WIT
 
 #include "../jolt_project_settings.h"
 
+#include "core/string/print_string.h"
 #include "core/variant/variant.h"
 
 #include "Jolt/Core/Memory.h"
@@ -88,15 +89,13 @@ void *JoltTempAllocator::Allocate(uint32_t p_size) {
 	if (new_top <= capacity) {
 		ptr = base + top;
 	} else {
-		WARN_PRINT_ONCE(vformat("Jolt Physics temporary memory allocator exceeded capacity of %d MiB. "
-								"Falling back to slower general-purpose allocator. "
-								"Consider increasing maximum temporary memory in project settings.",
-				JoltProjectSettings::temp_memory_mib));
-
+		// Falls back to the general-purpose allocator for now, the buffer grows before the next step.
 		ptr = JPH::Allocate(p_size);
 	}
 
 	top = new_top;
+	high_water_mark = MAX(high_water_mark, top);
+	step_peak = MAX(step_peak, top);
 
 	return ptr;
 }
@@ -120,3 +119,22 @@ void JoltTempAllocator::Free(void *p_ptr, uint32_t p_size) {
 
 	top = new_top;
 }
+
+void JoltTempAllocator::fit_high_water_mark() {
+	if (high_water_mark <= capacity) {
+		return;
+	}
+
+	ERR_FAIL_COND_MSG(top != 0, "Jolt Physics temporary memory can't be resized while in use.");
+
+	// Leave some headroom so a slowly growing scene doesn't resize every step.
+	const uint64_t new_capacity = align_up(high_water_mark + high_water_mark / 4, (uint64_t)1024 * 1024);
+
+	print_verbose(vformat("Jolt Physics temporary memory allocator exceeded capacity of %d MiB, growing it to %d MiB. "
+						  "Consider increasing maximum temporary memory in project settings.",
+			capacity / (1024 * 1024), new_capacity / (1024 * 1024)));
+
+	JPH::Free(base);
+	capacity = new_capacity;
+	base = static_cast<uint8_t *>(JPH::Allocate((size_t)capacity));
+}
@@ -41,6 +41,8 @@
 class JoltTempAllocator final : public JPH::TempAllocator {
 	uint64_t capacity = 0;
 	uint64_t top = 0;
+	uint64_t high_water_mark = 0;
+	uint64_t step_peak = 0;
 	uint8_t *base = nullptr;
 
 public:
@@ -49,4 +51,14 @@ public:
 
 	virtual void *Allocate(JPH::uint p_size) override;
 	virtual void Free(void *p_ptr, JPH::uint p_size) override;
+
+	// Grows the buffer to fit the most memory ever in use at once. Only call this when nothing is allocated.
+	void fit_high_water_mark();
+
+	uint64_t get_capacity() const { return capacity; }
+	uint64_t get_high_water_mark() const { return high_water_mark; }
+
+	// Most memory in use at once since the last reset, for reporting per step.
+	void reset_step_peak() { step_peak = 0; }
+	uint64_t get_step_peak() const { return step_peak; }
 };
@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  test_jolt_temp_allocator.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../spaces/jolt_temp_allocator.h"
+
+#include "tests/test_macros.h"
+
+namespace TestJoltTempAllocator {
+
+TEST_CASE("[JoltPhysics] Temporary allocator grows to its high water mark") {
+	JoltTempAllocator allocator;
+	const uint64_t initial_capacity = allocator.get_capacity();
+	const uint32_t size = (uint32_t)initial_capacity + 4096;
+
+	void *first = allocator.Allocate(size);
+	void *second = allocator.Allocate(64);
+	REQUIRE(first != nullptr);
+	REQUIRE(second != nullptr);
+	CHECK(allocator.get_high_water_mark() >= (uint64_t)size + 64);
+
+	allocator.Free(second, 64);
+	allocator.Free(first, size);
+
+	allocator.fit_high_water_mark();
+	CHECK_MESSAGE(allocator.get_capacity() >= allocator.get_high_water_mark(), "The buffer should grow to fit the largest step.");
+
+	// Allocations that fit are carved out of the buffer in order.
+	uint8_t *third = static_cast<uint8_t *>(allocator.Allocate(size));
+	uint8_t *fourth = static_cast<uint8_t *>(allocator.Allocate(64));
+	CHECK(fourth == third + size);
+	allocator.Free(fourth, 64);
+	allocator.Free(third, size);
+}
+
+TEST_CASE("[JoltPhysics] Temporary allocator step peak only covers the current step") {
+	JoltTempAllocator allocator;
+
+	void *first = allocator.Allocate(4096);
+	allocator.Free(first, 4096);
+	CHECK(allocator.get_step_peak() == 4096);
+
+	allocator.reset_step_peak();
+	CHECK(allocator.get_step_peak() == 0);
+
+	void *second = allocator.Allocate(64);
+	allocator.Free(second, 64);
+	CHECK(allocator.get_step_peak() == 64);
+	CHECK_MESSAGE(allocator.get_high_water_mark() == 4096, "The high water mark should still cover every step.");
+}
+
+} // namespace TestJoltTempAllocator
@@ -36,6 +36,8 @@
 
 #include "audio_stream_mp3.h"
 
+#include "servers/audio/audio_decoded_cache.h"
+
 int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	if (!active) {
 		return 0;
@@ -54,13 +56,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	}
 
 	while (todo && active) {
-		mp3dec_frame_info_t frame_info;
-		mp3d_sample_t *buf_frame = nullptr;
-
-		int samples_mixed = mp3dec_ex_read_frame(&mp3d, &buf_frame, &frame_info, mp3_stream->channels);
-
-		if (samples_mixed) {
-			p_buffer[p_frames - todo] = AudioFrame(buf_frame[0], buf_frame[samples_mixed - 1]);
+		if (_read_frame(p_buffer[p_frames - todo])) {
 			if (loop_fade_remaining < FADE_SIZE) {
 				p_buffer[p_frames - todo] += loop_fade[loop_fade_remaining] * (float(FADE_SIZE - loop_fade_remaining) / float(FADE_SIZE));
 				loop_fade_remaining++;
@@ -70,9 +66,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 
 			if (beat_loop && (int)frames_mixed >= beat_length_frames) {
 				for (int i = 0; i < FADE_SIZE; i++) {
-					samples_mixed = mp3dec_ex_read_frame(&mp3d, &buf_frame, &frame_info, mp3_stream->channels);
-					loop_fade[i] = AudioFrame(buf_frame[0], buf_frame[samples_mixed - 1]);
-					if (!samples_mixed) {
+					if (!_read_frame(loop_fade[i])) {
 						break;
 					}
 				}
@@ -101,6 +95,25 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	return frames_mixed_this_step;
 }
 
+bool AudioStreamPlaybackMP3::_read_frame(AudioFrame &r_frame) {
+	if (!decoded_frames.is_empty()) {
+		if (decoded_position >= (uint32_t)decoded_frames.size()) {
+			return false;
+		}
+		r_frame = decoded_frames[decoded_position++];
+		return true;
+	}
+
+	mp3dec_frame_info_t frame_info;
+	mp3d_sample_t *buf_frame = nullptr;
+	int samples_mixed = mp3dec_ex_read_frame(&mp3d, &buf_frame, &frame_info, mp3_stream->channels);
+	if (!samples_mixed) {
+		return false;
+	}
+	r_frame = AudioFrame(buf_frame[0], buf_frame[samples_mixed - 1]);
+	return true;
+}
+
 float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 	return mp3_stream->sample_rate;
 }
@@ -138,6 +151,10 @@ void AudioStreamPlaybackMP3::seek(double p_time) {
 	}
 
 	frames_mixed = uint32_t(mp3_stream->sample_rate * p_time);
+	if (!decoded_frames.is_empty()) {
+		decoded_position = frames_mixed;
+		return;
+	}
 	mp3dec_ex_seek(&mp3d, (uint64_t)frames_mixed * mp3_stream->channels);
 }
 
@@ -198,12 +215,18 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 	mp3s.instantiate();
 	mp3s->mp3_stream = Ref<AudioStreamMP3>(this);
 
-	int errorcode = mp3dec_ex_open_buf(&mp3s->mp3d, data.ptr(), data_len, MP3D_SEEK_TO_SAMPLE);
-
 	mp3s->frames_mixed = 0;
 	mp3s->active = false;
 	mp3s->loops = 0;
 
+	mp3s->decoded_frames = _get_decoded_frames();
+	if (!mp3s->decoded_frames.is_empty()) {
+		// Plays from memory, no decoder needed.
+		return mp3s;
+	}
+
+	int errorcode = mp3dec_ex_open_buf(&mp3s->mp3d, data.ptr(), data_len, MP3D_SEEK_TO_SAMPLE);
+
 	if (errorcode) {
 		ERR_FAIL_COND_V(errorcode, Ref<AudioStreamPlaybackMP3>());
 	}
@@ -211,6 +234,92 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 	return mp3s;
 }
 
+// Holds its own copy of the data, so the stream can be changed while decoding.
+class AudioStreamMP3::CacheDecoder : public AudioDecodedCache::Decoder {
+public:
+	LocalVector<uint8_t> data;
+	int channels = 1;
+
+	virtual Vector<AudioFrame> decode() override {
+		return AudioStreamMP3::_decode_frames(data.ptr(), data.size(), channels);
+	}
+};
+
+Vector<AudioFrame> AudioStreamMP3::_decode_frames() {
+	return _decode_frames(data.ptr(), data_len, channels);
+}
+
+Vector<AudioFrame> AudioStreamMP3::_decode_frames(const uint8_t *p_data, uint32_t p_data_len, int p_channels) {
+	Vector<AudioFrame> frames;
+
+	mp3dec_ex_t *mp3d = memnew(mp3dec_ex_t);
+	int err = mp3dec_ex_open_buf(mp3d, p_data, p_data_len, MP3D_SEEK_TO_SAMPLE);
+	if (!err) {
+		frames.resize(mp3d->samples / p_channels);
+		AudioFrame *frames_ptr = frames.ptrw();
+		int frame_count = 0;
+		while (frame_count < frames.size()) {
+			mp3dec_frame_info_t frame_info;
+			mp3d_sample_t *buf_frame = nullptr;
+			int samples_read = mp3dec_ex_read_frame(mp3d, &buf_frame, &frame_info, p_channels);
+			if (!samples_read) {
+				break;
+			}
+			frames_ptr[frame_count++] = AudioFrame(buf_frame[0], buf_frame[samples_read - 1]);
+		}
+		frames.resize(frame_count);
+	}
+	mp3dec_ex_close(mp3d);
+	memdelete(mp3d);
+
+	ERR_FAIL_COND_V_MSG(err, Vector<AudioFrame>(), "Failed to decode mp3 data.");
+	return frames;
+}
+
+Vector<AudioFrame> AudioStreamMP3::_get_decoded_frames() {
+	if (!decompressed_frames.is_empty()) {
+		return decompressed_frames;
+	}
+
+	Vector<AudioFrame> frames;
+	AudioDecodedCache *cache = AudioDecodedCache::get_singleton();
+	if (!cache || !cache->is_cacheable(get_length())) {
+		return frames;
+	}
+	if (cache->lookup(get_instance_id(), frames) || cache->is_decoding(get_instance_id())) {
+		return frames;
+	}
+
+	// Decoded in the background, so the first playbacks stream instead of stalling the calling thread.
+	CacheDecoder *decoder = memnew(CacheDecoder);
+	decoder->data = data;
+	decoder->channels = channels;
+	cache->decode(get_instance_id(), decoder);
+	return frames;
+}
+
+void AudioStreamMP3::_update_decompressed_frames() {
+	if (AudioDecodedCache::get_singleton()) {
+		AudioDecodedCache::get_singleton()->erase(get_instance_id());
+	}
+	decompressed_frames.clear();
+	if (decompress_in_memory && !data.is_empty()) {
+		decompressed_frames = _decode_frames();
+	}
+}
+
+void AudioStreamMP3::set_decompress_in_memory(bool p_enable) {
+	if (decompress_in_memory == p_enable) {
+		return;
+	}
+	decompress_in_memory = p_enable;
+	_update_decompressed_frames();
+}
+
+bool AudioStreamMP3::is_decompress_in_memory() const {
+	return decompress_in_memory;
+}
+
 String AudioStreamMP3::get_stream_name() const {
 	return ""; //return stream_name;
 }
@@ -238,6 +347,8 @@ void AudioStreamMP3::set_data(const Vector<uint8_t> &p_data) {
 
 	data = p_data;
 	data_len = src_data_len;
+
+	_update_decompressed_frames();
 }
 
 Vector<uint8_t> AudioStreamMP3::get_data() const {
@@ -252,6 +363,12 @@ bool AudioStreamMP3::has_loop() const {
 	return loop;
 }
 
+bool AudioStreamMP3::get_loop_range(double &r_loop_begin, double &r_loop_end) const {
+	r_loop_begin = loop ? loop_offset : 0.0;
+	r_loop_end = loop ? get_length() : -1.0;
+	return true;
+}
+
 void AudioStreamMP3::set_loop_offset(double p_seconds) {
 	loop_offset = p_seconds;
 }
@@ -335,6 +452,9 @@ void AudioStreamMP3::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &AudioStreamMP3::set_data);
 	ClassDB::bind_method(D_METHOD("get_data"), &AudioStreamMP3::get_data);
 
+	ClassDB::bind_method(D_METHOD("set_decompress_in_memory", "enable"), &AudioStreamMP3::set_decompress_in_memory);
+	ClassDB::bind_method(D_METHOD("is_decompress_in_memory"), &AudioStreamMP3::is_decompress_in_memory);
+
 	ClassDB::bind_method(D_METHOD("set_loop", "enable"), &AudioStreamMP3::set_loop);
 	ClassDB::bind_method(D_METHOD("has_loop"), &AudioStreamMP3::has_loop);
 
@@ -356,6 +476,7 @@ void AudioStreamMP3::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "bar_beats", PropertyHint::HINT_RANGE, "2,32,1,or_greater"), "set_bar_beats", "get_bar_beats");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "has_loop");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "loop_offset"), "set_loop_offset", "get_loop_offset");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "decompress_in_memory"), "set_decompress_in_memory", "is_decompress_in_memory");
 }
 
 AudioStreamMP3::AudioStreamMP3() {
@@ -363,4 +484,7 @@ AudioStreamMP3::AudioStreamMP3() {
 
 AudioStreamMP3::~AudioStreamMP3() {
 	clear_data();
+	if (AudioDecodedCache::get_singleton()) {
+		AudioDecodedCache::get_singleton()->erase(get_instance_id());
+	}
 }
@@ -61,6 +61,13 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 	bool _is_sample = false;
 	Ref<AudioSamplePlayback> sample_playback;
 
+	// Whole stream decoded to PCM, shared with the stream or the decoded cache.
+	// When set, frames are read from it instead of running the mp3 decoder.
+	Vector<AudioFrame> decoded_frames;
+	uint32_t decoded_position = 0;
+
+	bool _read_frame(AudioFrame &r_frame);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
@@ -106,6 +113,15 @@ class AudioStreamMP3 : public AudioStream {
 	float loop_offset = 0.0;
 	void clear_data();
 
+	bool decompress_in_memory = false;
+	Vector<AudioFrame> decompressed_frames;
+
+	class CacheDecoder;
+	static Vector<AudioFrame> _decode_frames(const uint8_t *p_data, uint32_t p_data_len, int p_channels);
+	Vector<AudioFrame> _decode_frames();
+	Vector<AudioFrame> _get_decoded_frames();
+	void _update_decompressed_frames();
+
 	double bpm = 0;
 	int beat_count = 0;
 	int bar_beats = 4;
@@ -119,6 +135,7 @@ public:
 
 	void set_loop(bool p_enable);
 	virtual bool has_loop() const override;
+	virtual bool get_loop_range(double &r_loop_begin, double &r_loop_end) const override;
 
 	void set_loop_offset(double p_seconds);
 	double get_loop_offset() const;
@@ -138,6 +155,9 @@ public:
 	void set_data(const Vector<uint8_t> &p_data);
 	Vector<uint8_t> get_data() const;
 
+	void set_decompress_in_memory(bool p_enable);
+	bool is_decompress_in_memory() const;
+
 	virtual double get_length() const override;
 
 	virtual bool is_monophonic() const override;
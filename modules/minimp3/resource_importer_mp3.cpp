@@ -81,6 +81,7 @@ void ResourceImporterMP3::get_import_options(const String &p_path, List<ImportOp
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "bpm", PropertyHint::HINT_RANGE, "0,400,0.01,or_greater"), 0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "beat_count", PropertyHint::HINT_RANGE, "0,512,or_greater"), 0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "bar_beats", PropertyHint::HINT_RANGE, "2,32,or_greater"), 4));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "decompress_in_memory"), false));
 }
 
 #ifdef TOOLS_ENABLED
@@ -102,6 +103,7 @@ Error ResourceImporterMP3::import(ResourceUID::ID p_source_id, const String &p_s
 	double bpm = p_options["bpm"];
 	float beat_count = p_options["beat_count"];
 	float bar_beats = p_options["bar_beats"];
+	bool decompress_in_memory = p_options["decompress_in_memory"];
 
 	Ref<AudioStreamMP3> mp3_stream = AudioStreamMP3::load_from_file(p_source_file);
 	if (mp3_stream.is_null()) {
@@ -113,6 +115,7 @@ Error ResourceImporterMP3::import(ResourceUID::ID p_source_id, const String &p_s
 	mp3_stream->set_bpm(bpm);
 	mp3_stream->set_beat_count(beat_count);
 	mp3_stream->set_bar_beats(bar_beats);
+	mp3_stream->set_decompress_in_memory(decompress_in_memory);
 
 	return ResourceSaver::save(mp3_stream, p_save_path + ".mp3str");
 }
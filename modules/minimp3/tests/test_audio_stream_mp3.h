@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_audio_stream_mp3.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../audio_stream_mp3.h"
+
+#include "servers/audio/audio_decoded_cache.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestAudioStreamMP3 {
+
+static Vector<AudioFrame> mix_playback(const Ref<AudioStream> &p_stream, double p_from, int p_max_frames) {
+	Ref<AudioStreamPlayback> playback = p_stream->instantiate_playback();
+	playback->start(p_from);
+
+	Vector<AudioFrame> frames;
+	frames.resize(p_max_frames);
+	int mixed = 0;
+	while (mixed < p_max_frames && playback->is_playing()) {
+		mixed += playback->mix(frames.ptrw() + mixed, 1.0, MIN(512, p_max_frames - mixed));
+	}
+	frames.resize(mixed);
+	return frames;
+}
+
+static int count_mismatches(const Vector<AudioFrame> &p_a, const Vector<AudioFrame> &p_b) {
+	int mismatches = 0;
+	for (int i = 0; i < MIN(p_a.size(), p_b.size()); i++) {
+		if (p_a[i].left != p_b[i].left || p_a[i].right != p_b[i].right) {
+			mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+TEST_CASE("[Audio][AudioStreamMP3] Decoded playback matches the streaming decoder") {
+	const String path = TestUtils::get_data_path("audio/noise_mono.mp3");
+	Ref<AudioStreamMP3> streaming = AudioStreamMP3::load_from_file(path);
+	Ref<AudioStreamMP3> decompressed = AudioStreamMP3::load_from_file(path);
+	REQUIRE(streaming.is_valid());
+	REQUIRE(decompressed.is_valid());
+	decompressed->set_decompress_in_memory(true);
+
+	// Well past the end, so both playbacks run out on their own.
+	const int max_frames = AudioServer::get_singleton()->get_mix_rate() * streaming->get_length() * 2;
+
+	SUBCASE("One shot") {
+		const Vector<AudioFrame> expected = mix_playback(streaming, 0.0, max_frames);
+		const Vector<AudioFrame> result = mix_playback(decompressed, 0.0, max_frames);
+		CHECK(expected.size() > 0);
+		CHECK(result.size() == expected.size());
+		CHECK(count_mismatches(expected, result) == 0);
+	}
+
+	SUBCASE("Looping") {
+		streaming->set_loop(true);
+		decompressed->set_loop(true);
+		const Vector<AudioFrame> expected = mix_playback(streaming, 0.0, max_frames);
+		const Vector<AudioFrame> result = mix_playback(decompressed, 0.0, max_frames);
+		CHECK(result.size() == max_frames);
+		CHECK(expected.size() == max_frames);
+		CHECK(count_mismatches(expected, result) == 0);
+	}
+
+	SUBCASE("Seeking") {
+		// MP3 seeking is sample exact, so both playbacks resume at the same frame.
+		const double from = streaming->get_length() * 0.5;
+		const Vector<AudioFrame> expected = mix_playback(streaming, from, max_frames);
+		const Vector<AudioFrame> result = mix_playback(decompressed, from, max_frames);
+		CHECK(expected.size() > 0);
+		CHECK(result.size() == expected.size());
+		CHECK(count_mismatches(expected, result) == 0);
+	}
+
+	SUBCASE("Shared decoded cache") {
+		// Mixed before the cache is enabled, so this one is decoded while streaming.
+		const Vector<AudioFrame> expected = mix_playback(streaming, 0.0, max_frames);
+
+		AudioDecodedCache *cache = AudioDecodedCache::get_singleton();
+		REQUIRE(cache != nullptr);
+		const uint64_t old_budget = cache->get_memory_budget();
+		const double old_length = cache->get_max_stream_length();
+		cache->set_memory_budget(16 * 1024 * 1024);
+		cache->set_max_stream_length(10.0);
+
+		Ref<AudioStreamMP3> cached = AudioStreamMP3::load_from_file(path);
+		// The first playback streams while the stream is decoded in the background.
+		const Vector<AudioFrame> streamed = mix_playback(cached, 0.0, max_frames);
+		CHECK(count_mismatches(expected, streamed) == 0);
+		cache->wait_for_decodes();
+		CHECK(cache->get_entry_count() == 1);
+
+		const Vector<AudioFrame> result = mix_playback(cached, 0.0, max_frames);
+		CHECK(result.size() == expected.size());
+		CHECK(count_mismatches(expected, result) == 0);
+
+		cached.unref();
+		cache->clear();
+		cache->set_max_stream_length(old_length);
+		cache->set_memory_budget(old_budget);
+	}
+}
+
+} // namespace TestAudioStreamMP3
@@ -99,6 +99,7 @@ void GodotNavigationServer2D::sync() {
 }
 
 void GodotNavigationServer2D::finish() {
+	_clear_async_path_queries();
 #ifdef CLIPPER2_ENABLED
 	if (navmesh_generator_2d) {
 		navmesh_generator_2d->finish();
@@ -443,6 +444,16 @@ Vector2 GodotNavigationServer2D::map_get_random_point(RID p_map, uint32_t p_navi
 	return map->get_random_point(p_navigation_layers, p_uniformly);
 }
 
+Ref<NavigationFlowField2D> GodotNavigationServer2D::map_get_flow_field(RID p_map, Vector2 p_target_position, uint32_t p_navigation_layers) const {
+	const NavMap2D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Ref<NavigationFlowField2D>());
+
+	Ref<NavigationFlowField2D> flow_field;
+	flow_field.instantiate();
+	map->get_flow_field(p_target_position, p_navigation_layers, flow_field);
+	return flow_field;
+}
+
 RID GodotNavigationServer2D::region_create() {
 	MutexLock lock(operations_mutex);
 
@@ -1174,6 +1185,9 @@ COMMAND_1(free, RID, p_object) {
 	if (map_owner.owns(p_object)) {
 		NavMap2D *map = map_owner.get_or_null(p_object);
 
+		// Running async path queries may still read from this map.
+		_wait_for_async_path_queries();
+
 		// Removes any assigned region.
 		for (NavRegion2D *region : map->get_regions()) {
 			map->remove_region(region);
@@ -1272,6 +1286,7 @@ void GodotNavigationServer2D::process(double p_delta_time) {
 	// E.g. (final) sync of objects for this main loop iteration, updating rendered debug visuals, updating debug statistics, ...
 
 	sync();
+	_process_async_path_queries();
 }
 
 void GodotNavigationServer2D::physics_process(double p_delta_time) {
@@ -1342,6 +1357,97 @@ void GodotNavigationServer2D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries2D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer2D::query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	MutexLock lock(async_path_queries_mutex);
+
+	NavMeshQueries2D::NavMeshPathQueryTask2D *query_task = nullptr;
+	if (async_path_queries_unused.is_empty()) {
+		query_task = memnew(NavMeshQueries2D::NavMeshPathQueryTask2D);
+	} else {
+		query_task = async_path_queries_unused[async_path_queries_unused.size() - 1];
+		async_path_queries_unused.resize(async_path_queries_unused.size() - 1);
+	}
+	query_task->query_parameters = p_query_parameters;
+	query_task->query_result = p_query_result;
+	query_task->callback = p_callback;
+	async_path_queries_pending.push_back(query_task);
+}
+
+void GodotNavigationServer2D::_async_path_query(uint32_t p_index, void *p_userdata) {
+	NavMeshQueries2D::NavMeshPathQueryTask2D *query_task = async_path_queries_running[p_index];
+	if (query_task->map) {
+		query_task->map->query_path(*query_task);
+	}
+}
+
+void GodotNavigationServer2D::_wait_for_async_path_queries() {
+	if (async_path_queries_group_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(async_path_queries_group_id);
+		async_path_queries_group_id = -1;
+	}
+}
+
+void GodotNavigationServer2D::_process_async_path_queries() {
+	_wait_for_async_path_queries();
+
+	// Deliver the batch started last frame. Callbacks may queue new queries, which go to the pending list.
+	for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : async_path_queries_running) {
+		NavMeshQueries2D::query_task_apply_result(*query_task, query_task->query_result);
+		query_task->query_parameters.unref();
+		query_task->query_result.unref();
+		query_task->callback = Callable();
+		query_task->map = nullptr;
+	}
+
+	{
+		MutexLock lock(async_path_queries_mutex);
+		for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : async_path_queries_running) {
+			async_path_queries_unused.push_back(query_task);
+		}
+		async_path_queries_running.clear();
+		SWAP(async_path_queries_running, async_path_queries_pending);
+	}
+
+	if (async_path_queries_running.is_empty()) {
+		return;
+	}
+
+	// Maps are resolved here rather than on submission so queries for maps freed in between just return an empty path.
+	int path_query_slots = 1;
+	for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : async_path_queries_running) {
+		NavMeshQueries2D::query_task_set_parameters(*query_task, query_task->query_parameters);
+		query_task->map = map_owner.get_or_null(query_task->query_parameters->get_map());
+		if (query_task->map) {
+			path_query_slots = MAX(path_query_slots, query_task->map->get_path_query_slots_max());
+		}
+	}
+
+	// Each map only has as many path query slots as navigation/pathfinding/max_threads, more tasks would just wait for a slot.
+	int task_count = MIN(path_query_slots, int(async_path_queries_running.size()));
+	async_path_queries_group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer2D::_async_path_query, (void *)nullptr, async_path_queries_running.size(), task_count, true, SNAME("NavigationServer2DAsyncPathQueries"));
+}
+
+void GodotNavigationServer2D::_clear_async_path_queries() {
+	_wait_for_async_path_queries();
+
+	MutexLock lock(async_path_queries_mutex);
+	for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : async_path_queries_pending) {
+		memdelete(query_task);
+	}
+	for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : async_path_queries_running) {
+		memdelete(query_task);
+	}
+	for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : async_path_queries_unused) {
+		memdelete(query_task);
+	}
+	async_path_queries_pending.clear();
+	async_path_queries_running.clear();
+	async_path_queries_unused.clear();
+}
+
 RID GodotNavigationServer2D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -102,6 +102,20 @@ class GodotNavigationServer2D : public NavigationServer2D {
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
 
+	// Queries from query_path_async() are started as one group task in process() and
+	// delivered on the main thread in the next process(). Finished tasks are kept for
+	// reuse so their path buffers don't get reallocated for every query.
+	Mutex async_path_queries_mutex;
+	LocalVector<NavMeshQueries2D::NavMeshPathQueryTask2D *> async_path_queries_pending;
+	LocalVector<NavMeshQueries2D::NavMeshPathQueryTask2D *> async_path_queries_running;
+	LocalVector<NavMeshQueries2D::NavMeshPathQueryTask2D *> async_path_queries_unused;
+	WorkerThreadPool::GroupID async_path_queries_group_id = -1;
+
+	void _async_path_query(uint32_t p_index, void *p_userdata);
+	void _wait_for_async_path_queries();
+	void _process_async_path_queries();
+	void _clear_async_path_queries();
+
 public:
 	GodotNavigationServer2D();
 	virtual ~GodotNavigationServer2D();
@@ -144,6 +158,7 @@ public:
 	virtual bool map_get_use_async_iterations(RID p_map) const override;
 
 	virtual Vector2 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override;
+	virtual Ref<NavigationFlowField2D> map_get_flow_field(RID p_map, Vector2 p_target_position, uint32_t p_navigation_layers = 1) const override;
 
 	virtual RID region_create() override;
 	virtual uint32_t region_get_iteration_id(RID p_region) const override;
@@ -316,6 +331,7 @@ public:
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override;
 
 	COMMAND_1(free, RID, p_object);
 
@@ -34,6 +34,7 @@
 
 #include "../nav_utils_2d.h"
 
+#include "servers/navigation/navigation_flow_field_2d.h"
 #include "servers/navigation/navigation_path_query_parameters_2d.h"
 #include "servers/navigation/navigation_path_query_result_2d.h"
 #include "servers/navigation/navigation_utilities.h"
@@ -124,9 +125,12 @@ public:
 	static RID map_iteration_get_closest_point_owner(const NavMapIteration2D &p_map_iteration, const Vector2 &p_point);
 	static nav_2d::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration2D &p_map_iteration, const Vector2 &p_point);
 	static Vector2 map_iteration_get_random_point(const NavMapIteration2D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
+	static void map_iteration_get_flow_field(const NavMapIteration2D &p_map_iteration, const Vector2 &p_target_position, uint32_t p_navigation_layers, Ref<NavigationFlowField2D> r_flow_field);
 
 	static void map_query_path(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback);
 
+	static void query_task_set_parameters(NavMeshPathQueryTask2D &p_query_task, const Ref<NavigationPathQueryParameters2D> &p_query_parameters);
+	static void query_task_apply_result(NavMeshPathQueryTask2D &p_query_task, Ref<NavigationPathQueryResult2D> p_query_result);
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask2D &p_query_task, const Vector2 &p_point, const nav_2d::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration);
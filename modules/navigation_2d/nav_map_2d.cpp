@@ -278,6 +278,12 @@ Vector2 NavMap2D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries2D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+void NavMap2D::get_flow_field(const Vector2 &p_target_position, uint32_t p_navigation_layers, Ref<NavigationFlowField2D> r_flow_field) const {
+	GET_MAP_ITERATION_CONST();
+
+	NavMeshQueries2D::map_iteration_get_flow_field(map_iteration, p_target_position, p_navigation_layers, r_flow_field);
+}
+
 void NavMap2D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
@@ -530,28 +536,36 @@ void NavMap2D::_update_rvo_simulation() {
 	}
 }
 
-void NavMap2D::compute_single_avoidance_step(uint32_t p_index, NavAgent2D **p_agent) {
-	(*(p_agent + p_index))->get_rvo_agent()->computeNeighbors(&rvo_simulation);
-	(*(p_agent + p_index))->get_rvo_agent()->computeNewVelocity(&rvo_simulation);
-	(*(p_agent + p_index))->get_rvo_agent()->update(&rvo_simulation);
-	(*(p_agent + p_index))->update();
+void NavMap2D::compute_avoidance_batch(uint32_t p_batch_index, NavAgent2D **p_agents) {
+	const uint32_t agent_index_begin = p_batch_index * AVOIDANCE_AGENT_BATCH_SIZE;
+	const uint32_t agent_index_end = MIN(agent_index_begin + AVOIDANCE_AGENT_BATCH_SIZE, active_avoidance_agents.size());
+	for (uint32_t agent_index = agent_index_begin; agent_index < agent_index_end; agent_index++) {
+		RVO2D::Agent2D *rvo_agent = p_agents[agent_index]->get_rvo_agent();
+		rvo_agent->computeNeighbors(&rvo_simulation);
+		rvo_agent->computeNewVelocity(&rvo_simulation);
+	}
 }
 
 void NavMap2D::step(double p_delta_time) {
 	rvo_simulation.setTimeStep(float(p_delta_time));
 
 	if (active_avoidance_agents.size() > 0) {
-		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap2D::compute_single_avoidance_step, active_avoidance_agents.ptr(), active_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+		// New velocities are computed for all agents before any agent moves, so the
+		// agent tree and the neighbor states stay read-only while the batches run.
+		const uint32_t batch_count = Math::division_round_up(active_avoidance_agents.size(), AVOIDANCE_AGENT_BATCH_SIZE);
+		if (use_threads && avoidance_use_multiple_threads && batch_count > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap2D::compute_avoidance_batch, active_avoidance_agents.ptr(), batch_count, -1, avoidance_use_high_priority_threads, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent2D *agent : active_avoidance_agents) {
-				agent->get_rvo_agent()->computeNeighbors(&rvo_simulation);
-				agent->get_rvo_agent()->computeNewVelocity(&rvo_simulation);
-				agent->get_rvo_agent()->update(&rvo_simulation);
-				agent->update();
+			for (uint32_t batch_index = 0; batch_index < batch_count; batch_index++) {
+				compute_avoidance_batch(batch_index, active_avoidance_agents.ptr());
 			}
 		}
+
+		for (NavAgent2D *agent : active_avoidance_agents) {
+			agent->get_rvo_agent()->update(&rvo_simulation);
+			agent->update();
+		}
 	}
 }
 
@@ -100,6 +100,9 @@ class NavMap2D : public NavRid2D {
 	bool avoidance_use_multiple_threads = true;
 	bool avoidance_use_high_priority_threads = true;
 
+	/// Avoidance agents are stepped in batches of this many agents per thread task.
+	static constexpr uint32_t AVOIDANCE_AGENT_BATCH_SIZE = 64;
+
 	// Performance Monitor
 	nav_2d::PerformanceData performance_data;
 
@@ -135,6 +138,7 @@ public:
 	~NavMap2D();
 
 	uint32_t get_iteration_id() const { return iteration_id; }
+	int get_path_query_slots_max() const { return path_query_slots_max; }
 
 	void set_cell_size(real_t p_cell_size);
 	real_t get_cell_size() const {
@@ -200,6 +204,7 @@ public:
 	}
 
 	Vector2 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
+	void get_flow_field(const Vector2 &p_target_position, uint32_t p_navigation_layers, Ref<NavigationFlowField2D> r_flow_field) const;
 
 	void sync();
 	void step(double p_delta_time);
@@ -239,7 +244,7 @@ private:
 
 	void compute_single_step(uint32_t p_index, NavAgent2D **p_agent);
 
-	void compute_single_avoidance_step(uint32_t p_index, NavAgent2D **p_agent);
+	void compute_avoidance_batch(uint32_t p_batch_index, NavAgent2D **p_agents);
 
 	void _sync_avoidance();
 	void _update_rvo_simulation();
@@ -236,6 +236,63 @@ real_t GodotNavigationServer3D::map_get_link_connection_radius(RID p_map) const
 	return map->get_link_connection_radius();
 }
 
+COMMAND_2(map_set_hierarchical_cluster_size, RID, p_map, real_t, p_cluster_size) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_hierarchical_cluster_size(p_cluster_size);
+}
+
+real_t GodotNavigationServer3D::map_get_hierarchical_cluster_size(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_hierarchical_cluster_size();
+}
+
+COMMAND_2(map_set_avoidance_lod_origin, RID, p_map, Vector3, p_origin) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_avoidance_lod_origin(p_origin);
+}
+
+Vector3 GodotNavigationServer3D::map_get_avoidance_lod_origin(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Vector3());
+
+	return map->get_avoidance_lod_origin();
+}
+
+COMMAND_2(map_set_avoidance_lod_distance, RID, p_map, real_t, p_distance) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_avoidance_lod_distance(p_distance);
+}
+
+real_t GodotNavigationServer3D::map_get_avoidance_lod_distance(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_avoidance_lod_distance();
+}
+
+COMMAND_2(map_set_avoidance_lod_update_interval, RID, p_map, int, p_interval) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND_MSG(p_interval < 1, "Avoidance LOD update interval must be at least 1.");
+
+	map->set_avoidance_lod_update_interval(p_interval);
+}
+
+int GodotNavigationServer3D::map_get_avoidance_lod_update_interval(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_avoidance_lod_update_interval();
+}
+
 Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) {
 	const NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector<Vector3>());
@@ -383,6 +440,16 @@ Vector3 GodotNavigationServer3D::map_get_random_point(RID p_map, uint32_t p_navi
 	return map->get_random_point(p_navigation_layers, p_uniformly);
 }
 
+Ref<NavigationFlowField3D> GodotNavigationServer3D::map_get_flow_field(RID p_map, Vector3 p_target_position, uint32_t p_navigation_layers) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Ref<NavigationFlowField3D>());
+
+	Ref<NavigationFlowField3D> flow_field;
+	flow_field.instantiate();
+	map->get_flow_field(p_target_position, p_navigation_layers, flow_field);
+	return flow_field;
+}
+
 RID GodotNavigationServer3D::region_create() {
 	MutexLock lock(operations_mutex);
 
@@ -1205,6 +1272,9 @@ COMMAND_1(free, RID, p_object) {
 	if (map_owner.owns(p_object)) {
 		NavMap3D *map = map_owner.get_or_null(p_object);
 
+		// Running async path queries may still read from this map.
+		_wait_for_async_path_queries();
+
 		// Removes any assigned region
 		for (NavRegion3D *region : map->get_regions()) {
 			map->remove_region(region);
@@ -1352,6 +1422,7 @@ void GodotNavigationServer3D::process(double p_delta_time) {
 	// E.g. (final) sync of objects for this main loop iteration, updating rendered debug visuals, updating debug statistics, ...
 
 	sync();
+	_process_async_path_queries();
 }
 
 void GodotNavigationServer3D::physics_process(double p_delta_time) {
@@ -1414,6 +1485,7 @@ void GodotNavigationServer3D::init() {
 
 void GodotNavigationServer3D::finish() {
 	flush_queries();
+	_clear_async_path_queries();
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->finish();
 		memdelete(navmesh_generator_3d);
@@ -1431,6 +1503,97 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	MutexLock lock(async_path_queries_mutex);
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D *query_task = nullptr;
+	if (async_path_queries_unused.is_empty()) {
+		query_task = memnew(NavMeshQueries3D::NavMeshPathQueryTask3D);
+	} else {
+		query_task = async_path_queries_unused[async_path_queries_unused.size() - 1];
+		async_path_queries_unused.resize(async_path_queries_unused.size() - 1);
+	}
+	query_task->query_parameters = p_query_parameters;
+	query_task->query_result = p_query_result;
+	query_task->callback = p_callback;
+	async_path_queries_pending.push_back(query_task);
+}
+
+void GodotNavigationServer3D::_async_path_query(uint32_t p_index, void *p_userdata) {
+	NavMeshQueries3D::NavMeshPathQueryTask3D *query_task = async_path_queries_running[p_index];
+	if (query_task->map) {
+		query_task->map->query_path(*query_task);
+	}
+}
+
+void GodotNavigationServer3D::_wait_for_async_path_queries() {
+	if (async_path_queries_group_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(async_path_queries_group_id);
+		async_path_queries_group_id = -1;
+	}
+}
+
+void GodotNavigationServer3D::_process_async_path_queries() {
+	_wait_for_async_path_queries();
+
+	// Deliver the batch started last frame. Callbacks may queue new queries, which go to the pending list.
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : async_path_queries_running) {
+		NavMeshQueries3D::query_task_apply_result(*query_task, query_task->query_result);
+		query_task->query_parameters.unref();
+		query_task->query_result.unref();
+		query_task->callback = Callable();
+		query_task->map = nullptr;
+	}
+
+	{
+		MutexLock lock(async_path_queries_mutex);
+		for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : async_path_queries_running) {
+			async_path_queries_unused.push_back(query_task);
+		}
+		async_path_queries_running.clear();
+		SWAP(async_path_queries_running, async_path_queries_pending);
+	}
+
+	if (async_path_queries_running.is_empty()) {
+		return;
+	}
+
+	// Maps are resolved here rather than on submission so queries for maps freed in between just return an empty path.
+	int path_query_slots = 1;
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : async_path_queries_running) {
+		NavMeshQueries3D::query_task_set_parameters(*query_task, query_task->query_parameters);
+		query_task->map = map_owner.get_or_null(query_task->query_parameters->get_map());
+		if (query_task->map) {
+			path_query_slots = MAX(path_query_slots, query_task->map->get_path_query_slots_max());
+		}
+	}
+
+	// Each map only has as many path query slots as navigation/pathfinding/max_threads, more tasks would just wait for a slot.
+	int task_count = MIN(path_query_slots, int(async_path_queries_running.size()));
+	async_path_queries_group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_async_path_query, (void *)nullptr, async_path_queries_running.size(), task_count, true, SNAME("NavigationServer3DAsyncPathQueries"));
+}
+
+void GodotNavigationServer3D::_clear_async_path_queries() {
+	_wait_for_async_path_queries();
+
+	MutexLock lock(async_path_queries_mutex);
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : async_path_queries_pending) {
+		memdelete(query_task);
+	}
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : async_path_queries_running) {
+		memdelete(query_task);
+	}
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : async_path_queries_unused) {
+		memdelete(query_task);
+	}
+	async_path_queries_pending.clear();
+	async_path_queries_running.clear();
+	async_path_queries_unused.clear();
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -95,6 +95,20 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
 
+	// Queries from query_path_async() are started as one group task in process() and
+	// delivered on the main thread in the next process(). Finished tasks are kept for
+	// reuse so their path buffers don't get reallocated for every query.
+	Mutex async_path_queries_mutex;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> async_path_queries_pending;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> async_path_queries_running;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> async_path_queries_unused;
+	WorkerThreadPool::GroupID async_path_queries_group_id = -1;
+
+	void _async_path_query(uint32_t p_index, void *p_userdata);
+	void _wait_for_async_path_queries();
+	void _process_async_path_queries();
+	void _clear_async_path_queries();
+
 public:
 	GodotNavigationServer3D();
 	virtual ~GodotNavigationServer3D();
@@ -128,6 +142,18 @@ public:
 	COMMAND_2(map_set_link_connection_radius, RID, p_map, real_t, p_connection_radius);
 	virtual real_t map_get_link_connection_radius(RID p_map) const override;
 
+	COMMAND_2(map_set_hierarchical_cluster_size, RID, p_map, real_t, p_cluster_size);
+	virtual real_t map_get_hierarchical_cluster_size(RID p_map) const override;
+
+	COMMAND_2(map_set_avoidance_lod_origin, RID, p_map, Vector3, p_origin);
+	virtual Vector3 map_get_avoidance_lod_origin(RID p_map) const override;
+
+	COMMAND_2(map_set_avoidance_lod_distance, RID, p_map, real_t, p_distance);
+	virtual real_t map_get_avoidance_lod_distance(RID p_map) const override;
+
+	COMMAND_2(map_set_avoidance_lod_update_interval, RID, p_map, int, p_interval);
+	virtual int map_get_avoidance_lod_update_interval(RID p_map) const override;
+
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) override;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const override;
@@ -147,6 +173,7 @@ public:
 	virtual bool map_get_use_async_iterations(RID p_map) const override;
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override;
+	virtual Ref<NavigationFlowField3D> map_get_flow_field(RID p_map, Vector3 p_target_position, uint32_t p_navigation_layers = 1) const override;
 
 	virtual RID region_create() override;
 	virtual uint32_t region_get_iteration_id(RID p_region) const override;
@@ -290,6 +317,7 @@ public:
 	virtual void finish() override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
@@ -72,6 +72,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_cluster_graph(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -389,6 +391,104 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_cluster_graph(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<uint32_t> &polygon_clusters = map_iteration->polygon_clusters;
+	LocalVector<Vector3> &cluster_positions = map_iteration->cluster_positions;
+	LocalVector<uint32_t> &cluster_neighbor_offsets = map_iteration->cluster_neighbor_offsets;
+	LocalVector<uint32_t> &cluster_neighbors = map_iteration->cluster_neighbors;
+
+	polygon_clusters.clear();
+	cluster_positions.clear();
+	cluster_neighbor_offsets.clear();
+	cluster_neighbors.clear();
+
+	const real_t cluster_size = r_build.hierarchical_cluster_size;
+	if (cluster_size <= 0.0) {
+		return;
+	}
+
+	// Link polygons are included so that links connect clusters too.
+	LocalVector<const Polygon *> polygons;
+	polygons.reserve(r_build.polygon_count);
+	for (const NavRegionIteration3D &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const Polygon &polygon : region.navmesh_polygons) {
+			polygons.push_back(&polygon);
+		}
+	}
+	for (const NavLinkIteration3D &link : map_iteration->link_iterations) {
+		if (!link.get_enabled()) {
+			continue;
+		}
+		for (const Polygon &polygon : link.navmesh_polygons) {
+			polygons.push_back(&polygon);
+		}
+	}
+
+	// Assign each polygon to the grid cell of its center.
+	polygon_clusters.resize(r_build.polygon_count);
+	HashMap<Vector3i, uint32_t> cluster_ids;
+	LocalVector<uint32_t> cluster_polygon_counts;
+	for (const Polygon *polygon : polygons) {
+		Vector3 center;
+		for (const Vector3 &vertex : polygon->vertices) {
+			center += vertex;
+		}
+		center /= MAX(1u, polygon->vertices.size());
+
+		const Vector3i cell = (center / cluster_size).floor();
+		HashMap<Vector3i, uint32_t>::Iterator cluster_it = cluster_ids.find(cell);
+		if (!cluster_it) {
+			cluster_it = cluster_ids.insert(cell, cluster_positions.size());
+			cluster_positions.push_back(Vector3());
+			cluster_polygon_counts.push_back(0);
+		}
+		const uint32_t cluster_id = cluster_it->value;
+		polygon_clusters[polygon->id] = cluster_id;
+		cluster_positions[cluster_id] += center;
+		cluster_polygon_counts[cluster_id]++;
+	}
+	for (uint32_t i = 0; i < cluster_positions.size(); i++) {
+		cluster_positions[i] /= cluster_polygon_counts[i];
+	}
+
+	// Connections are directed (links can be one-way), so neighbors are too.
+	LocalVector<uint64_t> cluster_pairs;
+	for (const Polygon *polygon : polygons) {
+		const uint32_t cluster_id = polygon_clusters[polygon->id];
+		for (const Edge &edge : polygon->edges) {
+			for (const Edge::Connection &connection : edge.connections) {
+				const uint32_t neighbor_id = polygon_clusters[connection.polygon->id];
+				if (neighbor_id != cluster_id) {
+					cluster_pairs.push_back((uint64_t(cluster_id) << 32) | neighbor_id);
+				}
+			}
+		}
+	}
+	cluster_pairs.sort();
+
+	cluster_neighbor_offsets.resize(cluster_positions.size() + 1);
+	for (uint32_t &offset : cluster_neighbor_offsets) {
+		offset = 0;
+	}
+	uint64_t previous_pair = UINT64_MAX;
+	for (uint64_t cluster_pair : cluster_pairs) {
+		if (cluster_pair == previous_pair) {
+			continue;
+		}
+		previous_pair = cluster_pair;
+		cluster_neighbors.push_back(uint32_t(cluster_pair & UINT32_MAX));
+		cluster_neighbor_offsets[(cluster_pair >> 32) + 1]++;
+	}
+	for (uint32_t i = 1; i < cluster_neighbor_offsets.size(); i++) {
+		cluster_neighbor_offsets[i] += cluster_neighbor_offsets[i - 1];
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -400,6 +500,9 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		p_path_query_slot.traversable_polys.reserve(map_iteration->navmesh_polygon_count * 0.25);
 		p_path_query_slot.path_corridor.clear();
 		p_path_query_slot.path_corridor.resize(map_iteration->navmesh_polygon_count);
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.cluster_route.clear();
+		p_path_query_slot.cluster_route.resize(map_iteration->cluster_positions.size());
 	}
 	map_iteration->path_query_slots_mutex.unlock();
 }
@@ -42,6 +42,7 @@ class NavMapBuilder3D {
 	static void _build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build);
 	static void _build_step_navlink_connections(NavMapIterationBuild3D &r_build);
+	static void _build_step_cluster_graph(NavMapIterationBuild3D &r_build);
 	static void _build_update_map_iteration(NavMapIterationBuild3D &r_build);
 
 public:
@@ -49,6 +49,7 @@ struct NavMapIterationBuild3D {
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
+	real_t hierarchical_cluster_size = 0.0;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
 	int free_edge_count = 0;
@@ -88,6 +89,15 @@ struct NavMapIteration3D {
 
 	HashMap<NavRegion3D *, uint32_t> region_ptr_to_region_id;
 
+	// Hierarchical pathfinding. Polygons are grouped into clusters on a grid of
+	// hierarchical_cluster_size, and two clusters are neighbors when any of their
+	// polygons are connected. Long queries first search this graph, then only
+	// expand polygons in clusters along the found route. Empty when disabled.
+	LocalVector<uint32_t> polygon_clusters; // Cluster id by polygon id.
+	LocalVector<Vector3> cluster_positions;
+	LocalVector<uint32_t> cluster_neighbor_offsets; // Neighbors of cluster c are cluster_neighbors[offsets[c]] to cluster_neighbors[offsets[c + 1]].
+	LocalVector<uint32_t> cluster_neighbors;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
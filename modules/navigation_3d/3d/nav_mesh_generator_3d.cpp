@@ -50,6 +50,8 @@ bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashSet<Ref<NavigationMesh>> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshTileCache3D *> NavMeshGenerator3D::tile_caches;
 
 NavMeshGenerator3D *NavMeshGenerator3D::get_singleton() {
 	return singleton;
@@ -123,6 +125,12 @@ void NavMeshGenerator3D::cleanup() {
 		generator_parsers.clear();
 		generator_parsers_rwlock.write_unlock();
 	}
+
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	for (KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+		memdelete(E.value);
+	}
+	tile_caches.clear();
 }
 
 void NavMeshGenerator3D::finish() {
@@ -289,13 +297,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
 	// added to keep track of steps, no functionality right now
 	String bake_state = "";
 
@@ -375,11 +376,13 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
 	}
 
+	const bool tiled = p_navigation_mesh->get_tile_size() > 0.0;
+
 	bake_state = "Calculating grid size..."; // step #2
 	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
 
-	// ~30000000 seems to be around sweetspot where Editor baking breaks
-	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+	// ~30000000 seems to be around sweetspot where Editor baking breaks, tiled bakes only rasterize a tile at a time.
+	if (!tiled && (cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
 		ERR_FAIL_MSG("Baking interrupted."
 					 "\nNavigationMesh baking process would likely crash the engine."
 					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
@@ -389,48 +392,75 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
+	if (tiled) {
+		generator_bake_tiles(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions);
+		return;
+	}
+
+	generator_erase_tile_cache(p_navigation_mesh->get_instance_id());
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	if (!generator_bake_heightfield(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+}
+
+bool NavMeshGenerator3D::generator_bake_heightfield(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
+
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
+
 	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
 	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
 	bake_state = "Constructing compact heightfield..."; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -447,11 +477,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Eroding walkable area..."; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -469,30 +499,30 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	bake_state = "Partitioning..."; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
 	bake_state = "Creating contours..."; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
 	bake_state = "Creating polymesh..."; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
@@ -501,9 +531,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Converting to native navigation mesh..."; // step #10
 
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
-
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
 	recast_index_to_native_index.resize(detail_mesh->nverts);
@@ -516,7 +543,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -540,12 +567,10 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
 	bake_state = "Cleanup..."; // step #11
 
 	rcFreePolyMesh(poly_mesh);
@@ -554,6 +579,315 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	detail_mesh = nullptr;
 
 	bake_state = "Baking finished."; // step #12
+
+	return true;
+}
+
+struct NavMeshGenerator3D::NavMeshBakeTile3D {
+	Vector2i coords;
+	uint32_t input_hash = 0;
+	rcConfig cfg;
+	LocalVector<int> tris;
+
+	Vector<Vector3> vertices;
+	Vector<Vector<int>> polygons;
+};
+
+struct NavMeshGenerator3D::NavMeshTileCache3D {
+	HashMap<Vector2i, NavMeshBakeTile3D> tiles;
+	uint32_t rebaked_tile_count = 0;
+};
+
+struct NavMeshGenerator3D::NavMeshTileBakeTask3D {
+	Ref<NavigationMesh> navigation_mesh;
+	const float *verts = nullptr;
+	int nverts = 0;
+	const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> *projected_obstructions = nullptr;
+	LocalVector<NavMeshBakeTile3D *> tiles;
+};
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshTileBakeTask3D *bake_task = static_cast<NavMeshTileBakeTask3D *>(p_arg);
+	NavMeshBakeTile3D *tile = bake_task->tiles[p_index];
+
+	tile->vertices.clear();
+	tile->polygons.clear();
+	if (!generator_bake_heightfield(bake_task->navigation_mesh, tile->cfg, bake_task->verts, bake_task->nverts, tile->tris.ptr(), tile->tris.size() / 3, *bake_task->projected_obstructions, tile->vertices, tile->polygons)) {
+		// Bake the tile again next time instead of keeping the failed result.
+		tile->input_hash = 0;
+	}
+}
+
+void NavMeshGenerator3D::generator_erase_tile_cache(ObjectID p_navigation_mesh_id) {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+
+	NavMeshTileCache3D **tile_cache = tile_caches.getptr(p_navigation_mesh_id);
+	if (tile_cache) {
+		memdelete(*tile_cache);
+		tile_caches.erase(p_navigation_mesh_id);
+	}
+}
+
+uint32_t NavMeshGenerator3D::get_rebaked_tile_count(const Ref<NavigationMesh> &p_navigation_mesh) {
+	ERR_FAIL_COND_V(p_navigation_mesh.is_null(), 0);
+
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	NavMeshTileCache3D **tile_cache = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+	return tile_cache ? (*tile_cache)->rebaked_tile_count : 0;
+}
+
+void NavMeshGenerator3D::generator_bake_tiles(Ref<NavigationMesh> p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions) {
+	const float cs = p_cfg.cs;
+	const float ch = p_cfg.ch;
+
+	const int tile_cells = MAX(1, (int)Math::ceil(p_navigation_mesh->get_tile_size() / cs));
+	if (Math::fmod(p_navigation_mesh->get_tile_size(), p_navigation_mesh->get_cell_size()) != 0.0) {
+		WARN_PRINT("Property tile_size is ceiled to cell_size voxel units and loses precision.");
+	}
+	const float tile_world_size = tile_cells * cs;
+
+	// Each tile rasterizes a border of the geometry around it so erosion and region building
+	// at its edges match its neighbors, Recast then trims the border from the result.
+	const int tile_border_cells = p_cfg.walkableRadius + 3;
+	const float tile_border_size = tile_border_cells * cs;
+
+	// Like for untiled bakes, the border size is kept as context around the baked area.
+	const float area_min_x = p_cfg.bmin[0] + p_cfg.borderSize * cs;
+	const float area_min_z = p_cfg.bmin[2] + p_cfg.borderSize * cs;
+	const float area_max_x = p_cfg.bmax[0] - p_cfg.borderSize * cs;
+	const float area_max_z = p_cfg.bmax[2] - p_cfg.borderSize * cs;
+	if (area_min_x >= area_max_x || area_min_z >= area_max_z) {
+		p_navigation_mesh->set_data(Vector<Vector3>(), Vector<Vector<int>>());
+		return;
+	}
+
+	// Tiles are aligned to a world grid, so growing the bake area does not move the tiles
+	// that already exist.
+	const Vector2i min_tile((int)Math::floor(area_min_x / tile_world_size), (int)Math::floor(area_min_z / tile_world_size));
+	const Vector2i max_tile((int)Math::floor(area_max_x / tile_world_size), (int)Math::floor(area_max_z / tile_world_size));
+	const Vector2i tile_count = max_tile - min_tile + Vector2i(1, 1);
+
+	LocalVector<NavMeshBakeTile3D> tiles;
+	tiles.resize(tile_count.x * tile_count.y);
+	for (int z = 0; z < tile_count.y; z++) {
+		for (int x = 0; x < tile_count.x; x++) {
+			tiles[z * tile_count.x + x].coords = min_tile + Vector2i(x, z);
+		}
+	}
+
+	// Hand each triangle to all tiles its bounds overlap, including the tile borders.
+	LocalVector<float> tile_min_y;
+	LocalVector<float> tile_max_y;
+	tile_min_y.resize(tiles.size());
+	tile_max_y.resize(tiles.size());
+	for (uint32_t i = 0; i < tiles.size(); i++) {
+		tile_min_y[i] = FLT_MAX;
+		tile_max_y[i] = -FLT_MAX;
+	}
+	for (int i = 0; i < p_ntris; i++) {
+		const float *v0 = &p_verts[p_tris[i * 3 + 0] * 3];
+		const float *v1 = &p_verts[p_tris[i * 3 + 1] * 3];
+		const float *v2 = &p_verts[p_tris[i * 3 + 2] * 3];
+		const float min_x = MIN(v0[0], MIN(v1[0], v2[0])) - tile_border_size;
+		const float max_x = MAX(v0[0], MAX(v1[0], v2[0])) + tile_border_size;
+		const float min_z = MIN(v0[2], MIN(v1[2], v2[2])) - tile_border_size;
+		const float max_z = MAX(v0[2], MAX(v1[2], v2[2])) + tile_border_size;
+		const float min_y = MIN(v0[1], MIN(v1[1], v2[1]));
+		const float max_y = MAX(v0[1], MAX(v1[1], v2[1]));
+
+		const int tile_x0 = MAX((int)Math::floor(min_x / tile_world_size), min_tile.x) - min_tile.x;
+		const int tile_x1 = MIN((int)Math::floor(max_x / tile_world_size), max_tile.x) - min_tile.x;
+		const int tile_z0 = MAX((int)Math::floor(min_z / tile_world_size), min_tile.y) - min_tile.y;
+		const int tile_z1 = MIN((int)Math::floor(max_z / tile_world_size), max_tile.y) - min_tile.y;
+		for (int z = tile_z0; z <= tile_z1; z++) {
+			for (int x = tile_x0; x <= tile_x1; x++) {
+				const uint32_t tile_index = z * tile_count.x + x;
+				NavMeshBakeTile3D &tile = tiles[tile_index];
+				tile.tris.push_back(p_tris[i * 3 + 0]);
+				tile.tris.push_back(p_tris[i * 3 + 1]);
+				tile.tris.push_back(p_tris[i * 3 + 2]);
+				tile_min_y[tile_index] = MIN(tile_min_y[tile_index], min_y);
+				tile_max_y[tile_index] = MAX(tile_max_y[tile_index], max_y);
+			}
+		}
+	}
+
+	// Anything that changes the bake result of all tiles goes into every tile hash.
+	uint32_t settings_hash = hash_murmur3_one_float(cs);
+	settings_hash = hash_murmur3_one_float(ch, settings_hash);
+	settings_hash = hash_murmur3_one_32(tile_cells, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.walkableSlopeAngle, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.walkableHeight, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.walkableClimb, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.walkableRadius, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.maxEdgeLen, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.maxSimplificationError, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.minRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.mergeRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.maxVertsPerPoly, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.detailSampleDist, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.detailSampleMaxError, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+
+	NavMeshTileCache3D *tile_cache = nullptr;
+	{
+		MutexLock tile_cache_lock(tile_cache_mutex);
+
+		// Drop the caches of navigation meshes that no longer exist.
+		LocalVector<ObjectID> freed_navigation_mesh_ids;
+		for (const KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+			if (ObjectDB::get_instance(E.key) == nullptr) {
+				freed_navigation_mesh_ids.push_back(E.key);
+			}
+		}
+		for (ObjectID freed_navigation_mesh_id : freed_navigation_mesh_ids) {
+			memdelete(tile_caches[freed_navigation_mesh_id]);
+			tile_caches.erase(freed_navigation_mesh_id);
+		}
+
+		NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+		if (tile_cache_ptr) {
+			tile_cache = *tile_cache_ptr;
+		} else {
+			tile_cache = memnew(NavMeshTileCache3D);
+			tile_caches.insert(p_navigation_mesh->get_instance_id(), tile_cache);
+		}
+	}
+
+	NavMeshTileBakeTask3D bake_task;
+	bake_task.navigation_mesh = p_navigation_mesh;
+	bake_task.verts = p_verts;
+	bake_task.nverts = p_nverts;
+	bake_task.projected_obstructions = &p_projected_obstructions;
+
+	for (uint32_t tile_index = 0; tile_index < tiles.size(); tile_index++) {
+		NavMeshBakeTile3D &tile = tiles[tile_index];
+		if (tile.tris.is_empty()) {
+			continue;
+		}
+
+		const float tile_min_x = MAX(tile.coords.x * tile_world_size, area_min_x);
+		const float tile_min_z = MAX(tile.coords.y * tile_world_size, area_min_z);
+		const float tile_max_x = MIN((tile.coords.x + 1) * tile_world_size, area_max_x);
+		const float tile_max_z = MIN((tile.coords.y + 1) * tile_world_size, area_max_z);
+		if (tile_min_x >= tile_max_x || tile_min_z >= tile_max_z) {
+			tile.tris.clear();
+			continue;
+		}
+
+		// Align the heights to a world grid too, so all tiles quantize heights the same way.
+		const float min_y = MAX(tile_min_y[tile_index], p_cfg.bmin[1]);
+		const float max_y = MIN(tile_max_y[tile_index], p_cfg.bmax[1]);
+		if (min_y > max_y) {
+			tile.tris.clear();
+			continue;
+		}
+
+		tile.cfg = p_cfg;
+		tile.cfg.borderSize = tile_border_cells;
+		tile.cfg.bmin[0] = tile_min_x - tile_border_size;
+		tile.cfg.bmin[1] = Math::floor(min_y / ch) * ch;
+		tile.cfg.bmin[2] = tile_min_z - tile_border_size;
+		tile.cfg.bmax[0] = tile_max_x + tile_border_size;
+		tile.cfg.bmax[1] = Math::ceil(max_y / ch) * ch + ch;
+		tile.cfg.bmax[2] = tile_max_z + tile_border_size;
+		rcCalcGridSize(tile.cfg.bmin, tile.cfg.bmax, cs, &tile.cfg.width, &tile.cfg.height);
+
+		uint32_t input_hash = settings_hash;
+		for (int i = 0; i < 3; i++) {
+			input_hash = hash_murmur3_one_float(tile.cfg.bmin[i], input_hash);
+			input_hash = hash_murmur3_one_float(tile.cfg.bmax[i], input_hash);
+		}
+		for (int vertex_index : tile.tris) {
+			const float *v = &p_verts[vertex_index * 3];
+			input_hash = hash_murmur3_one_float(v[0], input_hash);
+			input_hash = hash_murmur3_one_float(v[1], input_hash);
+			input_hash = hash_murmur3_one_float(v[2], input_hash);
+		}
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
+			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+				continue;
+			}
+			bool overlaps_tile = false;
+			for (int i = 0; i < projected_obstruction.vertices.size(); i += 3) {
+				if (projected_obstruction.vertices[i] >= tile.cfg.bmin[0] - tile_border_size && projected_obstruction.vertices[i] <= tile.cfg.bmax[0] + tile_border_size && projected_obstruction.vertices[i + 2] >= tile.cfg.bmin[2] - tile_border_size && projected_obstruction.vertices[i + 2] <= tile.cfg.bmax[2] + tile_border_size) {
+					overlaps_tile = true;
+					break;
+				}
+			}
+			if (!overlaps_tile) {
+				continue;
+			}
+			input_hash = hash_murmur3_buffer(projected_obstruction.vertices.ptr(), projected_obstruction.vertices.size() * sizeof(float), input_hash);
+			input_hash = hash_murmur3_one_float(projected_obstruction.elevation, input_hash);
+			input_hash = hash_murmur3_one_float(projected_obstruction.height, input_hash);
+			input_hash = hash_murmur3_one_32(projected_obstruction.carve, input_hash);
+		}
+		tile.input_hash = input_hash;
+
+		const NavMeshBakeTile3D *cached_tile = tile_cache->tiles.getptr(tile.coords);
+		if (cached_tile && cached_tile->input_hash == input_hash) {
+			tile.vertices = cached_tile->vertices;
+			tile.polygons = cached_tile->polygons;
+		} else {
+			bake_task.tiles.push_back(&tile);
+		}
+	}
+
+	tile_cache->rebaked_tile_count = bake_task.tiles.size();
+
+	// Async bakes already run on a pool thread, waiting there on a nested group task can starve the pool.
+	if (use_threads && bake_task.tiles.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_bake_tile, &bake_task, bake_task.tiles.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < bake_task.tiles.size(); i++) {
+			generator_thread_bake_tile(&bake_task, i);
+		}
+	}
+
+	// Merge the tiles into the navigation mesh, welding the vertices tiles share on their edges.
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	HashMap<Vector3, int> tile_vertex_to_native_index;
+	LocalVector<int> tile_index_to_native_index;
+
+	tile_cache->tiles.clear();
+	for (NavMeshBakeTile3D &tile : tiles) {
+		if (tile.tris.is_empty()) {
+			continue;
+		}
+
+		tile_index_to_native_index.resize(tile.vertices.size());
+		for (int i = 0; i < tile.vertices.size(); i++) {
+			const Vector3 &vertex = tile.vertices[i];
+			int *existing_index_ptr = tile_vertex_to_native_index.getptr(vertex);
+			if (!existing_index_ptr) {
+				int new_index = nav_vertices.size();
+				tile_index_to_native_index[i] = new_index;
+				tile_vertex_to_native_index[vertex] = new_index;
+				nav_vertices.push_back(vertex);
+			} else {
+				tile_index_to_native_index[i] = *existing_index_ptr;
+			}
+		}
+		for (const Vector<int> &polygon : tile.polygons) {
+			Vector<int> nav_indices;
+			nav_indices.resize(polygon.size());
+			for (int i = 0; i < polygon.size(); i++) {
+				nav_indices.write[i] = tile_index_to_native_index[polygon[i]];
+			}
+			nav_polygons.push_back(nav_indices);
+		}
+
+		tile.tris.clear();
+		tile_cache->tiles.insert(tile.coords, std::move(tile));
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
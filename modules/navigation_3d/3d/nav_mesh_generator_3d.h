@@ -40,6 +40,7 @@
 class Node;
 class NavigationMesh;
 class NavigationMeshSourceGeometryData3D;
+struct rcConfig;
 
 class NavMeshGenerator3D : public Object {
 	static NavMeshGenerator3D *singleton;
@@ -76,9 +77,22 @@ class NavMeshGenerator3D : public Object {
 
 	static HashSet<Ref<NavigationMesh>> baking_navmeshes;
 
+	// Baked tiles of navigation meshes with a tile size, to only rebake the tiles whose input changed.
+	struct NavMeshBakeTile3D;
+	struct NavMeshTileCache3D;
+	struct NavMeshTileBakeTask3D;
+
+	static Mutex tile_cache_mutex;
+	static HashMap<ObjectID, NavMeshTileCache3D *> tile_caches;
+
+	static void generator_thread_bake_tile(void *p_arg, uint32_t p_index);
+	static void generator_erase_tile_cache(ObjectID p_navigation_mesh_id);
+
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data);
+	static void generator_bake_tiles(Ref<NavigationMesh> p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions);
+	static bool generator_bake_heightfield(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
 
 	static bool generator_emit_callback(const Callable &p_callback);
 
@@ -96,6 +110,9 @@ public:
 	static void bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
 
+	// Number of tiles the last tiled bake of the navigation mesh baked instead of taking from its cache.
+	static uint32_t get_rebaked_tile_count(const Ref<NavigationMesh> &p_navigation_mesh);
+
 	NavMeshGenerator3D();
 	~NavMeshGenerator3D();
 };
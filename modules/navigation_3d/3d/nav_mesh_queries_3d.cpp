@@ -33,6 +33,7 @@
 #include "nav_mesh_queries_3d.h"
 
 #include "../nav_base_3d.h"
+#include "../nav_link_3d.h"
 #include "../nav_map_3d.h"
 #include "nav_region_iteration_3d.h"
 
@@ -152,13 +153,21 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	ERR_FAIL_COND(p_query_parameters.is_null());
 	ERR_FAIL_COND(p_query_result.is_null());
 
-	using namespace NavigationUtilities;
-
 	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
 	query_task.callback = p_callback;
+	query_task_set_parameters(query_task, p_query_parameters);
+
+	map->query_path(query_task);
+
+	query_task_apply_result(query_task, p_query_result);
+}
+
+void NavMeshQueries3D::query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
+	using namespace NavigationUtilities;
+
+	p_query_task.start_position = p_query_parameters->get_start_position();
+	p_query_task.target_position = p_query_parameters->get_target_position();
+	p_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -166,67 +175,69 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	p_query_task.exclude_regions = _excluded_region_count > 0;
+	p_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
-		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
-		}
+	p_query_task.excluded_regions.resize(_excluded_region_count);
+	for (uint32_t i = 0; i < _excluded_region_count; i++) {
+		p_query_task.excluded_regions[i] = _excluded_regions[i];
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
-		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
-		}
+	p_query_task.included_regions.resize(_included_region_count);
+	for (uint32_t i = 0; i < _included_region_count; i++) {
+		p_query_task.included_regions[i] = _included_regions[i];
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
-	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+	p_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	p_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	p_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
 
-	map->query_path(query_task);
+	// Tasks may be reused, so clear what the previous query found.
+	p_query_task.begin_polygon = nullptr;
+	p_query_task.end_polygon = nullptr;
+	p_query_task.least_cost_id = 0;
+	p_query_task.path_clear();
+}
 
+void NavMeshQueries3D::query_task_apply_result(NavMeshPathQueryTask3D &p_query_task, Ref<NavigationPathQueryResult3D> p_query_result) {
 	p_query_result->set_data(
-			query_task.path_points,
-			query_task.path_meta_point_types,
-			query_task.path_meta_point_rids,
-			query_task.path_meta_point_owners);
-
-	if (query_task.callback.is_valid()) {
-		if (emit_callback(query_task.callback)) {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
+			p_query_task.path_points,
+			p_query_task.path_meta_point_types,
+			p_query_task.path_meta_point_rids,
+			p_query_task.path_meta_point_owners);
+
+	if (p_query_task.callback.is_valid()) {
+		if (emit_callback(p_query_task.callback)) {
+			p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
 		} else {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
+			p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
 		}
 	}
 }
@@ -280,7 +291,88 @@ void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask
 	}
 }
 
-void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task) {
+bool NavMeshQueries3D::_query_task_find_cluster_route(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Polygon *p_begin_poly, const Polygon *p_end_poly, const Vector3 &p_end_point) {
+	const LocalVector<uint32_t> &polygon_clusters = p_map_iteration.polygon_clusters;
+	const LocalVector<Vector3> &cluster_positions = p_map_iteration.cluster_positions;
+	const LocalVector<uint32_t> &cluster_neighbor_offsets = p_map_iteration.cluster_neighbor_offsets;
+	const LocalVector<uint32_t> &cluster_neighbors = p_map_iteration.cluster_neighbors;
+
+	LocalVector<NavigationCluster> &clusters = p_query_task.path_query_slot->cluster_route;
+	if (cluster_positions.is_empty() || clusters.size() != cluster_positions.size()) {
+		return false;
+	}
+
+	const uint32_t begin_cluster_id = polygon_clusters[p_begin_poly->id];
+	const uint32_t end_cluster_id = polygon_clusters[p_end_poly->id];
+	if (begin_cluster_id == end_cluster_id) {
+		// Nothing to gain over the regular search.
+		return false;
+	}
+
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>
+			&traversable_clusters = p_query_task.path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		clusters[i].reset();
+		clusters[i].id = i;
+	}
+
+	NavigationCluster &begin_cluster = clusters[begin_cluster_id];
+	begin_cluster.traveled_distance = 0.0;
+	begin_cluster.distance_to_destination = cluster_positions[begin_cluster_id].distance_to(p_end_point);
+	traversable_clusters.push(&begin_cluster);
+
+	// A* over the cluster graph. The graph ignores layers, region filters and travel costs,
+	// the polygon search that follows takes care of those.
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		const NavigationCluster *least_cost_cluster = traversable_clusters.pop();
+		const uint32_t cluster_id = least_cost_cluster->id;
+		if (cluster_id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+
+		const Vector3 &cluster_position = cluster_positions[cluster_id];
+		for (uint32_t i = cluster_neighbor_offsets[cluster_id]; i < cluster_neighbor_offsets[cluster_id + 1]; i++) {
+			NavigationCluster &neighbor_cluster = clusters[cluster_neighbors[i]];
+			const Vector3 &neighbor_position = cluster_positions[neighbor_cluster.id];
+			const real_t new_traveled_distance = least_cost_cluster->traveled_distance + cluster_position.distance_to(neighbor_position);
+			if (new_traveled_distance < neighbor_cluster.traveled_distance) {
+				neighbor_cluster.back_cluster_id = cluster_id;
+				neighbor_cluster.traveled_distance = new_traveled_distance;
+				neighbor_cluster.distance_to_destination = neighbor_position.distance_to(p_end_point);
+
+				if (neighbor_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_cluster);
+				}
+			}
+		}
+	}
+	traversable_clusters.clear();
+
+	if (!found_route) {
+		return false;
+	}
+
+	// Open the clusters along the route and their direct neighbors, so the polygon search
+	// has room to find a path close to the optimal one near cluster borders.
+	uint32_t cluster_id = end_cluster_id;
+	while (cluster_id != UINT32_MAX) {
+		clusters[cluster_id].in_route = true;
+		for (uint32_t i = cluster_neighbor_offsets[cluster_id]; i < cluster_neighbor_offsets[cluster_id + 1]; i++) {
+			clusters[cluster_neighbors[i]].in_route = true;
+		}
+		cluster_id = clusters[cluster_id].back_cluster_id;
+	}
+
+	return true;
+}
+
+void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
 	const Polygon *end_poly = p_query_task.end_polygon;
@@ -314,6 +406,11 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	bool is_reachable = true;
 	real_t poly_enter_cost = 0.0;
 
+	// Restrict the search to the clusters along a coarse route when the map has a cluster graph.
+	const LocalVector<uint32_t> &polygon_clusters = p_map_iteration.polygon_clusters;
+	const LocalVector<NavigationCluster> &cluster_route = p_query_task.path_query_slot->cluster_route;
+	bool use_cluster_route = _query_task_find_cluster_route(p_query_task, p_map_iteration, begin_poly, end_poly, end_point);
+
 	while (true) {
 		const NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 		real_t poly_travel_cost = least_cost_poly.poly->owner->get_travel_cost();
@@ -330,6 +427,10 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 					continue;
 				}
 
+				if (use_cluster_route && !cluster_route[polygon_clusters[connection.polygon->id]].in_route) {
+					continue;
+				}
+
 				const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, connection.pathway_start, connection.pathway_end);
 				const real_t new_traveled_distance = least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + poly_enter_cost + least_cost_poly.traveled_distance;
 
@@ -361,6 +462,24 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (use_cluster_route) {
+				// The end polygon is not reachable through the route clusters, e.g. because of
+				// layers or region filters. Search again on the whole map before giving up.
+				use_cluster_route = false;
+				for (NavigationPoly &polygon : navigation_polys) {
+					polygon.reset();
+				}
+				begin_navigation_poly.poly = begin_poly;
+				begin_navigation_poly.entry = begin_point;
+				begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
+				begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
+				begin_navigation_poly.traveled_distance = 0.f;
+				least_cost_id = begin_poly->id;
+				reachable_end = nullptr;
+				distance_to_reachable_end = FLT_MAX;
+				continue;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -485,7 +604,7 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task);
+	_query_task_build_path_corridor(p_query_task, p_map_iteration);
 
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		return;
@@ -936,6 +1055,179 @@ Vector3 NavMeshQueries3D::map_iteration_get_random_point(const NavMapIteration3D
 	}
 }
 
+void NavMeshQueries3D::map_iteration_get_flow_field(const NavMapIteration3D &p_map_iteration, const Vector3 &p_target_position, uint32_t p_navigation_layers, Ref<NavigationFlowField3D> r_flow_field) {
+	ERR_FAIL_COND(r_flow_field.is_null());
+	r_flow_field->reset();
+
+	const uint32_t polygon_count = p_map_iteration.navmesh_polygon_count;
+
+	// Gather the usable polygons by id. Only region polygons can be stood on, so only
+	// their vertices are stored in the field.
+	LocalVector<const Polygon *> polygons;
+	polygons.resize(polygon_count);
+	LocalVector<uint32_t> polygon_vertex_offsets;
+	polygon_vertex_offsets.resize(polygon_count + 1);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		polygons[i] = nullptr;
+		polygon_vertex_offsets[i + 1] = 0;
+	}
+	polygon_vertex_offsets[0] = 0;
+
+	const Polygon *target_polygon = nullptr;
+	Vector3 target_point;
+	real_t target_distance = FLT_MAX;
+
+	for (const NavRegionIteration3D &region : p_map_iteration.region_iterations) {
+		if (!region.get_enabled() || (p_navigation_layers & region.get_navigation_layers()) == 0) {
+			continue;
+		}
+		for (const Polygon &polygon : region.get_navmesh_polygons()) {
+			polygons[polygon.id] = &polygon;
+			polygon_vertex_offsets[polygon.id + 1] = polygon.vertices.size();
+
+			for (uint32_t point_id = 2; point_id < polygon.vertices.size(); point_id++) {
+				const Face3 face(polygon.vertices[0], polygon.vertices[point_id - 1], polygon.vertices[point_id]);
+				const Vector3 point = face.get_closest_point_to(p_target_position);
+				const real_t distance = point.distance_to(p_target_position);
+				if (distance < target_distance) {
+					target_distance = distance;
+					target_polygon = &polygon;
+					target_point = point;
+				}
+			}
+		}
+	}
+	for (const NavLinkIteration3D &link : p_map_iteration.link_iterations) {
+		if (!link.get_enabled() || (p_navigation_layers & link.get_navigation_layers()) == 0) {
+			continue;
+		}
+		for (const Polygon &polygon : link.get_navmesh_polygons()) {
+			polygons[polygon.id] = &polygon;
+		}
+	}
+
+	if (target_polygon == nullptr) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		polygon_vertex_offsets[i + 1] += polygon_vertex_offsets[i];
+	}
+	LocalVector<Vector3> polygon_vertices;
+	polygon_vertices.resize(polygon_vertex_offsets[polygon_count]);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		if (polygon_vertex_offsets[i] == polygon_vertex_offsets[i + 1]) {
+			continue;
+		}
+		memcpy(polygon_vertices.ptr() + polygon_vertex_offsets[i], polygons[i]->vertices.ptr(), polygons[i]->vertices.size() * sizeof(Vector3));
+	}
+
+	// The search runs from the target outwards, so it needs the connections reversed.
+	LocalVector<uint32_t> incoming_offsets;
+	incoming_offsets.resize(polygon_count + 1);
+	for (uint32_t &offset : incoming_offsets) {
+		offset = 0;
+	}
+	for (const Polygon *polygon : polygons) {
+		if (polygon == nullptr) {
+			continue;
+		}
+		for (const Edge &edge : polygon->edges) {
+			for (const Edge::Connection &connection : edge.connections) {
+				if (polygons[connection.polygon->id] != nullptr) {
+					incoming_offsets[connection.polygon->id + 1]++;
+				}
+			}
+		}
+	}
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		incoming_offsets[i + 1] += incoming_offsets[i];
+	}
+	LocalVector<const Edge::Connection *> incoming_connections;
+	LocalVector<uint32_t> incoming_polygons;
+	incoming_connections.resize(incoming_offsets[polygon_count]);
+	incoming_polygons.resize(incoming_offsets[polygon_count]);
+	{
+		LocalVector<uint32_t> incoming_fill = incoming_offsets;
+		for (const Polygon *polygon : polygons) {
+			if (polygon == nullptr) {
+				continue;
+			}
+			for (const Edge &edge : polygon->edges) {
+				for (const Edge::Connection &connection : edge.connections) {
+					if (polygons[connection.polygon->id] != nullptr) {
+						const uint32_t index = incoming_fill[connection.polygon->id]++;
+						incoming_connections[index] = &connection;
+						incoming_polygons[index] = polygon->id;
+					}
+				}
+			}
+		}
+	}
+
+	// Dijkstra from the target. The entry of each polygon is the point it leads to, which is
+	// the closest point of the connection pathway to the entry of the polygon after it.
+	LocalVector<NavigationPoly> navigation_polys;
+	navigation_polys.resize(polygon_count);
+	for (NavigationPoly &navigation_poly : navigation_polys) {
+		navigation_poly.reset();
+	}
+	Heap<NavigationPoly *, NavPolyTravelCostGreaterThan, NavPolyHeapIndexer> traversable_polys;
+	traversable_polys.reserve(polygon_count * 0.25);
+
+	NavigationPoly &target_navigation_poly = navigation_polys[target_polygon->id];
+	target_navigation_poly.poly = target_polygon;
+	target_navigation_poly.entry = target_point;
+	target_navigation_poly.traveled_distance = 0.0;
+	traversable_polys.push(&target_navigation_poly);
+
+	while (!traversable_polys.is_empty()) {
+		const NavigationPoly &least_cost_poly = *traversable_polys.pop();
+		const NavBaseIteration3D *owner = least_cost_poly.poly->owner;
+		const real_t poly_travel_cost = owner->get_travel_cost();
+
+		for (uint32_t i = incoming_offsets[least_cost_poly.poly->id]; i < incoming_offsets[least_cost_poly.poly->id + 1]; i++) {
+			const Edge::Connection &connection = *incoming_connections[i];
+			NavigationPoly &neighbor_poly = navigation_polys[incoming_polygons[i]];
+			const Polygon *neighbor_polygon = polygons[incoming_polygons[i]];
+
+			const Vector3 waypoint = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, connection.pathway_start, connection.pathway_end);
+			real_t new_traveled_distance = waypoint.distance_to(least_cost_poly.entry) * poly_travel_cost + least_cost_poly.traveled_distance;
+			if (neighbor_polygon->owner->get_self() != owner->get_self()) {
+				new_traveled_distance += owner->get_enter_cost();
+			}
+
+			if (new_traveled_distance < neighbor_poly.traveled_distance) {
+				neighbor_poly.back_navigation_poly_id = least_cost_poly.poly->id;
+				neighbor_poly.traveled_distance = new_traveled_distance;
+				neighbor_poly.entry = waypoint;
+
+				if (neighbor_poly.traversable_poly_index != traversable_polys.INVALID_INDEX) {
+					traversable_polys.shift(neighbor_poly.traversable_poly_index);
+				} else {
+					neighbor_poly.poly = neighbor_polygon;
+					traversable_polys.push(&neighbor_poly);
+				}
+			}
+		}
+	}
+
+	LocalVector<Vector3> polygon_waypoints;
+	LocalVector<uint32_t> polygon_next;
+	LocalVector<real_t> polygon_costs;
+	polygon_waypoints.resize(polygon_count);
+	polygon_next.resize(polygon_count);
+	polygon_costs.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const NavigationPoly &navigation_poly = navigation_polys[i];
+		polygon_waypoints[i] = navigation_poly.entry;
+		polygon_next[i] = navigation_poly.back_navigation_poly_id < 0 ? UINT32_MAX : uint32_t(navigation_poly.back_navigation_poly_id);
+		polygon_costs[i] = navigation_poly.traveled_distance;
+	}
+
+	r_flow_field->set_data(p_target_position, std::move(polygon_vertices), std::move(polygon_vertex_offsets), std::move(polygon_waypoints), std::move(polygon_next), std::move(polygon_costs));
+}
+
 Vector3 NavMeshQueries3D::polygons_get_closest_point_to_segment(const LocalVector<Polygon> &p_polygons, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) {
 	bool use_collision = p_use_collision;
 	Vector3 closest_point;
@@ -34,6 +34,7 @@
 
 #include "../nav_utils_3d.h"
 
+#include "servers/navigation/navigation_flow_field_3d.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
 #include "servers/navigation/navigation_path_query_result_3d.h"
 #include "servers/navigation/navigation_utilities.h"
@@ -48,6 +49,8 @@ public:
 	struct PathQuerySlot {
 		LocalVector<Nav3D::NavigationPoly> path_corridor;
 		Heap<Nav3D::NavigationPoly *, Nav3D::NavPolyTravelCostGreaterThan, Nav3D::NavPolyHeapIndexer> traversable_polys;
+		LocalVector<Nav3D::NavigationCluster> cluster_route;
+		Heap<Nav3D::NavigationCluster *, Nav3D::NavClusterTravelCostGreaterThan, Nav3D::NavClusterHeapIndexer> traversable_clusters;
 		bool in_use = false;
 		uint32_t slot_index = 0;
 	};
@@ -129,13 +132,17 @@ public:
 	static RID map_iteration_get_closest_point_owner(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Nav3D::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
+	static void map_iteration_get_flow_field(const NavMapIteration3D &p_map_iteration, const Vector3 &p_target_position, uint32_t p_navigation_layers, Ref<NavigationFlowField3D> r_flow_field);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
 
+	static void query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
+	static void query_task_apply_result(NavMeshPathQueryTask3D &p_query_task, Ref<NavigationPathQueryResult3D> p_query_result);
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
-	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task);
+	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_find_cluster_route(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::Polygon *p_begin_poly, const Nav3D::Polygon *p_end_poly, const Vector3 &p_end_point);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask3D &p_query_task);
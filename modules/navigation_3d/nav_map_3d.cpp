@@ -128,6 +128,27 @@ void NavMap3D::set_link_connection_radius(real_t p_link_connection_radius) {
 	iteration_dirty = true;
 }
 
+void NavMap3D::set_hierarchical_cluster_size(real_t p_cluster_size) {
+	p_cluster_size = MAX(p_cluster_size, 0.0);
+	if (hierarchical_cluster_size == p_cluster_size) {
+		return;
+	}
+	hierarchical_cluster_size = p_cluster_size;
+	iteration_dirty = true;
+}
+
+void NavMap3D::set_avoidance_lod_origin(const Vector3 &p_origin) {
+	avoidance_lod_origin = p_origin;
+}
+
+void NavMap3D::set_avoidance_lod_distance(real_t p_distance) {
+	avoidance_lod_distance = MAX(p_distance, 0.0);
+}
+
+void NavMap3D::set_avoidance_lod_update_interval(uint32_t p_interval) {
+	avoidance_lod_update_interval = MAX(p_interval, 1u);
+}
+
 const Vector3 &NavMap3D::get_merge_rasterizer_cell_size() const {
 	return merge_rasterizer_cell_size;
 }
@@ -332,6 +353,12 @@ Vector3 NavMap3D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries3D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+void NavMap3D::get_flow_field(const Vector3 &p_target_position, uint32_t p_navigation_layers, Ref<NavigationFlowField3D> r_flow_field) const {
+	GET_MAP_ITERATION_CONST();
+
+	NavMeshQueries3D::map_iteration_get_flow_field(map_iteration, p_target_position, p_navigation_layers, r_flow_field);
+}
+
 void NavMap3D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
@@ -366,6 +393,7 @@ void NavMap3D::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.hierarchical_cluster_size = get_hierarchical_cluster_size();
 
 	uint32_t enabled_region_count = 0;
 	uint32_t enabled_link_count = 0;
@@ -605,51 +633,88 @@ void NavMap3D::_update_rvo_simulation() {
 	}
 }
 
-void NavMap3D::compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-	(*(agent + index))->update();
+bool NavMap3D::_is_avoidance_agent_due(const NavAgent3D *p_agent, uint32_t p_index) const {
+	if (avoidance_lod_distance <= 0.0 || avoidance_lod_update_interval <= 1) {
+		return true;
+	}
+	if (p_agent->get_position().distance_squared_to(avoidance_lod_origin) <= avoidance_lod_distance * avoidance_lod_distance) {
+		return true;
+	}
+	// Stagger the distant agents so that each step only updates a share of them.
+	return (avoidance_step_count + p_index) % avoidance_lod_update_interval == 0;
 }
 
-void NavMap3D::compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-	(*(agent + index))->update();
+void NavMap3D::compute_avoidance_batch_2d(uint32_t p_batch_index, NavAgent3D **p_agents) {
+	const uint32_t agent_index_begin = p_batch_index * AVOIDANCE_AGENT_BATCH_SIZE;
+	const uint32_t agent_index_end = MIN(agent_index_begin + AVOIDANCE_AGENT_BATCH_SIZE, active_2d_avoidance_agents.size());
+	for (uint32_t agent_index = agent_index_begin; agent_index < agent_index_end; agent_index++) {
+		RVO2D::Agent2D *rvo_agent = p_agents[agent_index]->get_rvo_agent_2d();
+		if (!_is_avoidance_agent_due(p_agents[agent_index], agent_index)) {
+			// Follow the current preferred velocity rather than the avoidance result of an older step.
+			rvo_agent->newVelocity_ = RVO2D::absSq(rvo_agent->prefVelocity_) > rvo_agent->maxSpeed_ * rvo_agent->maxSpeed_ ? RVO2D::normalize(rvo_agent->prefVelocity_) * rvo_agent->maxSpeed_ : rvo_agent->prefVelocity_;
+			continue;
+		}
+		rvo_agent->computeNeighbors(&rvo_simulation_2d);
+		rvo_agent->computeNewVelocity(&rvo_simulation_2d);
+	}
+}
+
+void NavMap3D::compute_avoidance_batch_3d(uint32_t p_batch_index, NavAgent3D **p_agents) {
+	const uint32_t agent_index_begin = p_batch_index * AVOIDANCE_AGENT_BATCH_SIZE;
+	const uint32_t agent_index_end = MIN(agent_index_begin + AVOIDANCE_AGENT_BATCH_SIZE, active_3d_avoidance_agents.size());
+	for (uint32_t agent_index = agent_index_begin; agent_index < agent_index_end; agent_index++) {
+		RVO3D::Agent3D *rvo_agent = p_agents[agent_index]->get_rvo_agent_3d();
+		if (!_is_avoidance_agent_due(p_agents[agent_index], agent_index)) {
+			// Follow the current preferred velocity rather than the avoidance result of an older step.
+			rvo_agent->newVelocity_ = RVO3D::absSq(rvo_agent->prefVelocity_) > rvo_agent->maxSpeed_ * rvo_agent->maxSpeed_ ? RVO3D::normalize(rvo_agent->prefVelocity_) * rvo_agent->maxSpeed_ : rvo_agent->prefVelocity_;
+			continue;
+		}
+		rvo_agent->computeNeighbors(&rvo_simulation_3d);
+		rvo_agent->computeNewVelocity(&rvo_simulation_3d);
+	}
 }
 
 void NavMap3D::step(double p_delta_time) {
 	rvo_simulation_2d.setTimeStep(float(p_delta_time));
 	rvo_simulation_3d.setTimeStep(float(p_delta_time));
 
+	// New velocities are computed for all agents before any agent moves, so the
+	// agent trees and the neighbor states stay read-only while the batches run.
 	if (active_2d_avoidance_agents.size() > 0) {
-		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+		const uint32_t batch_count = Math::division_round_up(active_2d_avoidance_agents.size(), AVOIDANCE_AGENT_BATCH_SIZE);
+		if (use_threads && avoidance_use_multiple_threads && batch_count > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_avoidance_batch_2d, active_2d_avoidance_agents.ptr(), batch_count, -1, avoidance_use_high_priority_threads, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent3D *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
+			for (uint32_t batch_index = 0; batch_index < batch_count; batch_index++) {
+				compute_avoidance_batch_2d(batch_index, active_2d_avoidance_agents.ptr());
 			}
 		}
+
+		for (NavAgent3D *agent : active_2d_avoidance_agents) {
+			agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+			agent->update();
+		}
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
-		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+		const uint32_t batch_count = Math::division_round_up(active_3d_avoidance_agents.size(), AVOIDANCE_AGENT_BATCH_SIZE);
+		if (use_threads && avoidance_use_multiple_threads && batch_count > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_avoidance_batch_3d, active_3d_avoidance_agents.ptr(), batch_count, -1, avoidance_use_high_priority_threads, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent3D *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-				agent->update();
+			for (uint32_t batch_index = 0; batch_index < batch_count; batch_index++) {
+				compute_avoidance_batch_3d(batch_index, active_3d_avoidance_agents.ptr());
 			}
 		}
+
+		for (NavAgent3D *agent : active_3d_avoidance_agents) {
+			agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+			agent->update();
+		}
 	}
+
+	avoidance_step_count++;
 }
 
 void NavMap3D::dispatch_callbacks() {
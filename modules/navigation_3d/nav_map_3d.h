@@ -73,6 +73,9 @@ class NavMap3D : public NavRid3D {
 	/// This value is used to limit how far links search to find polygons to connect to.
 	real_t link_connection_radius = NavigationDefaults3D::link_connection_radius;
 
+	/// Size of the grid cells that group polygons for hierarchical pathfinding, 0 disables it.
+	real_t hierarchical_cluster_size = 0.0;
+
 	bool map_settings_dirty = true;
 
 	/// Map regions
@@ -108,6 +111,16 @@ class NavMap3D : public NavRid3D {
 	bool avoidance_use_multiple_threads = true;
 	bool avoidance_use_high_priority_threads = true;
 
+	/// Avoidance agents are stepped in batches of this many agents per thread task.
+	static constexpr uint32_t AVOIDANCE_AGENT_BATCH_SIZE = 64;
+
+	/// Agents further than the LOD distance from the LOD origin only compute new
+	/// avoidance velocities every LOD update interval steps.
+	Vector3 avoidance_lod_origin;
+	real_t avoidance_lod_distance = 0.0;
+	uint32_t avoidance_lod_update_interval = 4;
+	uint64_t avoidance_step_count = 0;
+
 	// Performance Monitor
 	Nav3D::PerformanceData performance_data;
 
@@ -143,6 +156,7 @@ public:
 	~NavMap3D();
 
 	uint32_t get_iteration_id() const { return iteration_id; }
+	int get_path_query_slots_max() const { return path_query_slots_max; }
 
 	void set_up(Vector3 p_up);
 	Vector3 get_up() const {
@@ -177,6 +191,26 @@ public:
 		return link_connection_radius;
 	}
 
+	void set_hierarchical_cluster_size(real_t p_cluster_size);
+	real_t get_hierarchical_cluster_size() const {
+		return hierarchical_cluster_size;
+	}
+
+	void set_avoidance_lod_origin(const Vector3 &p_origin);
+	const Vector3 &get_avoidance_lod_origin() const {
+		return avoidance_lod_origin;
+	}
+
+	void set_avoidance_lod_distance(real_t p_distance);
+	real_t get_avoidance_lod_distance() const {
+		return avoidance_lod_distance;
+	}
+
+	void set_avoidance_lod_update_interval(uint32_t p_interval);
+	uint32_t get_avoidance_lod_update_interval() const {
+		return avoidance_lod_update_interval;
+	}
+
 	Nav3D::PointKey get_point_key(const Vector3 &p_pos) const;
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
@@ -218,6 +252,7 @@ public:
 	}
 
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
+	void get_flow_field(const Vector3 &p_target_position, uint32_t p_navigation_layers, Ref<NavigationFlowField3D> r_flow_field) const;
 
 	void sync();
 	void step(double p_delta_time);
@@ -257,8 +292,9 @@ private:
 
 	void compute_single_step(uint32_t index, NavAgent3D **agent);
 
-	void compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent);
-	void compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent);
+	bool _is_avoidance_agent_due(const NavAgent3D *p_agent, uint32_t p_index) const;
+	void compute_avoidance_batch_2d(uint32_t p_batch_index, NavAgent3D **p_agents);
+	void compute_avoidance_batch_3d(uint32_t p_batch_index, NavAgent3D **p_agents);
 
 	void _sync_avoidance();
 	void _update_rvo_simulation();
@@ -174,6 +174,46 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+/// A node of the coarse cluster graph search used by hierarchical pathfinding.
+struct NavigationCluster {
+	/// Id of the cluster in the map iteration.
+	uint32_t id = UINT32_MAX;
+
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	uint32_t back_cluster_id = UINT32_MAX;
+	real_t traveled_distance = FLT_MAX;
+	real_t distance_to_destination = 0.0;
+
+	/// Whether polygons in this cluster may be expanded by the polygon search.
+	bool in_route = false;
+
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_cluster_id = UINT32_MAX;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+		in_route = false;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		return p_cluster_a->total_travel_cost() > p_cluster_b->total_travel_cost();
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
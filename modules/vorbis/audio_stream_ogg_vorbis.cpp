@@ -32,6 +32,8 @@
 
 #include "audio_stream_ogg_vorbis.h"
 
+#include "servers/audio/audio_decoded_cache.h"
+
 #include <ogg/ogg.h>
 
 int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_frames) {
@@ -144,6 +146,9 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 
 int AudioStreamPlaybackOggVorbis::_mix_frames_vorbis(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND_V(!ready, p_frames);
+	if (!decoded_frames.is_empty()) {
+		return _mix_frames_decoded(p_buffer, p_frames);
+	}
 	if (!have_samples_left) {
 		ogg_packet *packet = nullptr;
 		int err;
@@ -188,6 +193,17 @@ int AudioStreamPlaybackOggVorbis::_mix_frames_vorbis(AudioFrame *p_buffer, int p
 	return frames;
 }
 
+int AudioStreamPlaybackOggVorbis::_mix_frames_decoded(AudioFrame *p_buffer, int p_frames) {
+	int frames = MIN(p_frames, decoded_frames.size() - (int)decoded_position);
+	memcpy(p_buffer, decoded_frames.ptr() + decoded_position, sizeof(AudioFrame) * frames);
+	decoded_position += frames;
+
+	// Mirror the decoder state so _mix_internal() handles the end of the stream the same way.
+	have_samples_left = false;
+	have_packets_left = decoded_position < (uint32_t)decoded_frames.size();
+	return frames;
+}
+
 float AudioStreamPlaybackOggVorbis::get_stream_sampling_rate() {
 	return vorbis_data->get_sampling_rate();
 }
@@ -288,6 +304,13 @@ void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 
 	frames_mixed = uint32_t(vorbis_data->get_sampling_rate() * p_time);
 
+	if (!decoded_frames.is_empty()) {
+		decoded_position = MIN(frames_mixed, (uint32_t)decoded_frames.size());
+		have_samples_left = false;
+		have_packets_left = decoded_position < (uint32_t)decoded_frames.size();
+		return;
+	}
+
 	const int64_t desired_sample = p_time * get_stream_sampling_rate();
 
 	if (!vorbis_data_playback->seek_page(desired_sample)) {
@@ -419,6 +442,14 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	ovs->frames_mixed = 0;
 	ovs->active = false;
 	ovs->loops = 0;
+
+	ovs->decoded_frames = _get_decoded_frames();
+	if (!ovs->decoded_frames.is_empty()) {
+		// Plays from memory, no decoder needed.
+		ovs->ready = true;
+		return ovs;
+	}
+
 	if (ovs->_alloc_vorbis()) {
 		return ovs;
 	}
@@ -426,6 +457,104 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	return nullptr;
 }
 
+// Holds its own playback, so the stream's packet sequence can be replaced while decoding.
+class AudioStreamOggVorbis::CacheDecoder : public AudioDecodedCache::Decoder {
+public:
+	Ref<AudioStreamPlaybackOggVorbis> playback;
+	int frame_count = 0;
+
+	virtual Vector<AudioFrame> decode() override {
+		return AudioStreamOggVorbis::_decode_frames(playback, frame_count);
+	}
+};
+
+Ref<AudioStreamPlaybackOggVorbis> AudioStreamOggVorbis::_instantiate_decoder() {
+	Ref<AudioStreamPlaybackOggVorbis> decoder;
+	decoder.instantiate();
+	decoder->vorbis_stream = Ref<AudioStreamOggVorbis>(this);
+	decoder->vorbis_data = packet_sequence;
+	ERR_FAIL_COND_V(!decoder->_alloc_vorbis(), Ref<AudioStreamPlaybackOggVorbis>());
+	decoder->looping_override = true;
+	decoder->looping = false;
+	decoder->active = true;
+	return decoder;
+}
+
+Vector<AudioFrame> AudioStreamOggVorbis::_decode_frames() {
+	Ref<AudioStreamPlaybackOggVorbis> decoder = _instantiate_decoder();
+	if (decoder.is_null()) {
+		return Vector<AudioFrame>();
+	}
+	return _decode_frames(decoder, int(get_length() * packet_sequence->get_sampling_rate()));
+}
+
+Vector<AudioFrame> AudioStreamOggVorbis::_decode_frames(const Ref<AudioStreamPlaybackOggVorbis> &p_decoder, int p_frame_count) {
+	Vector<AudioFrame> frames;
+
+	const int chunk_size = 4096;
+	int frame_count = 0;
+	frames.resize(MAX(p_frame_count, 0) + chunk_size);
+	while (p_decoder->active) {
+		if (frames.size() < frame_count + chunk_size) {
+			frames.resize(frames.size() * 2);
+		}
+		int mixed = p_decoder->_mix_internal(frames.ptrw() + frame_count, chunk_size);
+		if (mixed <= 0) {
+			break;
+		}
+		frame_count += mixed;
+	}
+	frames.resize(frame_count);
+	return frames;
+}
+
+Vector<AudioFrame> AudioStreamOggVorbis::_get_decoded_frames() {
+	if (!decompressed_frames.is_empty()) {
+		return decompressed_frames;
+	}
+
+	Vector<AudioFrame> frames;
+	AudioDecodedCache *cache = AudioDecodedCache::get_singleton();
+	if (!cache || !cache->is_cacheable(get_length())) {
+		return frames;
+	}
+	if (cache->lookup(get_instance_id(), frames) || cache->is_decoding(get_instance_id())) {
+		return frames;
+	}
+
+	// Decoded in the background, so the first playbacks stream instead of stalling the calling thread.
+	Ref<AudioStreamPlaybackOggVorbis> playback = _instantiate_decoder();
+	if (playback.is_valid()) {
+		CacheDecoder *decoder = memnew(CacheDecoder);
+		decoder->playback = playback;
+		decoder->frame_count = int(get_length() * packet_sequence->get_sampling_rate());
+		cache->decode(get_instance_id(), decoder);
+	}
+	return frames;
+}
+
+void AudioStreamOggVorbis::_update_decompressed_frames() {
+	if (AudioDecodedCache::get_singleton()) {
+		AudioDecodedCache::get_singleton()->erase(get_instance_id());
+	}
+	decompressed_frames.clear();
+	if (decompress_in_memory && packet_sequence.is_valid()) {
+		decompressed_frames = _decode_frames();
+	}
+}
+
+void AudioStreamOggVorbis::set_decompress_in_memory(bool p_enable) {
+	if (decompress_in_memory == p_enable) {
+		return;
+	}
+	decompress_in_memory = p_enable;
+	_update_decompressed_frames();
+}
+
+bool AudioStreamOggVorbis::is_decompress_in_memory() const {
+	return decompress_in_memory;
+}
+
 String AudioStreamOggVorbis::get_stream_name() const {
 	return ""; //return stream_name;
 }
@@ -469,6 +598,7 @@ void AudioStreamOggVorbis::set_packet_sequence(Ref<OggPacketSequence> p_packet_s
 	if (packet_sequence.is_valid()) {
 		maybe_update_info();
 	}
+	_update_decompressed_frames();
 }
 
 Ref<OggPacketSequence> AudioStreamOggVorbis::get_packet_sequence() const {
@@ -483,6 +613,12 @@ bool AudioStreamOggVorbis::has_loop() const {
 	return loop;
 }
 
+bool AudioStreamOggVorbis::get_loop_range(double &r_loop_begin, double &r_loop_end) const {
+	r_loop_begin = loop ? loop_offset : 0.0;
+	r_loop_end = loop ? get_length() : -1.0;
+	return true;
+}
+
 void AudioStreamOggVorbis::set_loop_offset(double p_seconds) {
 	loop_offset = p_seconds;
 }
@@ -679,6 +815,9 @@ void AudioStreamOggVorbis::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_packet_sequence", "packet_sequence"), &AudioStreamOggVorbis::set_packet_sequence);
 	ClassDB::bind_method(D_METHOD("get_packet_sequence"), &AudioStreamOggVorbis::get_packet_sequence);
 
+	ClassDB::bind_method(D_METHOD("set_decompress_in_memory", "enable"), &AudioStreamOggVorbis::set_decompress_in_memory);
+	ClassDB::bind_method(D_METHOD("is_decompress_in_memory"), &AudioStreamOggVorbis::is_decompress_in_memory);
+
 	ClassDB::bind_method(D_METHOD("set_loop", "enable"), &AudioStreamOggVorbis::set_loop);
 	ClassDB::bind_method(D_METHOD("has_loop"), &AudioStreamOggVorbis::has_loop);
 
@@ -700,8 +839,13 @@ void AudioStreamOggVorbis::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "bar_beats", PropertyHint::HINT_RANGE, "2,32,1,or_greater"), "set_bar_beats", "get_bar_beats");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "has_loop");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "loop_offset"), "set_loop_offset", "get_loop_offset");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "decompress_in_memory"), "set_decompress_in_memory", "is_decompress_in_memory");
 }
 
 AudioStreamOggVorbis::AudioStreamOggVorbis() {}
 
-AudioStreamOggVorbis::~AudioStreamOggVorbis() {}
+AudioStreamOggVorbis::~AudioStreamOggVorbis() {
+	if (AudioDecodedCache::get_singleton()) {
+		AudioDecodedCache::get_singleton()->erase(get_instance_id());
+	}
+}
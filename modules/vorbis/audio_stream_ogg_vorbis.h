@@ -80,8 +80,14 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 	bool _is_sample = false;
 	Ref<AudioSamplePlayback> sample_playback;
 
+	// Whole stream decoded to PCM, shared with the stream or the decoded cache.
+	// When set, frames are copied from it instead of running the vorbis decoder.
+	Vector<AudioFrame> decoded_frames;
+	uint32_t decoded_position = 0;
+
 	int _mix_frames(AudioFrame *p_buffer, int p_frames);
 	int _mix_frames_vorbis(AudioFrame *p_buffer, int p_frames);
+	int _mix_frames_decoded(AudioFrame *p_buffer, int p_frames);
 
 	// Allocates vorbis data structures. Returns true upon success, false on failure.
 	bool _alloc_vorbis();
@@ -132,6 +138,16 @@ class AudioStreamOggVorbis : public AudioStream {
 
 	Ref<OggPacketSequence> packet_sequence;
 
+	bool decompress_in_memory = false;
+	Vector<AudioFrame> decompressed_frames;
+
+	class CacheDecoder;
+	Ref<AudioStreamPlaybackOggVorbis> _instantiate_decoder();
+	static Vector<AudioFrame> _decode_frames(const Ref<AudioStreamPlaybackOggVorbis> &p_decoder, int p_frame_count);
+	Vector<AudioFrame> _decode_frames();
+	Vector<AudioFrame> _get_decoded_frames();
+	void _update_decompressed_frames();
+
 	double bpm = 0;
 	int beat_count = 0;
 	int bar_beats = 4;
@@ -145,6 +161,7 @@ public:
 
 	void set_loop(bool p_enable);
 	virtual bool has_loop() const override;
+	virtual bool get_loop_range(double &r_loop_begin, double &r_loop_end) const override;
 
 	void set_loop_offset(double p_seconds);
 	double get_loop_offset() const;
@@ -164,6 +181,9 @@ public:
 	void set_packet_sequence(Ref<OggPacketSequence> p_packet_sequence);
 	Ref<OggPacketSequence> get_packet_sequence() const;
 
+	void set_decompress_in_memory(bool p_enable);
+	bool is_decompress_in_memory() const;
+
 	virtual double get_length() const override; //if supported, otherwise return 0
 
 	virtual bool is_monophonic() const override;
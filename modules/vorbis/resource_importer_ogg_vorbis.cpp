@@ -80,6 +80,7 @@ void ResourceImporterOggVorbis::get_import_options(const String &p_path, List<Im
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "bpm", PropertyHint::HINT_RANGE, "0,400,0.01,or_greater"), 0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "beat_count", PropertyHint::HINT_RANGE, "0,512,or_greater"), 0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "bar_beats", PropertyHint::HINT_RANGE, "2,32,or_greater"), 4));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "decompress_in_memory"), false));
 }
 
 #ifdef TOOLS_ENABLED
@@ -101,6 +102,7 @@ Error ResourceImporterOggVorbis::import(ResourceUID::ID p_source_id, const Strin
 	double bpm = p_options["bpm"];
 	int beat_count = p_options["beat_count"];
 	int bar_beats = p_options["bar_beats"];
+	bool decompress_in_memory = p_options["decompress_in_memory"];
 
 	Ref<AudioStreamOggVorbis> ogg_vorbis_stream = AudioStreamOggVorbis::load_from_file(p_source_file);
 	if (ogg_vorbis_stream.is_null()) {
@@ -112,6 +114,7 @@ Error ResourceImporterOggVorbis::import(ResourceUID::ID p_source_id, const Strin
 	ogg_vorbis_stream->set_bpm(bpm);
 	ogg_vorbis_stream->set_beat_count(beat_count);
 	ogg_vorbis_stream->set_bar_beats(bar_beats);
+	ogg_vorbis_stream->set_decompress_in_memory(decompress_in_memory);
 
 	return ResourceSaver::save(ogg_vorbis_stream, p_save_path + ".oggvorbisstr");
 }
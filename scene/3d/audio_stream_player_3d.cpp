@@ -292,6 +292,7 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 				HashMap<StringName, Vector<AudioFrame>> bus_map;
 				bus_map[_get_actual_bus()] = volume_vector;
 				AudioServer::get_singleton()->start_playback_stream(setplayback, bus_map, setplay.get(), actual_pitch_scale, linear_attenuation, attenuation_filter_cutoff_hz);
+				_update_voice_params(setplayback);
 				setplayback.unref();
 				setplay.set(-1);
 			}
@@ -784,6 +785,31 @@ float AudioStreamPlayer3D::get_panning_strength() const {
 	return panning_strength;
 }
 
+void AudioStreamPlayer3D::_update_voice_params(const Ref<AudioStreamPlayback> &p_playback) {
+	if (internal->stream.is_null()) {
+		return;
+	}
+	double length = internal->stream->get_length();
+	double loop_begin = 0.0;
+	double loop_end = -1.0;
+	if (!internal->stream->get_loop_range(loop_begin, loop_end)) {
+		// Without knowing where the stream loops back to, its position can't be followed while virtual.
+		length = 0.0;
+	}
+	AudioServer::get_singleton()->set_playback_voice_params(p_playback, voice_priority, length, loop_begin, loop_end);
+}
+
+void AudioStreamPlayer3D::set_voice_priority(int p_priority) {
+	voice_priority = p_priority;
+	for (Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
+		_update_voice_params(playback);
+	}
+}
+
+int AudioStreamPlayer3D::get_voice_priority() const {
+	return voice_priority;
+}
+
 AudioServer::PlaybackType AudioStreamPlayer3D::get_playback_type() const {
 	return internal->get_playback_type();
 }
@@ -874,6 +900,9 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_panning_strength", "panning_strength"), &AudioStreamPlayer3D::set_panning_strength);
 	ClassDB::bind_method(D_METHOD("get_panning_strength"), &AudioStreamPlayer3D::get_panning_strength);
 
+	ClassDB::bind_method(D_METHOD("set_voice_priority", "priority"), &AudioStreamPlayer3D::set_voice_priority);
+	ClassDB::bind_method(D_METHOD("get_voice_priority"), &AudioStreamPlayer3D::get_voice_priority);
+
 	ClassDB::bind_method(D_METHOD("has_stream_playback"), &AudioStreamPlayer3D::has_stream_playback);
 	ClassDB::bind_method(D_METHOD("get_stream_playback"), &AudioStreamPlayer3D::get_stream_playback);
 
@@ -893,6 +922,7 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_distance", PropertyHint::HINT_RANGE, "0,4096,0.01,or_greater,suffix:m"), "set_max_distance", "get_max_distance");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_polyphony", PropertyHint::HINT_NONE, ""), "set_max_polyphony", "get_max_polyphony");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "panning_strength", PropertyHint::HINT_RANGE, "0,3,0.01,or_greater"), "set_panning_strength", "get_panning_strength");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "voice_priority", PropertyHint::HINT_RANGE, "-128,128,1,or_less,or_greater"), "set_voice_priority", "get_voice_priority");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "bus", PropertyHint::HINT_ENUM, ""), "set_bus", "get_bus");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "area_mask", PropertyHint::HINT_LAYERS_2D_PHYSICS), "set_area_mask", "get_area_mask");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "playback_type", PropertyHint::HINT_ENUM, "Default,Stream,Sample"), "set_playback_type", "get_playback_type");
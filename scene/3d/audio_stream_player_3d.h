@@ -123,6 +123,9 @@ private:
 	float panning_strength = 1.0f;
 	float cached_global_panning_strength = 0.5f;
 
+	int voice_priority = 0;
+	void _update_voice_params(const Ref<AudioStreamPlayback> &p_playback);
+
 protected:
 	void _validate_property(PropertyInfo &p_property) const;
 	void _notification(int p_what);
@@ -204,6 +207,9 @@ public:
 	void set_panning_strength(float p_panning_strength);
 	float get_panning_strength() const;
 
+	void set_voice_priority(int p_priority);
+	int get_voice_priority() const;
+
 	bool has_stream_playback();
 	Ref<AudioStreamPlayback> get_stream_playback();
 
@@ -33,6 +33,7 @@
 #include "mesh_instance_3d.h"
 
 #include "scene/3d/skeleton_3d.h"
+#include "scene/animation/animation_player.h"
 
 #ifndef PHYSICS_3D_DISABLED
 #include "scene/3d/physics/collision_shape_3d.h"
@@ -176,9 +177,10 @@ void MeshInstance3D::set_blend_shape_value(int p_blend_shape, float p_value) {
 
 void MeshInstance3D::_resolve_skeleton_path() {
 	Ref<SkinReference> new_skin_reference;
+	Skeleton3D *skeleton = nullptr;
 
 	if (!skeleton_path.is_empty()) {
-		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(get_node(skeleton_path));
+		skeleton = Object::cast_to<Skeleton3D>(get_node(skeleton_path));
 		if (skeleton) {
 			if (skin_internal.is_null()) {
 				new_skin_reference = skeleton->register_skin(skeleton->create_skin_from_rest_transforms());
@@ -198,6 +200,25 @@ void MeshInstance3D::_resolve_skeleton_path() {
 	} else {
 		RenderingServer::get_singleton()->instance_attach_skeleton(get_instance(), RID());
 	}
+
+	// The skin is bound to the skeleton's pose source, so follow its changes.
+	ObjectID new_skeleton_id = skeleton ? skeleton->get_instance_id() : ObjectID();
+	if (new_skeleton_id != skeleton_id) {
+		Skeleton3D *old_skeleton = ObjectDB::get_instance<Skeleton3D>(skeleton_id);
+		if (old_skeleton && old_skeleton->is_connected(SceneStringName(pose_source_changed), callable_mp(this, &MeshInstance3D::_skeleton_pose_source_changed))) {
+			old_skeleton->disconnect(SceneStringName(pose_source_changed), callable_mp(this, &MeshInstance3D::_skeleton_pose_source_changed));
+		}
+		if (skeleton) {
+			skeleton->connect(SceneStringName(pose_source_changed), callable_mp(this, &MeshInstance3D::_skeleton_pose_source_changed));
+		}
+		skeleton_id = new_skeleton_id;
+	}
+}
+
+void MeshInstance3D::_skeleton_pose_source_changed() {
+	if (is_inside_tree()) {
+		_resolve_skeleton_path();
+	}
 }
 
 void MeshInstance3D::set_skin(const Ref<Skin> &p_skin) {
@@ -851,6 +872,146 @@ Ref<ArrayMesh> MeshInstance3D::bake_mesh_from_current_skeleton_pose(Ref<ArrayMes
 	return bake_mesh;
 }
 
+Ref<Image> MeshInstance3D::bake_vertex_animation_texture(AnimationPlayer *p_animation_player, const StringName &p_animation, float p_fps) {
+	ERR_FAIL_NULL_V(p_animation_player, Ref<Image>());
+	ERR_FAIL_COND_V(p_fps <= 0, Ref<Image>());
+	ERR_FAIL_COND_V_MSG(!p_animation_player->has_animation(p_animation), Ref<Image>(), vformat("Animation not found: %s.", p_animation));
+
+	Ref<ArrayMesh> source_mesh = get_mesh();
+	ERR_FAIL_COND_V_MSG(source_mesh.is_null(), Ref<Image>(), "The source mesh must be a valid ArrayMesh.");
+	ERR_FAIL_COND_V_MSG(skin_internal.is_null(), Ref<Image>(), "The source mesh must have a valid skin.");
+	Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(get_node_or_null(skeleton_path));
+	ERR_FAIL_NULL_V_MSG(skeleton, Ref<Image>(), "The source mesh must be bound to a valid Skeleton3D.");
+
+	// Map the skin binds to skeleton bones the same way the skeleton does when uploading skins.
+	const int bind_count = skin_internal->get_bind_count();
+	ERR_FAIL_COND_V(bind_count <= 0, Ref<Image>());
+	LocalVector<int> bind_bones;
+	bind_bones.resize(bind_count);
+	for (int i = 0; i < bind_count; i++) {
+		StringName bind_name = skin_internal->get_bind_name(i);
+		int bone = bind_name != StringName() ? skeleton->find_bone(bind_name) : skin_internal->get_bind_bone(i);
+		ERR_FAIL_INDEX_V_MSG(bone, skeleton->get_bone_count(), Ref<Image>(), "Skin bind #" + itos(i) + " does not map to a bone of the Skeleton3D.");
+		bind_bones[i] = bone;
+	}
+
+	struct BakeSurface {
+		Vector<Vector3> vertices;
+		Vector<int> bones;
+		Vector<float> weights;
+		uint32_t bones_per_vertex = 4;
+	};
+	LocalVector<BakeSurface> surfaces;
+	int64_t total_vertex_count = 0;
+	for (int surface_index = 0; surface_index < source_mesh->get_surface_count(); surface_index++) {
+		const uint32_t surface_format = source_mesh->surface_get_format(surface_index);
+		const Array &arrays = source_mesh->surface_get_arrays(surface_index);
+		ERR_FAIL_COND_V(arrays.size() != RS::ARRAY_MAX, Ref<Image>());
+
+		BakeSurface surface;
+		surface.vertices = arrays[Mesh::ARRAY_VERTEX];
+		if ((surface_format & Mesh::ARRAY_FORMAT_BONES) && (surface_format & Mesh::ARRAY_FORMAT_WEIGHTS)) {
+			surface.bones = arrays[Mesh::ARRAY_BONES];
+			surface.weights = arrays[Mesh::ARRAY_WEIGHTS];
+			surface.bones_per_vertex = surface_format & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS ? 8 : 4;
+			ERR_FAIL_COND_V(surface.bones.size() != surface.vertices.size() * (int)surface.bones_per_vertex, Ref<Image>());
+			ERR_FAIL_COND_V(surface.weights.size() != surface.bones.size(), Ref<Image>());
+		}
+		total_vertex_count += surface.vertices.size();
+		surfaces.push_back(surface);
+	}
+	ERR_FAIL_COND_V(total_vertex_count == 0, Ref<Image>());
+	ERR_FAIL_COND_V_MSG(total_vertex_count > Image::MAX_WIDTH, Ref<Image>(), "The mesh has too many vertices to fit in a single texture row.");
+
+	Ref<Animation> animation = p_animation_player->get_animation(p_animation);
+	const double length = animation->get_length();
+	const int frame_count = int(length * p_fps) + 1;
+	ERR_FAIL_COND_V(frame_count > Image::MAX_HEIGHT, Ref<Image>());
+
+	// Restore the player and the skeleton afterwards, baking must not disturb the scene.
+	const String previous_animation = p_animation_player->get_assigned_animation();
+	const double previous_position = previous_animation.is_empty() ? 0.0 : p_animation_player->get_current_animation_position();
+	const bool was_playing = p_animation_player->is_playing();
+	const float speed_scale = p_animation_player->get_speed_scale();
+	const float previous_speed = was_playing && speed_scale != 0 ? p_animation_player->get_playing_speed() / speed_scale : 1.0;
+	if (was_playing) {
+		p_animation_player->pause();
+	}
+
+	struct BonePose {
+		Vector3 position;
+		Quaternion rotation;
+		Vector3 scale;
+	};
+	LocalVector<BonePose> previous_poses;
+	previous_poses.resize(skeleton->get_bone_count());
+	for (uint32_t i = 0; i < previous_poses.size(); i++) {
+		previous_poses[i] = { skeleton->get_bone_pose_position(i), skeleton->get_bone_pose_rotation(i), skeleton->get_bone_pose_scale(i) };
+	}
+
+	Vector<uint8_t> data;
+	data.resize(total_vertex_count * frame_count * sizeof(float) * 3);
+	float *dst = reinterpret_cast<float *>(data.ptrw());
+
+	LocalVector<Transform3D> bind_transforms;
+	bind_transforms.resize(bind_count);
+
+	p_animation_player->set_assigned_animation(p_animation);
+	for (int frame = 0; frame < frame_count; frame++) {
+		p_animation_player->seek(MIN(frame / double(p_fps), length), true);
+
+		for (int i = 0; i < bind_count; i++) {
+			bind_transforms[i] = skeleton->get_bone_global_pose(bind_bones[i]) * skin_internal->get_bind_pose(i);
+		}
+
+		for (const BakeSurface &surface : surfaces) {
+			const Vector3 *vertices = surface.vertices.ptr();
+			const int *bones = surface.bones.ptr();
+			const float *weights = surface.weights.ptr();
+			const int vertex_count = surface.vertices.size();
+			for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+				Vector3 position = vertices[vertex_index];
+				if (bones) {
+					Vector3 skinned;
+					float weight_sum = 0.0;
+					for (uint32_t j = 0; j < surface.bones_per_vertex; j++) {
+						const uint32_t k = vertex_index * surface.bones_per_vertex + j;
+						if (weights[k] < FLT_EPSILON || bones[k] < 0 || bones[k] >= bind_count) {
+							continue;
+						}
+						skinned += bind_transforms[bones[k]].xform(position) * weights[k];
+						weight_sum += weights[k];
+					}
+					if (weight_sum > FLT_EPSILON) {
+						position = skinned / weight_sum;
+					}
+				}
+				dst[0] = position.x;
+				dst[1] = position.y;
+				dst[2] = position.z;
+				dst += 3;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < previous_poses.size(); i++) {
+		skeleton->set_bone_pose_position(i, previous_poses[i].position);
+		skeleton->set_bone_pose_rotation(i, previous_poses[i].rotation);
+		skeleton->set_bone_pose_scale(i, previous_poses[i].scale);
+	}
+	if (previous_animation.is_empty()) {
+		p_animation_player->set_assigned_animation(String());
+	} else {
+		p_animation_player->set_assigned_animation(previous_animation);
+		p_animation_player->seek(previous_position);
+		if (was_playing) {
+			p_animation_player->play(StringName(), -1, previous_speed);
+		}
+	}
+
+	return Image::create_from_data(total_vertex_count, frame_count, false, Image::FORMAT_RGBF, data);
+}
+
 Ref<TriangleMesh> MeshInstance3D::generate_triangle_mesh() const {
 	if (mesh.is_valid()) {
 		return mesh->generate_triangle_mesh();
@@ -918,6 +1079,7 @@ void MeshInstance3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("bake_mesh_from_current_blend_shape_mix", "existing"), &MeshInstance3D::bake_mesh_from_current_blend_shape_mix, DEFVAL(Ref<ArrayMesh>()));
 	ClassDB::bind_method(D_METHOD("bake_mesh_from_current_skeleton_pose", "existing"), &MeshInstance3D::bake_mesh_from_current_skeleton_pose, DEFVAL(Ref<ArrayMesh>()));
+	ClassDB::bind_method(D_METHOD("bake_vertex_animation_texture", "animation_player", "animation", "fps"), &MeshInstance3D::bake_vertex_animation_texture, DEFVAL(30.0));
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "mesh", PropertyHint::HINT_RESOURCE_TYPE, "Mesh"), "set_mesh", "get_mesh");
 	ADD_GROUP("Skeleton", "");
@@ -39,6 +39,7 @@
 class NavigationMesh;
 class NavigationMeshSourceGeometryData3D;
 #endif // NAVIGATION_3D_DISABLED
+class AnimationPlayer;
 class Skin;
 class SkinReference;
 
@@ -51,6 +52,7 @@ protected:
 	Ref<Skin> skin_internal;
 	Ref<SkinReference> skin_ref;
 	NodePath skeleton_path = NodePath("..");
+	ObjectID skeleton_id;
 
 	LocalVector<float> blend_shape_tracks;
 	HashMap<StringName, int> blend_shape_properties;
@@ -58,6 +60,7 @@ protected:
 
 	void _mesh_changed();
 	void _resolve_skeleton_path();
+	void _skeleton_pose_source_changed();
 
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
@@ -111,6 +114,7 @@ public:
 
 	Ref<ArrayMesh> bake_mesh_from_current_blend_shape_mix(Ref<ArrayMesh> p_existing = Ref<ArrayMesh>());
 	Ref<ArrayMesh> bake_mesh_from_current_skeleton_pose(Ref<ArrayMesh> p_existing = Ref<ArrayMesh>());
+	Ref<Image> bake_vertex_animation_texture(AnimationPlayer *p_animation_player, const StringName &p_animation, float p_fps = 30.0);
 
 	virtual Ref<TriangleMesh> generate_triangle_mesh() const override;
 
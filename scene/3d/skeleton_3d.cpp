@@ -326,6 +326,10 @@ void Skeleton3D::_notification(int p_what) {
 #endif // _DISABLE_DEPRECATED && PHYSICS_3D_DISABLED
 			update_flags = UPDATE_FLAG_POSE;
 			_notification(NOTIFICATION_UPDATE_SKELETON);
+			_update_pose_source_watch();
+		} break;
+		case NOTIFICATION_EXIT_TREE: {
+			_update_pose_source_watch(true);
 		} break;
 #ifdef TOOLS_ENABLED
 		case NOTIFICATION_EDITOR_PRE_SAVE: {
@@ -345,6 +349,9 @@ void Skeleton3D::_notification(int p_what) {
 			int len = bones.size();
 
 			thread_local LocalVector<bool> bone_global_pose_dirty_backup;
+			thread_local LocalVector<Transform3D> global_poses_backup;
+			int global_pose_dirty_begin_backup = 0;
+			int global_pose_dirty_end_backup = 0;
 
 			// Process modifiers.
 
@@ -356,8 +363,11 @@ void Skeleton3D::_notification(int p_what) {
 				for (uint32_t i = 0; i < bones.size(); i++) {
 					bones_backup[i].save(bonesptr[i]);
 				}
-				// Store dirty flags for global bone poses.
+				// Store global bone poses and their dirty flags.
+				global_poses_backup = nested_set_global_poses;
 				bone_global_pose_dirty_backup = bone_global_pose_dirty;
+				global_pose_dirty_begin_backup = global_pose_dirty_begin;
+				global_pose_dirty_end_backup = global_pose_dirty_end;
 
 				if (update_flags & UPDATE_FLAG_MODIFIER) {
 					_process_modifiers();
@@ -426,7 +436,7 @@ void Skeleton3D::_notification(int p_what) {
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+					rs->skeleton_bone_set_transform(skeleton, i, nested_set_global_poses[bonesptr[bone_index].nested_set_offset] * skin->get_bind_pose(i));
 				}
 			}
 
@@ -435,8 +445,11 @@ void Skeleton3D::_notification(int p_what) {
 				for (uint32_t i = 0; i < bones.size(); i++) {
 					bones_backup[i].restore(bones[i]);
 				}
-				// Restore dirty flags for global bone poses.
+				// Restore global bone poses and their dirty flags.
+				nested_set_global_poses = global_poses_backup;
 				bone_global_pose_dirty = bone_global_pose_dirty_backup;
+				global_pose_dirty_begin = global_pose_dirty_begin_backup;
+				global_pose_dirty_end = global_pose_dirty_end_backup;
 			}
 
 			updating = false;
@@ -491,6 +504,8 @@ void Skeleton3D::_make_modifiers_dirty() {
 
 void Skeleton3D::_update_bones_nested_set() const {
 	nested_set_offset_to_bone_index.resize(bones.size());
+	nested_set_parent_offsets.resize(bones.size());
+	nested_set_global_poses.resize(bones.size());
 	bone_global_pose_dirty.resize(bones.size());
 	_make_bone_global_poses_dirty();
 
@@ -498,6 +513,12 @@ void Skeleton3D::_update_bones_nested_set() const {
 	for (int bone : parentless_bones) {
 		offset += _update_bone_nested_set(bone, offset);
 	}
+
+	// Parents are placed before their children, so their offsets are known at this point.
+	for (uint32_t i = 0; i < nested_set_offset_to_bone_index.size(); i++) {
+		int parent = bones[nested_set_offset_to_bone_index[i]].parent;
+		nested_set_parent_offsets[i] = parent >= 0 ? bones[parent].nested_set_offset : -1;
+	}
 }
 
 int Skeleton3D::_update_bone_nested_set(int p_bone, int p_offset) const {
@@ -519,9 +540,11 @@ int Skeleton3D::_update_bone_nested_set(int p_bone, int p_offset) const {
 }
 
 void Skeleton3D::_make_bone_global_poses_dirty() const {
-	for (uint32_t i = 0; i < bone_global_pose_dirty.size(); i++) {
-		bone_global_pose_dirty[i] = true;
+	if (!bone_global_pose_dirty.is_empty()) {
+		memset(bone_global_pose_dirty.ptr(), true, bone_global_pose_dirty.size() * sizeof(bool));
 	}
+	global_pose_dirty_begin = 0;
+	global_pose_dirty_end = bone_global_pose_dirty.size();
 }
 
 void Skeleton3D::_make_bone_global_pose_subtree_dirty(int p_bone) const {
@@ -538,8 +561,14 @@ void Skeleton3D::_make_bone_global_pose_subtree_dirty(int p_bone) const {
 
 	// Make global poses of subtree dirty.
 	int span_end = span_offset + bone.nested_set_span;
-	for (int i = span_offset; i < span_end; i++) {
-		bone_global_pose_dirty[i] = true;
+	memset(bone_global_pose_dirty.ptr() + span_offset, true, bone.nested_set_span * sizeof(bool));
+
+	if (global_pose_dirty_begin == global_pose_dirty_end) {
+		global_pose_dirty_begin = span_offset;
+		global_pose_dirty_end = span_end;
+	} else {
+		global_pose_dirty_begin = MIN(global_pose_dirty_begin, span_offset);
+		global_pose_dirty_end = MAX(global_pose_dirty_end, span_end);
 	}
 }
 
@@ -555,25 +584,25 @@ void Skeleton3D::_update_bone_global_pose(int p_bone) const {
 		return;
 	}
 
-	thread_local LocalVector<int> bone_list;
-	bone_list.clear();
+	thread_local LocalVector<int> offset_list;
+	offset_list.clear();
 	Transform3D global_pose;
 
-	// Create list of parent bones for which the global pose needs to be recalculated.
-	for (int bone = p_bone; bone >= 0; bone = bones[bone].parent) {
-		int offset = bones[bone].nested_set_offset;
+	// Create list of parent offsets for which the global pose needs to be recalculated.
+	for (int offset = nested_set_offset; offset >= 0; offset = nested_set_parent_offsets[offset]) {
 		// Stop searching when global pose is not dirty.
 		if (!bone_global_pose_dirty[offset]) {
-			global_pose = bones[bone].global_pose;
+			global_pose = nested_set_global_poses[offset];
 			break;
 		}
 
-		bone_list.push_back(bone);
+		offset_list.push_back(offset);
 	}
 
 	// Calculate global poses for all parent bones and the current bone.
-	for (int i = bone_list.size() - 1; i >= 0; i--) {
-		int bone_idx = bone_list[i];
+	for (int i = offset_list.size() - 1; i >= 0; i--) {
+		int offset = offset_list[i];
+		int bone_idx = nested_set_offset_to_bone_index[offset];
 		Bone &bone = bones[bone_idx];
 		bool bone_enabled = bone.enabled && !show_rest_only;
 		Transform3D bone_pose = bone_enabled ? get_bone_pose(bone_idx) : get_bone_rest(bone_idx);
@@ -585,8 +614,8 @@ void Skeleton3D::_update_bone_global_pose(int p_bone) const {
 		}
 #endif // _DISABLE_DEPRECATED
 
-		bone.global_pose = global_pose;
-		bone_global_pose_dirty[bone.nested_set_offset] = false;
+		nested_set_global_poses[offset] = global_pose;
+		bone_global_pose_dirty[offset] = false;
 	}
 }
 
@@ -594,7 +623,7 @@ Transform3D Skeleton3D::get_bone_global_pose(int p_bone) const {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX_V(p_bone, bone_size, Transform3D());
 	_update_bone_global_pose(p_bone);
-	return bones[p_bone].global_pose;
+	return nested_set_global_poses[bones[p_bone].nested_set_offset];
 }
 
 void Skeleton3D::set_bone_global_pose(int p_bone, const Transform3D &p_pose) {
@@ -622,6 +651,98 @@ float Skeleton3D::get_motion_scale() const {
 	return motion_scale;
 }
 
+void Skeleton3D::set_pose_source(const NodePath &p_pose_source) {
+	if (pose_source == p_pose_source) {
+		return;
+	}
+	pose_source = p_pose_source;
+	_update_pose_source_watch();
+	// Let the meshes bound to this skeleton register their skins again.
+	_notify_pose_source_changed();
+}
+
+void Skeleton3D::_update_pose_source_watch(bool p_exiting) {
+	if (!is_inside_tree()) {
+		return;
+	}
+	Node *source_node = (p_exiting || pose_source.is_empty()) ? nullptr : get_node_or_null(pose_source);
+
+	// A pose source which enters the tree after this skeleton is only found once it exists,
+	// so watch the tree for new nodes while the path does not resolve.
+	bool watch = !p_exiting && !pose_source.is_empty() && !source_node;
+	SceneTree *tree = get_tree();
+	const Callable callable = callable_mp(this, &Skeleton3D::_pose_source_node_added);
+	if (watch && !tree->is_connected(SNAME("node_added"), callable)) {
+		tree->connect(SNAME("node_added"), callable);
+	} else if (!watch && tree->is_connected(SNAME("node_added"), callable)) {
+		tree->disconnect(SNAME("node_added"), callable);
+	}
+
+	// Skins registered here are bound to the source while it resolves, so follow it leaving
+	// the tree and changing its own source, which moves the end of the chain.
+	Skeleton3D *source = source_node != this ? Object::cast_to<Skeleton3D>(source_node) : nullptr;
+	ObjectID source_id = source ? source->get_instance_id() : ObjectID();
+	if (source_id == pose_source_node_id) {
+		return;
+	}
+	Skeleton3D *old_source = ObjectDB::get_instance<Skeleton3D>(pose_source_node_id);
+	if (old_source) {
+		old_source->disconnect(SceneStringName(tree_exited), callable_mp(this, &Skeleton3D::_pose_source_exited));
+		old_source->disconnect(SceneStringName(pose_source_changed), callable_mp(this, &Skeleton3D::_notify_pose_source_changed));
+	}
+	if (source) {
+		source->connect(SceneStringName(tree_exited), callable_mp(this, &Skeleton3D::_pose_source_exited));
+		source->connect(SceneStringName(pose_source_changed), callable_mp(this, &Skeleton3D::_notify_pose_source_changed));
+	}
+	pose_source_node_id = source_id;
+}
+
+void Skeleton3D::_pose_source_node_added(Node *p_node) {
+	if (!get_node_or_null(pose_source)) {
+		return;
+	}
+	_update_pose_source_watch();
+	_notify_pose_source_changed();
+}
+
+void Skeleton3D::_pose_source_exited() {
+	// The source no longer resolves, so the meshes bound to it fall back to this skeleton.
+	_update_pose_source_watch();
+	_notify_pose_source_changed();
+}
+
+void Skeleton3D::_notify_pose_source_changed() {
+	// Also forwarded from the source, so meshes on every skeleton further down the chain
+	// register their skins again. Skeletons following each other in a loop stop here.
+	if (pose_source_notifying) {
+		return;
+	}
+	pose_source_notifying = true;
+	emit_signal(SceneStringName(pose_source_changed));
+	pose_source_notifying = false;
+}
+
+NodePath Skeleton3D::get_pose_source() const {
+	return pose_source;
+}
+
+Skeleton3D *Skeleton3D::_get_pose_source() const {
+	// Follow the chain to the skeleton which actually evaluates the pose.
+	const Skeleton3D *current = this;
+	for (int i = 0; i < 8; i++) {
+		if (current->pose_source.is_empty()) {
+			return current == this ? nullptr : const_cast<Skeleton3D *>(current);
+		}
+		const Skeleton3D *next = Object::cast_to<Skeleton3D>(current->get_node_or_null(current->pose_source));
+		if (!next || next == current) {
+			return current == this ? nullptr : const_cast<Skeleton3D *>(current);
+		}
+		ERR_FAIL_COND_V_MSG(next == this, nullptr, "Skeleton3D pose source chain loops back to itself.");
+		current = next;
+	}
+	ERR_FAIL_V_MSG(nullptr, "Skeleton3D pose source chain is too long or contains a loop.");
+}
+
 // Skeleton creation api
 
 uint64_t Skeleton3D::get_version() const {
@@ -858,6 +979,10 @@ void Skeleton3D::clear_bones() {
 	bone_global_pose_dirty.clear();
 	parentless_bones.clear();
 	nested_set_offset_to_bone_index.clear();
+	nested_set_parent_offsets.clear();
+	nested_set_global_poses.clear();
+	global_pose_dirty_begin = 0;
+	global_pose_dirty_end = 0;
 
 	process_order_dirty = true;
 	version++;
@@ -869,6 +994,9 @@ void Skeleton3D::clear_bones() {
 void Skeleton3D::set_bone_pose(int p_bone, const Transform3D &p_pose) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone, bone_size);
+	if (unlikely(modifier_pose_capture)) {
+		_capture_modifier_pose(p_bone);
+	}
 
 	bones[p_bone].pose_position = p_pose.origin;
 	bones[p_bone].pose_rotation = p_pose.basis.get_rotation_quaternion();
@@ -883,6 +1011,9 @@ void Skeleton3D::set_bone_pose(int p_bone, const Transform3D &p_pose) {
 void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone, bone_size);
+	if (unlikely(modifier_pose_capture)) {
+		_capture_modifier_pose(p_bone);
+	}
 
 	bones[p_bone].pose_position = p_position;
 	bones[p_bone].pose_cache_dirty = true;
@@ -894,6 +1025,9 @@ void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
 void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone, bone_size);
+	if (unlikely(modifier_pose_capture)) {
+		_capture_modifier_pose(p_bone);
+	}
 
 	bones[p_bone].pose_rotation = p_rotation;
 	bones[p_bone].pose_cache_dirty = true;
@@ -905,6 +1039,9 @@ void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation
 void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone, bone_size);
+	if (unlikely(modifier_pose_capture)) {
+		_capture_modifier_pose(p_bone);
+	}
 
 	bones[p_bone].pose_scale = p_scale;
 	bones[p_bone].pose_cache_dirty = true;
@@ -1043,6 +1180,13 @@ Ref<Skin> Skeleton3D::create_skin_from_rest_transforms() {
 Ref<SkinReference> Skeleton3D::register_skin(const Ref<Skin> &p_skin) {
 	ERR_FAIL_COND_V(p_skin.is_null(), Ref<SkinReference>());
 
+	// Skins bound to a follower share the rendering skeleton of the pose source,
+	// so the pose is evaluated and uploaded only once for all of them.
+	Skeleton3D *source = _get_pose_source();
+	if (source) {
+		return source->register_skin(p_skin);
+	}
+
 	for (const SkinReference *E : skin_bindings) {
 		if (E->skin == p_skin) {
 			return Ref<SkinReference>(E);
@@ -1088,9 +1232,10 @@ void Skeleton3D::force_update_all_bone_transforms() {
 
 void Skeleton3D::_force_update_all_bone_transforms() const {
 	_update_process_order();
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		_force_update_bone_children_transforms(parentless_bones[i]);
-	}
+	// Dirty flags only exist inside the tracked range, so one pass over it updates every root.
+	_update_bone_global_poses_range(global_pose_dirty_begin, global_pose_dirty_end);
+	global_pose_dirty_begin = 0;
+	global_pose_dirty_end = 0;
 	if (rest_dirty) {
 		rest_dirty = false;
 		const_cast<Skeleton3D *>(this)->emit_signal(SNAME("rest_updated"));
@@ -1114,33 +1259,36 @@ void Skeleton3D::_force_update_bone_children_transforms(int p_bone_idx) const {
 
 	_update_process_order();
 
-	Bone *bonesptr = bones.ptr();
+	// The subtree of a bone is a contiguous range of the nested set, which only needs its parent to be up to date.
+	const Bone &bone = bones[p_bone_idx];
+	if (bone.parent >= 0) {
+		_update_bone_global_pose(bone.parent);
+	}
+	_update_bone_global_poses_range(bone.nested_set_offset, bone.nested_set_offset + bone.nested_set_span);
+}
 
-	// Loop through nested set.
-	for (int offset = 0; offset < bone_size; offset++) {
-		if (!bone_global_pose_dirty[offset]) {
+void Skeleton3D::_update_bone_global_poses_range(int p_begin, int p_end) const {
+	Bone *bonesptr = bones.ptr();
+	const int *offset_to_bone = nested_set_offset_to_bone_index.ptr();
+	const int *parent_offsets = nested_set_parent_offsets.ptr();
+	Transform3D *global_poses = nested_set_global_poses.ptr();
+	bool *global_pose_dirty = bone_global_pose_dirty.ptr();
+
+	// Parents precede children in the nested set, so a parent's global pose is always final here.
+	for (int offset = p_begin; offset < p_end; offset++) {
+		if (!global_pose_dirty[offset]) {
 			continue;
 		}
 
-		int current_bone_idx = nested_set_offset_to_bone_index[offset];
-		Bone &b = bonesptr[current_bone_idx];
+		Bone &b = bonesptr[offset_to_bone[offset]];
 		bool bone_enabled = b.enabled && !show_rest_only;
+		const int parent_offset = parent_offsets[offset];
 
 		if (bone_enabled) {
 			b.update_pose_cache();
-			Transform3D pose = b.pose_cache;
-
-			if (b.parent >= 0) {
-				b.global_pose = bonesptr[b.parent].global_pose * pose;
-			} else {
-				b.global_pose = pose;
-			}
+			global_poses[offset] = parent_offset >= 0 ? global_poses[parent_offset] * b.pose_cache : b.pose_cache;
 		} else {
-			if (b.parent >= 0) {
-				b.global_pose = bonesptr[b.parent].global_pose * b.rest;
-			} else {
-				b.global_pose = b.rest;
-			}
+			global_poses[offset] = parent_offset >= 0 ? global_poses[parent_offset] * b.rest : b.rest;
 		}
 		if (rest_dirty) {
 			b.global_rest = b.parent >= 0 ? bonesptr[b.parent].global_rest * b.rest : b.rest;
@@ -1162,14 +1310,14 @@ void Skeleton3D::_force_update_bone_children_transforms(int p_bone_idx) const {
 			}
 		}
 		if (b.global_pose_override_amount >= CMP_EPSILON) {
-			b.global_pose = b.global_pose.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+			global_poses[offset] = global_poses[offset].interpolate_with(b.global_pose_override, b.global_pose_override_amount);
 		}
 		if (b.global_pose_override_reset) {
 			b.global_pose_override_amount = 0.0;
 		}
 #endif // _DISABLE_DEPRECATED
 
-		bone_global_pose_dirty[offset] = false;
+		global_pose_dirty[offset] = false;
 	}
 }
 
@@ -1204,29 +1352,45 @@ void Skeleton3D::_process_modifiers() {
 #endif //TOOLS_ENABLED
 		real_t influence = mod->get_influence();
 		if (influence < 1.0) {
-			LocalVector<Transform3D> old_poses;
-			for (int i = 0; i < get_bone_count(); i++) {
-				old_poses.push_back(get_bone_pose(i));
+			if (modifier_pose_captured.size() != bones.size()) {
+				modifier_pose_captured.resize(bones.size());
+				if (!modifier_pose_captured.is_empty()) {
+					memset(modifier_pose_captured.ptr(), false, modifier_pose_captured.size() * sizeof(bool));
+				}
 			}
+			modifier_pose_capture = true;
 			mod->process_modification(update_delta);
-			LocalVector<Transform3D> new_poses;
-			for (int i = 0; i < get_bone_count(); i++) {
-				new_poses.push_back(get_bone_pose(i));
-			}
-			for (int i = 0; i < get_bone_count(); i++) {
-				if (old_poses[i] == new_poses[i]) {
+			modifier_pose_capture = false;
+
+			for (uint32_t i = 0; i < modifier_changed_bones.size(); i++) {
+				const int bone = modifier_changed_bones[i];
+				modifier_pose_captured[bone] = false;
+				Transform3D new_pose = get_bone_pose(bone);
+				if (modifier_old_poses[i] == new_pose) {
 					continue; // Avoid unneeded calculation.
 				}
-				set_bone_pose(i, old_poses[i].interpolate_with(new_poses[i], influence));
+				set_bone_pose(bone, modifier_old_poses[i].interpolate_with(new_pose, influence));
 			}
+			modifier_changed_bones.clear();
+			modifier_old_poses.clear();
 		} else {
 			mod->process_modification(update_delta);
 		}
+		// Only walks the dirty range of the nested set, which after the first modifier is just the subtrees it changed.
 		force_update_all_dirty_bones();
 	}
 	update_delta = 0; // Reset accumulated delta.
 }
 
+void Skeleton3D::_capture_modifier_pose(int p_bone) {
+	if ((uint32_t)p_bone >= modifier_pose_captured.size() || modifier_pose_captured[p_bone]) {
+		return;
+	}
+	modifier_pose_captured[p_bone] = true;
+	modifier_changed_bones.push_back(p_bone);
+	modifier_old_poses.push_back(get_bone_pose(p_bone));
+}
+
 void Skeleton3D::add_child_notify(Node *p_child) {
 	if (Object::cast_to<SkeletonModifier3D>(p_child)) {
 		_make_modifiers_dirty();
@@ -1309,6 +1473,9 @@ void Skeleton3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_show_rest_only", "enabled"), &Skeleton3D::set_show_rest_only);
 	ClassDB::bind_method(D_METHOD("is_show_rest_only"), &Skeleton3D::is_show_rest_only);
 
+	ClassDB::bind_method(D_METHOD("set_pose_source", "pose_source"), &Skeleton3D::set_pose_source);
+	ClassDB::bind_method(D_METHOD("get_pose_source"), &Skeleton3D::get_pose_source);
+
 	ClassDB::bind_method(D_METHOD("set_modifier_callback_mode_process", "mode"), &Skeleton3D::set_modifier_callback_mode_process);
 	ClassDB::bind_method(D_METHOD("get_modifier_callback_mode_process"), &Skeleton3D::get_modifier_callback_mode_process);
 
@@ -1316,6 +1483,7 @@ void Skeleton3D::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "motion_scale", PropertyHint::HINT_RANGE, "0.001,10,0.001,or_greater"), "set_motion_scale", "get_motion_scale");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "show_rest_only"), "set_show_rest_only", "is_show_rest_only");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "pose_source", PropertyHint::HINT_NODE_PATH_VALID_TYPES, "Skeleton3D"), "set_pose_source", "get_pose_source");
 
 	ADD_GROUP("Modifier", "modifier_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "modifier_callback_mode_process", PropertyHint::HINT_ENUM, "Physics,Idle,Manual"), "set_modifier_callback_mode_process", "get_modifier_callback_mode_process");
@@ -1326,6 +1494,7 @@ void Skeleton3D::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("bone_enabled_changed", PropertyInfo(Variant::INT, "bone_idx")));
 	ADD_SIGNAL(MethodInfo("bone_list_changed"));
 	ADD_SIGNAL(MethodInfo("show_rest_only_changed"));
+	ADD_SIGNAL(MethodInfo("pose_source_changed"));
 
 	BIND_CONSTANT(NOTIFICATION_UPDATE_SKELETON);
 	BIND_ENUM_CONSTANT(MODIFIER_CALLBACK_MODE_PROCESS_PHYSICS);
@@ -113,7 +113,6 @@ private:
 		Vector3 pose_position;
 		Quaternion pose_rotation;
 		Vector3 pose_scale = Vector3(1, 1, 1);
-		Transform3D global_pose;
 		int nested_set_offset = 0; // Offset in nested set of bone hierarchy.
 		int nested_set_span = 0; // Subtree span in nested set of bone hierarchy.
 
@@ -140,14 +139,12 @@ private:
 		Vector3 pose_position;
 		Quaternion pose_rotation;
 		Vector3 pose_scale = Vector3(1, 1, 1);
-		Transform3D global_pose;
 
 		void save(const Bone &p_bone) {
 			pose_cache = p_bone.pose_cache;
 			pose_position = p_bone.pose_position;
 			pose_rotation = p_bone.pose_rotation;
 			pose_scale = p_bone.pose_scale;
-			global_pose = p_bone.global_pose;
 		}
 
 		void restore(Bone &r_bone) {
@@ -155,7 +152,6 @@ private:
 			r_bone.pose_position = pose_position;
 			r_bone.pose_rotation = pose_rotation;
 			r_bone.pose_scale = pose_scale;
-			r_bone.global_pose = global_pose;
 		}
 	};
 
@@ -178,6 +174,16 @@ private:
 	bool show_rest_only = false;
 	float motion_scale = 1.0;
 
+	// Skeleton whose evaluated pose is shared by the skins registered here.
+	NodePath pose_source;
+	ObjectID pose_source_node_id;
+	bool pose_source_notifying = false;
+	Skeleton3D *_get_pose_source() const;
+	void _update_pose_source_watch(bool p_exiting = false);
+	void _pose_source_node_added(Node *p_node);
+	void _pose_source_exited();
+	void _notify_pose_source_changed();
+
 	uint64_t version = 1;
 
 	void _update_process_order() const;
@@ -191,13 +197,28 @@ private:
 	void _process_changed();
 	void _make_modifiers_dirty();
 
+	// Poses of the bones a modifier with influence below 1 changes, captured before its first change,
+	// so only those bones are blended instead of comparing the whole skeleton.
+	bool modifier_pose_capture = false;
+	LocalVector<bool> modifier_pose_captured; // Indexable with bone index.
+	LocalVector<int> modifier_changed_bones;
+	LocalVector<Transform3D> modifier_old_poses; // Indexable like modifier_changed_bones.
+	void _capture_modifier_pose(int p_bone);
+
 	// Global bone pose calculation.
+	// The nested set is a topological order (parents precede children), so global poses are kept
+	// in flat arrays in that order and propagated by a single linear pass over a range of offsets.
 	mutable LocalVector<int> nested_set_offset_to_bone_index; // Map from Bone::nested_set_offset to bone index.
+	mutable LocalVector<int> nested_set_parent_offsets; // Indexable with Bone::nested_set_offset, -1 for root bones.
+	mutable LocalVector<Transform3D> nested_set_global_poses; // Indexable with Bone::nested_set_offset.
 	mutable LocalVector<bool> bone_global_pose_dirty; // Indexable with Bone::nested_set_offset.
+	mutable int global_pose_dirty_begin = 0; // Range of offsets which may contain dirty global poses.
+	mutable int global_pose_dirty_end = 0;
 	void _update_bones_nested_set() const;
 	int _update_bone_nested_set(int p_bone, int p_offset) const;
 	void _make_bone_global_poses_dirty() const;
 	void _make_bone_global_pose_subtree_dirty(int p_bone) const;
+	void _update_bone_global_poses_range(int p_begin, int p_end) const;
 	void _update_bone_global_pose(int p_bone) const;
 
 #ifndef DISABLE_DEPRECATED
@@ -259,6 +280,9 @@ public:
 	void set_motion_scale(float p_motion_scale);
 	float get_motion_scale() const;
 
+	void set_pose_source(const NodePath &p_pose_source);
+	NodePath get_pose_source() const;
+
 	// bone metadata
 	Variant get_bone_meta(int p_bone, const StringName &p_key) const;
 	void get_bone_meta_list(int p_bone, List<StringName> *p_list) const;
@@ -35,19 +35,24 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
 #include "scene/audio/audio_stream_player.h"
+#include "scene/main/viewport.h"
 #include "scene/resources/animation.h"
 #include "servers/audio/audio_stream.h"
 #include "servers/audio_server.h"
 
 #ifndef _3D_DISABLED
 #include "scene/3d/audio_stream_player_3d.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
 #endif // _3D_DISABLED
 
 #ifdef TOOLS_ENABLED
@@ -485,6 +490,55 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+void AnimationMixer::set_independent(bool p_independent) {
+	if (independent == p_independent) {
+		return;
+	}
+	independent = p_independent;
+	if (!independent) {
+		_finish_parallel_blend();
+	}
+}
+
+bool AnimationMixer::is_independent() const {
+	return independent;
+}
+
+void AnimationMixer::set_lod_node(const NodePath &p_node) {
+	lod_node = p_node;
+	lod_interval = 1;
+	lod_blend_interval = 1;
+	lod_frame = 0;
+}
+
+NodePath AnimationMixer::get_lod_node() const {
+	return lod_node;
+}
+
+void AnimationMixer::set_lod_distance(real_t p_distance) {
+	lod_distance = MAX(p_distance, 0.0);
+}
+
+real_t AnimationMixer::get_lod_distance() const {
+	return lod_distance;
+}
+
+void AnimationMixer::set_lod_max_interval(int p_max_interval) {
+	lod_max_interval = MAX(p_max_interval, 1);
+}
+
+int AnimationMixer::get_lod_max_interval() const {
+	return lod_max_interval;
+}
+
+void AnimationMixer::set_lod_bone_depth(int p_bone_depth) {
+	lod_bone_depth = MAX(p_bone_depth, 0);
+}
+
+int AnimationMixer::get_lod_bone_depth() const {
+	return lod_bone_depth;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -568,6 +622,7 @@ bool AnimationMixer::is_dummy() const {
 /* -------------------------------------------- */
 
 void AnimationMixer::_clear_caches() {
+	_finish_parallel_blend();
 	_init_root_motion_cache();
 	_clear_audio_streams();
 	_clear_playing_caches();
@@ -576,6 +631,9 @@ void AnimationMixer::_clear_caches() {
 	}
 	track_cache.clear();
 	animation_track_num_to_track_cache.clear();
+	animation_track_num_to_key_cursor.clear();
+	has_scene_tracks = false;
+	has_discrete_value_tracks = false;
 	cache_valid = false;
 	capture_cache.clear();
 
@@ -618,12 +676,29 @@ void AnimationMixer::_create_track_num_to_track_cache_for_animation(Ref<Animatio
 	const Vector<Animation::Track *> &tracks = p_animation->get_tracks();
 
 	track_num_to_track_cache.resize(tracks.size());
+	LocalVector<Animation::KeyCursor> &key_cursors = animation_track_num_to_key_cursor.insert(p_animation, LocalVector<Animation::KeyCursor>())->value;
+	key_cursors.resize(tracks.size());
 	for (int i = 0; i < tracks.size(); i++) {
 		TrackCache **track_ptr = track_cache.getptr(tracks[i]->thash);
 		if (track_ptr == nullptr) {
 			track_num_to_track_cache[i] = nullptr;
-		} else {
-			track_num_to_track_cache[i] = *track_ptr;
+			continue;
+		}
+		track_num_to_track_cache[i] = *track_ptr;
+
+		switch (tracks[i]->type) {
+			case Animation::TYPE_METHOD:
+			case Animation::TYPE_AUDIO:
+			case Animation::TYPE_ANIMATION: {
+				has_scene_tracks = true;
+			} break;
+			case Animation::TYPE_VALUE: {
+				if (p_animation->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE) {
+					has_discrete_value_tracks = true;
+				}
+			} break;
+			default: {
+			} break;
 		}
 	}
 }
@@ -779,6 +854,9 @@ bool AnimationMixer::_update_caches() {
 							if (bone_idx != -1) {
 								has_rest = true;
 								track_xform->bone_idx = bone_idx;
+								for (int parent = sk->get_bone_parent(bone_idx); parent >= 0; parent = sk->get_bone_parent(parent)) {
+									track_xform->bone_depth++;
+								}
 								Transform3D rest = sk->get_bone_rest(bone_idx);
 								track_xform->init_loc = rest.origin;
 								track_xform->init_rot = rest.basis.get_rotation_quaternion();
@@ -965,6 +1043,9 @@ bool AnimationMixer::_update_caches() {
 	}
 
 	animation_track_num_to_track_cache.clear();
+	animation_track_num_to_key_cursor.clear();
+	has_scene_tracks = false;
+	has_discrete_value_tracks = false;
 	for (const StringName &E : sname_list) {
 		Ref<Animation> anim = get_animation(E);
 		_create_track_num_to_track_cache_for_animation(anim);
@@ -982,6 +1063,7 @@ bool AnimationMixer::_update_caches() {
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	_finish_parallel_blend();
 	_blend_init();
 	if (_blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
@@ -994,6 +1076,113 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+LocalVector<ObjectID> AnimationMixer::parallel_blend_queue;
+bool AnimationMixer::parallel_blend_flush_queued = false;
+
+bool AnimationMixer::_can_blend_in_parallel() const {
+	// Scripts overriding the key post process could touch the scene, so they keep blending on the main thread.
+	if (!independent || !Thread::is_main_thread() || GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		return false;
+	}
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+#endif // TOOLS_ENABLED
+	return true;
+}
+
+void AnimationMixer::_queue_parallel_blend(double p_delta, bool p_update_only) {
+	_finish_parallel_blend();
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_capture(p_delta);
+	_blend_calc_total_weight();
+
+	// Method, audio, animation and discrete value tracks act on the scene while blending, so these can't leave the main thread.
+	bool has_discrete_writes = has_discrete_value_tracks && callback_mode_discrete != ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS;
+	if (has_scene_tracks || has_discrete_writes) {
+		_blend_process(p_delta, p_update_only);
+		_blend_apply();
+		_blend_post_process();
+		emit_signal(SNAME("mixer_applied"));
+		clear_animation_instances();
+		return;
+	}
+
+	parallel_blend_pending = true;
+	parallel_blend_processed = false;
+	parallel_blend_delta = p_delta;
+	parallel_blend_update_only = p_update_only;
+	if (!parallel_blend_queued) {
+		parallel_blend_queued = true;
+		parallel_blend_queue.push_back(get_instance_id());
+	}
+	if (!parallel_blend_flush_queued) {
+		parallel_blend_flush_queued = true;
+		callable_mp_static(&AnimationMixer::_flush_parallel_blend_queue).call_deferred();
+	}
+}
+
+void AnimationMixer::_finish_parallel_blend() {
+	if (!parallel_blend_pending) {
+		return;
+	}
+	parallel_blend_pending = false;
+
+	if (!parallel_blend_processed) {
+		_blend_process(parallel_blend_delta, parallel_blend_update_only);
+	}
+	parallel_blend_processed = false;
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+	clear_animation_instances();
+}
+
+void AnimationMixer::_parallel_blend_task(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	mixer->_blend_process(mixer->parallel_blend_delta, mixer->parallel_blend_update_only);
+	mixer->parallel_blend_processed = true;
+}
+
+void AnimationMixer::_flush_parallel_blend_queue() {
+	parallel_blend_flush_queued = false;
+
+	LocalVector<ObjectID> queue;
+	SWAP(queue, parallel_blend_queue);
+
+	LocalVector<AnimationMixer *> mixers;
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (!mixer) {
+			continue;
+		}
+		mixer->parallel_blend_queued = false;
+		if (mixer->parallel_blend_pending && !mixer->parallel_blend_processed) {
+			mixers.push_back(mixer);
+		}
+	}
+
+	if (mixers.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_parallel_blend_task, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (mixers.size() == 1) {
+		_parallel_blend_task(mixers.ptr(), 0);
+	}
+
+	// Applying may run signal callbacks which free other mixers, so look them up again.
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer) {
+			mixer->_finish_parallel_blend();
+		}
+	}
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1102,6 +1291,7 @@ void AnimationMixer::blend_capture(double p_delta) {
 	if (Animation::is_less_or_equal_approx(capture_cache.remain, 0)) {
 		if (capture_cache.animation.is_valid()) {
 			animation_track_num_to_track_cache.erase(capture_cache.animation);
+			animation_track_num_to_key_cursor.erase(capture_cache.animation);
 		}
 		capture_cache.clear();
 		return;
@@ -1187,6 +1377,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 #endif // _3D_DISABLED
 		ERR_CONTINUE_EDMSG(!animation_track_num_to_track_cache.has(a), "No animation in cache.");
 		LocalVector<TrackCache *> &track_num_to_track_cache = animation_track_num_to_track_cache[a];
+		Animation::KeyCursor *key_cursors = animation_track_num_to_key_cursor[a].ptr();
 		const Vector<Animation::Track *> tracks = a->get_tracks();
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		real_t a_length = a->get_length();
@@ -1200,6 +1391,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			if (track == nullptr) {
 				continue; // No path, but avoid error spamming.
 			}
+			if (_is_lod_reduced_bone(track)) {
+				continue; // Keeps its last pose.
+			}
 			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights_count ? track_weights_ptr[blend_idx] * weight : weight;
@@ -1348,7 +1542,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
+						Error err = a->try_position_track_interpolate(i, time, &loc, false, &key_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1436,7 +1630,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
+						Error err = a->try_rotation_track_interpolate(i, time, &rot, false, &key_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1524,7 +1718,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
+						Error err = a->try_scale_track_interpolate(i, time, &scale, false, &key_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1540,7 +1734,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+					Error err = a->try_blend_shape_track_interpolate(i, time, &value, false, &key_cursors[i]);
 					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 					if (err != OK) {
 						continue;
@@ -1868,35 +2062,14 @@ void AnimationMixer::_blend_apply() {
 					root_motion_position_accumulator = t->loc;
 					root_motion_rotation_accumulator = t->rot;
 					root_motion_scale_accumulator = t->scale;
-				} else if (t->skeleton_id.is_valid() && t->bone_idx >= 0) {
-					Skeleton3D *t_skeleton = ObjectDB::get_instance<Skeleton3D>(t->skeleton_id);
-					if (!t_skeleton) {
-						return;
-					}
-					if (t->loc_used) {
-						t_skeleton->set_bone_pose_position(t->bone_idx, t->loc);
-					}
-					if (t->rot_used) {
-						t_skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
-					}
-					if (t->scale_used) {
-						t_skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
-					}
-
-				} else if (!t->skeleton_id.is_valid()) {
-					Node3D *t_node_3d = ObjectDB::get_instance<Node3D>(t->object_id);
-					if (!t_node_3d) {
+				} else if (!_is_lod_reduced_bone(t)) {
+					// With a LOD interval, ease from the pose applied last and reach the blended pose when the next blend is due.
+					t->lod_from_loc = t->lod_applied ? t->lod_loc : t->loc;
+					t->lod_from_rot = t->lod_applied ? t->lod_rot : t->rot.normalized();
+					t->lod_from_scale = t->lod_applied ? t->lod_scale : t->scale;
+					if (!_apply_transform_track(t, 1.0 / lod_interval)) {
 						return;
 					}
-					if (t->loc_used) {
-						t_node_3d->set_position(t->loc);
-					}
-					if (t->rot_used) {
-						t_node_3d->set_rotation(t->rot.get_euler());
-					}
-					if (t->scale_used) {
-						t_node_3d->set_scale(t->scale);
-					}
 				}
 #endif // _3D_DISABLED
 			} break;
@@ -2014,6 +2187,114 @@ void AnimationMixer::_blend_apply() {
 	}
 }
 
+#ifndef _3D_DISABLED
+bool AnimationMixer::_apply_transform_track(TrackCacheTransform *p_track, real_t p_lod_weight) {
+	Vector3 loc = p_track->loc;
+	Quaternion rot = p_track->rot;
+	Vector3 scale = p_track->scale;
+	if (p_lod_weight < 1.0) {
+		loc = p_track->lod_from_loc.lerp(loc, p_lod_weight);
+		rot = p_track->lod_from_rot.slerp(rot.normalized(), p_lod_weight);
+		scale = p_track->lod_from_scale.lerp(scale, p_lod_weight);
+	}
+	p_track->lod_applied = true;
+	p_track->lod_loc = loc;
+	p_track->lod_rot = rot.normalized();
+	p_track->lod_scale = scale;
+
+	if (p_track->skeleton_id.is_valid() && p_track->bone_idx >= 0) {
+		Skeleton3D *t_skeleton = ObjectDB::get_instance<Skeleton3D>(p_track->skeleton_id);
+		if (!t_skeleton) {
+			return false;
+		}
+		if (p_track->loc_used) {
+			t_skeleton->set_bone_pose_position(p_track->bone_idx, loc);
+		}
+		if (p_track->rot_used) {
+			t_skeleton->set_bone_pose_rotation(p_track->bone_idx, rot);
+		}
+		if (p_track->scale_used) {
+			t_skeleton->set_bone_pose_scale(p_track->bone_idx, scale);
+		}
+
+	} else if (!p_track->skeleton_id.is_valid()) {
+		Node3D *t_node_3d = ObjectDB::get_instance<Node3D>(p_track->object_id);
+		if (!t_node_3d) {
+			return false;
+		}
+		if (p_track->loc_used) {
+			t_node_3d->set_position(loc);
+		}
+		if (p_track->rot_used) {
+			t_node_3d->set_rotation(rot.get_euler());
+		}
+		if (p_track->scale_used) {
+			t_node_3d->set_scale(scale);
+		}
+	}
+	return true;
+}
+#endif // _3D_DISABLED
+
+bool AnimationMixer::_lod_process(double &r_delta) {
+	lod_interval = 1;
+	if (lod_node.is_empty()) {
+		return true;
+	}
+
+#ifndef _3D_DISABLED
+	const Node3D *node_3d = Object::cast_to<Node3D>(get_node_or_null(lod_node));
+	if (node_3d) {
+		// Nothing is blended while off screen, the time is caught up once visible again.
+		const VisibleOnScreenNotifier3D *notifier = Object::cast_to<VisibleOnScreenNotifier3D>(node_3d);
+		if (notifier && !notifier->is_on_screen()) {
+			lod_delta += r_delta;
+			lod_frame = lod_max_interval;
+			return false;
+		}
+
+		const Camera3D *camera = get_viewport() ? get_viewport()->get_camera_3d() : nullptr;
+		if (camera && lod_distance > 0.0) {
+			real_t distance = camera->get_global_position().distance_to(node_3d->get_global_position());
+			lod_interval = CLAMP(1 + int(distance / lod_distance), 1, lod_max_interval);
+		}
+	}
+#endif // _3D_DISABLED
+
+	lod_delta += r_delta;
+	lod_frame++;
+	if (lod_frame < lod_interval) {
+		_lod_interpolate();
+		return false;
+	}
+	lod_frame = 0;
+	lod_blend_interval = lod_interval;
+	r_delta = lod_delta;
+	lod_delta = 0.0;
+	return true;
+}
+
+void AnimationMixer::_lod_interpolate() {
+#ifndef _3D_DISABLED
+	if (!cache_valid) {
+		return;
+	}
+	// The interval may have grown since the last blend, whose pose must not be eased away from.
+	real_t weight = MIN(real_t(lod_frame + 1) / lod_blend_interval, 1.0);
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		TrackCache *track = K.value;
+		if (track->type != Animation::TYPE_POSITION_3D || track->root_motion || _is_lod_reduced_bone(track)) {
+			continue;
+		}
+		TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+		if (!t->lod_applied || (!deterministic && Math::is_zero_approx(t->total_weight))) {
+			continue;
+		}
+		_apply_transform_track(t, weight);
+	}
+#endif // _3D_DISABLED
+}
+
 void AnimationMixer::_call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred) {
 	// Separate function to use alloca() more efficiently
 	const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * p_params.size());
@@ -2301,6 +2582,7 @@ void AnimationMixer::capture(const StringName &p_name, double p_duration, Tween:
 	capture_cache.ease_type = p_ease_type;
 	if (capture_cache.animation.is_valid()) {
 		animation_track_num_to_track_cache.erase(capture_cache.animation);
+		animation_track_num_to_key_cursor.erase(capture_cache.animation);
 	}
 	capture_cache.animation.instantiate();
 
@@ -2349,14 +2631,24 @@ void AnimationMixer::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
-			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+			double delta = get_process_delta_time();
+			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE && _lod_process(delta)) {
+				if (_can_blend_in_parallel()) {
+					_queue_parallel_blend(delta);
+				} else {
+					_process_animation(delta);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+			double delta = get_physics_process_delta_time();
+			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS && _lod_process(delta)) {
+				if (_can_blend_in_parallel()) {
+					_queue_parallel_blend(delta);
+				} else {
+					_process_animation(delta);
+				}
 			}
 		} break;
 
@@ -2407,6 +2699,17 @@ void AnimationMixer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_deterministic", "deterministic"), &AnimationMixer::set_deterministic);
 	ClassDB::bind_method(D_METHOD("is_deterministic"), &AnimationMixer::is_deterministic);
+	ClassDB::bind_method(D_METHOD("set_independent", "independent"), &AnimationMixer::set_independent);
+	ClassDB::bind_method(D_METHOD("is_independent"), &AnimationMixer::is_independent);
+
+	ClassDB::bind_method(D_METHOD("set_lod_node", "node"), &AnimationMixer::set_lod_node);
+	ClassDB::bind_method(D_METHOD("get_lod_node"), &AnimationMixer::get_lod_node);
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &AnimationMixer::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &AnimationMixer::get_lod_distance);
+	ClassDB::bind_method(D_METHOD("set_lod_max_interval", "max_interval"), &AnimationMixer::set_lod_max_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_max_interval"), &AnimationMixer::get_lod_max_interval);
+	ClassDB::bind_method(D_METHOD("set_lod_bone_depth", "bone_depth"), &AnimationMixer::set_lod_bone_depth);
+	ClassDB::bind_method(D_METHOD("get_lod_bone_depth"), &AnimationMixer::get_lod_bone_depth);
 
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
@@ -2451,6 +2754,7 @@ void AnimationMixer::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "independent"), "set_independent", "is_independent");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reset_on_save", PropertyHint::HINT_NONE, ""), "set_reset_on_save_enabled", "is_reset_on_save_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_node"), "set_root_node", "get_root_node");
 
@@ -2458,6 +2762,12 @@ void AnimationMixer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "root_motion_local"), "set_root_motion_local", "is_root_motion_local");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_node", PropertyHint::HINT_NODE_PATH_VALID_TYPES, "Node3D"), "set_lod_node", "get_lod_node");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PropertyHint::HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_max_interval", PropertyHint::HINT_RANGE, "1,60,1,or_greater"), "set_lod_max_interval", "get_lod_max_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_bone_depth", PropertyHint::HINT_RANGE, "0,32,1,or_greater"), "set_lod_bone_depth", "get_lod_bone_depth");
+
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PropertyHint::HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
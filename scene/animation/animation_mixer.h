@@ -180,6 +180,16 @@ protected:
 		Quaternion rot;
 		Vector3 scale;
 
+		// Level of detail.
+		int bone_depth = 0;
+		bool lod_applied = false;
+		Vector3 lod_from_loc;
+		Quaternion lod_from_rot;
+		Vector3 lod_from_scale;
+		Vector3 lod_loc; // The pose applied last.
+		Quaternion lod_rot;
+		Vector3 lod_scale;
+
 		TrackCacheTransform(const TrackCacheTransform &p_other) :
 				TrackCache(p_other),
 #ifndef _3D_DISABLED
@@ -313,6 +323,8 @@ protected:
 	RootMotionCache root_motion_cache;
 	AHashMap<Animation::TypeHash, TrackCache *, HashHasher> track_cache;
 	AHashMap<Ref<Animation>, LocalVector<TrackCache *>> animation_track_num_to_track_cache;
+	// Last sampled keys, per animation and track so blended animations on the same path don't reseek each other.
+	AHashMap<Ref<Animation>, LocalVector<Animation::KeyCursor>> animation_track_num_to_key_cursor;
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
 
@@ -333,6 +345,44 @@ protected:
 	int track_count = 0;
 	bool deterministic = false;
 
+	/* ---- Parallel blending ---- */
+	// Independent mixers blend their tracks on worker threads at the end of the frame, then apply on the main thread.
+	bool independent = false;
+	bool has_scene_tracks = false; // Method, audio and animation tracks, which must run on the main thread.
+	bool has_discrete_value_tracks = false;
+	bool parallel_blend_queued = false;
+	bool parallel_blend_pending = false;
+	bool parallel_blend_processed = false;
+	double parallel_blend_delta = 0.0;
+	bool parallel_blend_update_only = false;
+	static LocalVector<ObjectID> parallel_blend_queue;
+	static bool parallel_blend_flush_queued;
+
+	bool _can_blend_in_parallel() const;
+	void _queue_parallel_blend(double p_delta, bool p_update_only = false);
+	void _finish_parallel_blend();
+	static void _parallel_blend_task(void *p_userdata, uint32_t p_index);
+	static void _flush_parallel_blend_queue();
+
+	/* ---- Level of detail ---- */
+	NodePath lod_node;
+	real_t lod_distance = 0.0;
+	int lod_max_interval = 4;
+	int lod_bone_depth = 0;
+	int lod_interval = 1; // Frames between blends, from the distance to the camera.
+	int lod_blend_interval = 1; // The interval of the last blend, which the frames after it ease over.
+	int lod_frame = 0; // Frames since the last blend.
+	double lod_delta = 0.0; // Time accumulated since the last blend.
+
+	bool _lod_process(double &r_delta);
+	void _lod_interpolate();
+	_FORCE_INLINE_ bool _is_lod_reduced_bone(const TrackCache *p_track) const {
+		return lod_bone_depth > 0 && lod_interval > 1 && p_track->type == Animation::TYPE_POSITION_3D && static_cast<const TrackCacheTransform *>(p_track)->bone_depth > lod_bone_depth;
+	}
+#ifndef _3D_DISABLED
+	bool _apply_transform_track(TrackCacheTransform *p_track, real_t p_lod_weight);
+#endif // _3D_DISABLED
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
 	bool root_motion_local = false;
@@ -429,6 +479,22 @@ public:
 	void set_deterministic(bool p_deterministic);
 	bool is_deterministic() const;
 
+	void set_independent(bool p_independent);
+	bool is_independent() const;
+
+	/* ---- Level of detail ---- */
+	void set_lod_node(const NodePath &p_node);
+	NodePath get_lod_node() const;
+
+	void set_lod_distance(real_t p_distance);
+	real_t get_lod_distance() const;
+
+	void set_lod_max_interval(int p_max_interval);
+	int get_lod_max_interval() const;
+
+	void set_lod_bone_depth(int p_bone_depth);
+	int get_lod_bone_depth() const;
+
 	void set_root_node(const NodePath &p_path);
 	NodePath get_root_node() const;
 
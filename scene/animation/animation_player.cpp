@@ -601,6 +601,13 @@ String AnimationPlayer::get_current_animation() const {
 }
 
 void AnimationPlayer::set_assigned_animation(const String &p_animation) {
+	if (p_animation.is_empty()) {
+		// Forget the animation without resetting the values it animated.
+		_stop_internal(true, true);
+		playback.current.pos = 0;
+		playback.assigned = StringName();
+		return;
+	}
 	if (is_playing()) {
 		float speed = playback.current.speed_scale;
 		play(p_animation, -1.0, speed, std::signbit(speed));
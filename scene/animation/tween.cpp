@@ -32,6 +32,7 @@
 
 #include "tween.h"
 
+#include "core/variant/variant_internal.h"
 #include "scene/animation/easing_equations.h"
 #include "scene/main/node.h"
 #include "scene/resources/animation.h"
@@ -559,6 +560,84 @@ double PropertyTweener::_get_custom_interpolated_value(const Variant &p_value) {
 	return result;
 }
 
+void PropertyTweener::_update_typed_setter(const Object *p_target) {
+	typed_setter = nullptr;
+
+	// Scripts and extensions may intercept the property, so only plain native properties qualify.
+	if (property.size() != 1 || custom_method.is_valid() || p_target->get_script_instance()) {
+		return;
+	}
+	const Variant::Type type = final_val.get_type();
+	if (type != Variant::FLOAT && type != Variant::VECTOR2 && type != Variant::VECTOR3 && type != Variant::COLOR) {
+		return;
+	}
+	if (initial_val.get_type() != type || delta_val.get_type() != type) {
+		return;
+	}
+
+	const StringName class_name = p_target->get_class_name();
+	const ClassDB::APIType api = ClassDB::get_api_type(class_name);
+	if (api != ClassDB::API_CORE && api != ClassDB::API_EDITOR) {
+		return;
+	}
+	bool valid = false;
+	if (ClassDB::get_property_index(class_name, property[0], &valid) != -1 || !valid) {
+		return;
+	}
+	const StringName setter_name = ClassDB::get_property_setter(class_name, property[0]);
+	if (setter_name == StringName()) {
+		return;
+	}
+	MethodBind *setter = ClassDB::get_method(class_name, setter_name);
+	if (!setter || setter->is_vararg() || setter->get_argument_count() != 1 || setter->get_argument_type(0) != type) {
+		return;
+	}
+	typed_setter = setter;
+}
+
+void PropertyTweener::_call_typed_setter(Object *p_target, const Variant &p_value) const {
+	const void *arg = nullptr;
+	switch (p_value.get_type()) {
+		case Variant::FLOAT: {
+			arg = VariantInternal::get_float(&p_value);
+		} break;
+		case Variant::VECTOR2: {
+			arg = VariantInternal::get_vector2(&p_value);
+		} break;
+		case Variant::VECTOR3: {
+			arg = VariantInternal::get_vector3(&p_value);
+		} break;
+		case Variant::COLOR: {
+			arg = VariantInternal::get_color(&p_value);
+		} break;
+		default: {
+			ERR_FAIL();
+		}
+	}
+	const void *args[1] = { arg };
+	typed_setter->ptrcall(p_target, args, nullptr);
+}
+
+Variant PropertyTweener::_interpolate_typed(real_t p_weight) const {
+	switch (initial_val.get_type()) {
+		case Variant::FLOAT: {
+			return *VariantInternal::get_float(&initial_val) + *VariantInternal::get_float(&delta_val) * p_weight;
+		}
+		case Variant::VECTOR2: {
+			return *VariantInternal::get_vector2(&initial_val) + *VariantInternal::get_vector2(&delta_val) * p_weight;
+		}
+		case Variant::VECTOR3: {
+			return *VariantInternal::get_vector3(&initial_val) + *VariantInternal::get_vector3(&delta_val) * p_weight;
+		}
+		case Variant::COLOR: {
+			return *VariantInternal::get_color(&initial_val) + *VariantInternal::get_color(&delta_val) * p_weight;
+		}
+		default: {
+			ERR_FAIL_V(initial_val);
+		}
+	}
+}
+
 Ref<PropertyTweener> PropertyTweener::from(const Variant &p_value) {
 	Ref<Tween> tween = _get_tween();
 	ERR_FAIL_COND_V(tween.is_null(), nullptr);
@@ -625,6 +704,7 @@ void PropertyTweener::start() {
 	}
 
 	delta_val = Animation::subtract_variant(final_val, initial_val);
+	_update_typed_setter(target_instance);
 }
 
 bool PropertyTweener::step(double &r_delta) {
@@ -647,11 +727,26 @@ bool PropertyTweener::step(double &r_delta) {
 		initial_val = target_instance->get_indexed(property);
 		delta_val = Animation::subtract_variant(final_val, initial_val);
 		do_continue_delayed = false;
+		_update_typed_setter(target_instance);
+	}
+
+	double time = MIN(elapsed_time - delay, duration);
+
+	if (typed_setter) {
+		// Skip Variant interpolation and the property lookup of set_indexed().
+		if (time < duration) {
+			_call_typed_setter(target_instance, _interpolate_typed(Tween::run_equation(trans_type, ease_type, time, 0.0, 1.0, duration)));
+			r_delta = 0;
+			return true;
+		}
+		_call_typed_setter(target_instance, final_val);
+		r_delta = elapsed_time - delay - duration;
+		_finish();
+		return false;
 	}
 
 	Ref<Tween> tween = _get_tween();
 
-	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
 		if (custom_method.is_valid()) {
 			const Variant t = tween->interpolate_variant(0.0, 1.0, time, duration, trans_type, ease_type);
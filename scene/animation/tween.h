@@ -203,6 +203,9 @@ class PropertyTweener : public Tweener {
 	GDCLASS(PropertyTweener, Tweener);
 
 	double _get_custom_interpolated_value(const Variant &p_value);
+	void _update_typed_setter(const Object *p_target);
+	void _call_typed_setter(Object *p_target, const Variant &p_value) const;
+	Variant _interpolate_typed(real_t p_weight) const;
 
 public:
 	Ref<PropertyTweener> from(const Variant &p_value);
@@ -233,6 +236,9 @@ private:
 
 	Ref<RefCounted> ref_copy; // Makes sure that RefCounted objects are not freed too early.
 
+	// Native setter of a float, Vector2, Vector3 or Color property, called directly instead of going through set_indexed().
+	MethodBind *typed_setter = nullptr;
+
 	double duration = 0;
 	Tween::TransitionType trans_type = Tween::TRANS_MAX; // This is set inside set_tween();
 	Tween::EaseType ease_type = Tween::EASE_MAX;
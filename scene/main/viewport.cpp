@@ -3808,6 +3808,17 @@ bool Viewport::is_snap_2d_vertices_to_pixel_enabled() const {
 	return snap_2d_vertices_to_pixel;
 }
 
+void Viewport::set_canvas_dirty_tracking(bool p_enable) {
+	ERR_MAIN_THREAD_GUARD;
+	canvas_dirty_tracking = p_enable;
+	RS::get_singleton()->viewport_set_canvas_dirty_tracking(viewport, canvas_dirty_tracking);
+}
+
+bool Viewport::is_canvas_dirty_tracking_enabled() const {
+	ERR_READ_THREAD_GUARD_V(false);
+	return canvas_dirty_tracking;
+}
+
 bool Viewport::gui_is_dragging() const {
 	ERR_READ_THREAD_GUARD_V(false);
 	return get_section_root_viewport()->gui.global_dragging;
@@ -5035,6 +5046,9 @@ void Viewport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_snap_2d_vertices_to_pixel", "enabled"), &Viewport::set_snap_2d_vertices_to_pixel);
 	ClassDB::bind_method(D_METHOD("is_snap_2d_vertices_to_pixel_enabled"), &Viewport::is_snap_2d_vertices_to_pixel_enabled);
 
+	ClassDB::bind_method(D_METHOD("set_canvas_dirty_tracking", "enabled"), &Viewport::set_canvas_dirty_tracking);
+	ClassDB::bind_method(D_METHOD("is_canvas_dirty_tracking_enabled"), &Viewport::is_canvas_dirty_tracking_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_positional_shadow_atlas_quadrant_subdiv", "quadrant", "subdiv"), &Viewport::set_positional_shadow_atlas_quadrant_subdiv);
 	ClassDB::bind_method(D_METHOD("get_positional_shadow_atlas_quadrant_subdiv", "quadrant"), &Viewport::get_positional_shadow_atlas_quadrant_subdiv);
 
@@ -5132,6 +5146,7 @@ void Viewport::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "snap_2d_transforms_to_pixel"), "set_snap_2d_transforms_to_pixel", "is_snap_2d_transforms_to_pixel_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "snap_2d_vertices_to_pixel"), "set_snap_2d_vertices_to_pixel", "is_snap_2d_vertices_to_pixel_enabled");
 	ADD_GROUP("Rendering", "");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "canvas_dirty_tracking"), "set_canvas_dirty_tracking", "is_canvas_dirty_tracking_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "msaa_2d", PropertyHint::HINT_ENUM, String::utf8("Disabled (Fastest),2× (Average),4× (Slow),8× (Slowest)")), "set_msaa_2d", "get_msaa_2d");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "msaa_3d", PropertyHint::HINT_ENUM, String::utf8("Disabled (Fastest),2× (Average),4× (Slow),8× (Slowest)")), "set_msaa_3d", "get_msaa_3d");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "screen_space_aa", PropertyHint::HINT_ENUM, "Disabled (Fastest),FXAA (Fast)"), "set_screen_space_aa", "get_screen_space_aa");
@@ -274,6 +274,8 @@ private:
 	bool snap_2d_transforms_to_pixel = false;
 	bool snap_2d_vertices_to_pixel = false;
 
+	bool canvas_dirty_tracking = false;
+
 #if !defined(PHYSICS_2D_DISABLED) || !defined(PHYSICS_3D_DISABLED)
 	bool physics_object_picking = false;
 	bool physics_object_picking_sort = false;
@@ -671,6 +673,9 @@ public:
 	void set_snap_2d_vertices_to_pixel(bool p_enable);
 	bool is_snap_2d_vertices_to_pixel_enabled() const;
 
+	void set_canvas_dirty_tracking(bool p_enable);
+	bool is_canvas_dirty_tracking_enabled() const;
+
 	void set_input_as_handled();
 	bool is_input_handled() const;
 
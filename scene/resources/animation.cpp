@@ -1187,7 +1187,7 @@ Error Animation::position_track_get_key(int p_track, int p_key, Vector3 *r_posit
 	return OK;
 }
 
-Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_POSITION_3D, ERR_INVALID_PARAMETER);
@@ -1195,7 +1195,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 	PositionTrack *tt = static_cast<PositionTrack *>(t);
 
 	if (tt->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1204,7 +1204,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, p_backward);
+	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1267,7 +1267,7 @@ Error Animation::rotation_track_get_key(int p_track, int p_key, Quaternion *r_ro
 	return OK;
 }
 
-Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward) const {
+Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_3D, ERR_INVALID_PARAMETER);
@@ -1275,7 +1275,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 	RotationTrack *rt = static_cast<RotationTrack *>(t);
 
 	if (rt->compressed_track >= 0) {
-		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation)) {
+		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1284,7 +1284,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 
 	bool ok = false;
 
-	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, p_backward);
+	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1347,7 +1347,7 @@ Error Animation::scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) c
 	return OK;
 }
 
-Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_SCALE_3D, ERR_INVALID_PARAMETER);
@@ -1355,7 +1355,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 	ScaleTrack *st = static_cast<ScaleTrack *>(t);
 
 	if (st->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1364,7 +1364,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, p_backward);
+	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1427,7 +1427,7 @@ Error Animation::blend_shape_track_get_key(int p_track, int p_key, float *r_blen
 	return OK;
 }
 
-Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, bool p_backward) const {
+Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BLEND_SHAPE, ERR_INVALID_PARAMETER);
@@ -1435,7 +1435,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 	BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 
 	if (bst->compressed_track >= 0) {
-		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation)) {
+		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1444,7 +1444,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 
 	bool ok = false;
 
-	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, p_backward);
+	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -2454,6 +2454,41 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward, bo
 	return middle;
 }
 
+template <typename K>
+int Animation::_find_from_cursor(const Vector<K> &p_keys, double p_time, bool p_backward, int32_t &r_cursor) const {
+	int len = p_keys.size();
+	const K *keys = p_keys.ptr();
+
+	// Checks whether _find() would return the key, ignoring keys closer together than the approximation.
+	auto is_found_key = [&](int p_idx) -> bool {
+		if (p_idx < 0 || p_idx >= len) {
+			return false;
+		}
+		double key_time = keys[p_idx].time;
+		if (Math::is_equal_approx(p_time, key_time)) {
+			return true;
+		}
+		if (!p_backward) {
+			return key_time < p_time && (p_idx + 1 == len || (p_time < keys[p_idx + 1].time && !Math::is_equal_approx(p_time, (double)keys[p_idx + 1].time)));
+		}
+		return key_time > p_time && (p_idx == 0 || (p_time > keys[p_idx - 1].time && !Math::is_equal_approx(p_time, (double)keys[p_idx - 1].time)));
+	};
+
+	// Sequential playback finds the same key as last time, or the one next to it in either direction.
+	if (is_found_key(r_cursor)) {
+		return r_cursor;
+	}
+	if (is_found_key(r_cursor + 1)) {
+		return ++r_cursor;
+	}
+	if (is_found_key(r_cursor - 1)) {
+		return --r_cursor;
+	}
+
+	r_cursor = _find(p_keys, p_time, p_backward);
+	return r_cursor;
+}
+
 // Linear interpolation for anytype.
 
 Vector3 Animation::_interpolate(const Vector3 &p_a, const Vector3 &p_b, real_t p_c) const {
@@ -2523,7 +2558,7 @@ Variant Animation::_cubic_interpolate_angle_in_time(const Variant &p_pre_a, cons
 }
 
 template <typename T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward) const {
+T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward, KeyCursor *r_cursor) const {
 	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
 
 	if (len <= 0) {
@@ -2541,7 +2576,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 		return p_keys[0].value;
 	}
 
-	int idx = _find(p_keys, p_time, p_backward);
+	int idx = r_cursor ? _find_from_cursor(p_keys, p_time, p_backward, r_cursor->key) : _find(p_keys, p_time, p_backward);
 
 	ERR_FAIL_COND_V(idx == -2, T());
 	int maxi = len - 1;
@@ -5250,13 +5285,13 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
-bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
+bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret, KeyCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5274,13 +5309,13 @@ bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, do
 	return true;
 }
 
-bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const {
+bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret, KeyCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5297,13 +5332,13 @@ bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, d
 
 	return true;
 }
-bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const {
+bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret, KeyCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5322,7 +5357,7 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 }
 
 template <uint32_t COMPONENTS>
-bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index, KeyCursor *r_cursor) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
@@ -5332,12 +5367,23 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
+	// Find the last page starting at or before the time, trying the page of the cursor first.
+	const uint32_t page_count = compression.pages.size();
 	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	if (r_cursor && r_cursor->page >= 0 && (uint32_t)r_cursor->page < page_count && compression.pages[r_cursor->page].time_offset <= p_time && ((uint32_t)r_cursor->page + 1 == page_count || compression.pages[r_cursor->page + 1].time_offset > p_time)) {
+		page_index = r_cursor->page;
+	} else {
+		uint32_t low = 0;
+		uint32_t high = page_count;
+		while (low < high) {
+			uint32_t middle = (low + high) / 2;
+			if (compression.pages[middle].time_offset > p_time) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
 		}
-		page_index = i;
+		page_index = int32_t(low) - 1;
 	}
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
@@ -5350,26 +5396,47 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
 
 	int32_t packet_idx = 0;
-	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
-	uint32_t base_frame = time_keys[0];
-
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
-
-		if (frame_time > p_time) {
-			break;
-		}
-
-		if (key_index) {
+	if (key_index) {
+		// Counting the keys needs to walk all the earlier packets anyway.
+		for (uint32_t i = 1; i < time_key_count; i++) {
+			double frame_time = double(time_keys[i * 2 + 0]) * frame_to_sec + page_base_time;
+			if (frame_time > p_time) {
+				break;
+			}
 			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
+			packet_idx = i;
 		}
+	} else {
+		// Find the last packet starting at or before the time, trying the packet of the cursor first.
+		auto get_packet_time = [&](uint32_t p_packet) -> double {
+			return double(time_keys[p_packet * 2 + 0]) * frame_to_sec + page_base_time;
+		};
+		int32_t cursor_packet = r_cursor && r_cursor->page == page_index ? r_cursor->packet : -1;
+		if (cursor_packet >= 0 && (uint32_t)cursor_packet < time_key_count && (cursor_packet == 0 || get_packet_time(cursor_packet) <= p_time) && ((uint32_t)cursor_packet + 1 == time_key_count || get_packet_time(cursor_packet + 1) > p_time)) {
+			packet_idx = cursor_packet;
+		} else {
+			uint32_t low = 1;
+			uint32_t high = time_key_count;
+			while (low < high) {
+				uint32_t middle = (low + high) / 2;
+				if (get_packet_time(middle) > p_time) {
+					high = middle;
+				} else {
+					low = middle + 1;
+				}
+			}
+			packet_idx = low - 1;
+		}
+	}
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+	if (r_cursor) {
+		r_cursor->page = page_index;
+		r_cursor->packet = packet_idx;
 	}
 
+	uint32_t base_frame = time_keys[packet_idx * 2 + 0];
+	double packet_time = double(base_frame) * frame_to_sec + page_base_time;
+
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
 
 	uint16_t time_key_data = time_keys[packet_idx * 2 + 1];
@@ -509,6 +509,22 @@ double AudioStreamWAV::get_length() const {
 	return double(len) / mix_rate;
 }
 
+bool AudioStreamWAV::get_loop_range(double &r_loop_begin, double &r_loop_end) const {
+	switch (loop_mode) {
+		case LOOP_DISABLED:
+			r_loop_begin = 0.0;
+			r_loop_end = -1.0;
+			return true;
+		case LOOP_FORWARD:
+			r_loop_begin = double(loop_begin) / mix_rate;
+			r_loop_end = double(loop_end) / mix_rate;
+			return true;
+		default:
+			// Seeking doesn't restore the direction of ping-pong and backward loops.
+			return false;
+	}
+}
+
 bool AudioStreamWAV::is_monophonic() const {
 	return false;
 }
@@ -155,6 +155,7 @@ public:
 	bool is_stereo() const;
 
 	virtual double get_length() const override; //if supported, otherwise return 0
+	virtual bool get_loop_range(double &r_loop_begin, double &r_loop_end) const override;
 
 	virtual bool is_monophonic() const override;
 
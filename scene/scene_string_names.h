@@ -95,6 +95,7 @@ public:
 	const StringName skeleton_updated = "skeleton_updated";
 	const StringName bone_enabled_changed = "bone_enabled_changed";
 	const StringName show_rest_only_changed = "show_rest_only_changed";
+	const StringName pose_source_changed = "pose_source_changed";
 
 	const StringName body_shape_entered = "body_shape_entered";
 	const StringName body_entered = "body_entered";
@@ -0,0 +1,208 @@
+/**************************************************************************/
+/*  audio_decoded_cache.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_decoded_cache.h"
+
+AudioDecodedCache *AudioDecodedCache::singleton = nullptr;
+
+void AudioDecodedCache::_before_evict(ObjectID &p_stream, Vector<AudioFrame> &p_frames) {
+	// Called with the mutex held, from inside the LRU.
+	singleton->memory_used -= p_frames.size() * sizeof(AudioFrame);
+}
+
+void AudioDecodedCache::set_memory_budget(uint64_t p_bytes) {
+	MutexLock lock(mutex);
+	memory_budget = p_bytes;
+	while (memory_used > memory_budget && cache.evict_oldest()) {
+	}
+}
+
+uint64_t AudioDecodedCache::get_memory_budget() const {
+	MutexLock lock(mutex);
+	return memory_budget;
+}
+
+void AudioDecodedCache::set_max_stream_length(double p_seconds) {
+	MutexLock lock(mutex);
+	max_stream_length = p_seconds;
+}
+
+double AudioDecodedCache::get_max_stream_length() const {
+	MutexLock lock(mutex);
+	return max_stream_length;
+}
+
+bool AudioDecodedCache::is_cacheable(double p_length) const {
+	MutexLock lock(mutex);
+	return memory_budget > 0 && p_length > 0.0 && p_length <= max_stream_length;
+}
+
+void AudioDecodedCache::_decode_task(void *p_userdata) {
+	PendingDecode *pending = static_cast<PendingDecode *>(p_userdata);
+	pending->frames = pending->decoder->decode();
+}
+
+void AudioDecodedCache::_finish_decodes(bool p_wait) {
+	// Decodes are taken out of the list under the mutex, so each task is waited for exactly once.
+	LocalVector<PendingDecode *> finished;
+	{
+		MutexLock lock(mutex);
+		for (uint32_t i = 0; i < pending_decodes.size(); i++) {
+			PendingDecode *pending = pending_decodes[i];
+			if (p_wait || WorkerThreadPool::get_singleton()->is_task_completed(pending->task)) {
+				finished.push_back(pending);
+				pending_decodes.remove_at_unordered(i);
+				i--;
+			}
+		}
+	}
+
+	for (PendingDecode *pending : finished) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pending->task);
+		{
+			MutexLock lock(mutex);
+			if (!pending->discarded) {
+				_insert(pending->stream, pending->frames);
+			}
+		}
+		// Outside the mutex, as the decoder may hold the last reference to its stream.
+		memdelete(pending->decoder);
+		memdelete(pending);
+	}
+}
+
+bool AudioDecodedCache::lookup(ObjectID p_stream, Vector<AudioFrame> &r_frames) {
+	_finish_decodes(false);
+
+	MutexLock lock(mutex);
+	const Vector<AudioFrame> *frames = cache.getptr(p_stream);
+	if (!frames) {
+		return false;
+	}
+	r_frames = *frames;
+	return true;
+}
+
+void AudioDecodedCache::insert(ObjectID p_stream, const Vector<AudioFrame> &p_frames) {
+	MutexLock lock(mutex);
+	_insert(p_stream, p_frames);
+}
+
+void AudioDecodedCache::_insert(ObjectID p_stream, const Vector<AudioFrame> &p_frames) {
+	uint64_t size = p_frames.size() * sizeof(AudioFrame);
+	if (size == 0 || size > memory_budget) {
+		return;
+	}
+
+	// Replacing an entry runs the eviction callback on the old frames.
+	cache.insert(p_stream, p_frames);
+	memory_used += size;
+
+	while (memory_used > memory_budget && cache.evict_oldest()) {
+	}
+}
+
+void AudioDecodedCache::erase(ObjectID p_stream) {
+	MutexLock lock(mutex);
+	for (PendingDecode *pending : pending_decodes) {
+		if (pending->stream == p_stream) {
+			pending->discarded = true;
+		}
+	}
+	const Vector<AudioFrame> *frames = cache.getptr(p_stream);
+	if (frames) {
+		memory_used -= frames->size() * sizeof(AudioFrame);
+		cache.erase(p_stream);
+	}
+}
+
+void AudioDecodedCache::clear() {
+	MutexLock lock(mutex);
+	for (PendingDecode *pending : pending_decodes) {
+		pending->discarded = true;
+	}
+	cache.clear();
+	memory_used = 0;
+}
+
+void AudioDecodedCache::decode(ObjectID p_stream, Decoder *p_decoder) {
+	ERR_FAIL_NULL(p_decoder);
+
+	if (is_decoding(p_stream)) {
+		memdelete(p_decoder);
+		return;
+	}
+
+	PendingDecode *pending = memnew(PendingDecode);
+	pending->stream = p_stream;
+	pending->decoder = p_decoder;
+
+	MutexLock lock(mutex);
+	pending->task = WorkerThreadPool::get_singleton()->add_native_task(&AudioDecodedCache::_decode_task, pending, false, SNAME("AudioDecodedCacheDecode"));
+	pending_decodes.push_back(pending);
+}
+
+bool AudioDecodedCache::is_decoding(ObjectID p_stream) {
+	_finish_decodes(false);
+
+	MutexLock lock(mutex);
+	for (const PendingDecode *pending : pending_decodes) {
+		if (pending->stream == p_stream && !pending->discarded) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void AudioDecodedCache::wait_for_decodes() {
+	_finish_decodes(true);
+}
+
+uint64_t AudioDecodedCache::get_memory_used() const {
+	MutexLock lock(mutex);
+	return memory_used;
+}
+
+int AudioDecodedCache::get_entry_count() const {
+	MutexLock lock(mutex);
+	return cache.get_size();
+}
+
+AudioDecodedCache::AudioDecodedCache() :
+		cache(INT32_MAX) {
+	singleton = this;
+}
+
+AudioDecodedCache::~AudioDecodedCache() {
+	wait_for_decodes();
+	singleton = nullptr;
+}
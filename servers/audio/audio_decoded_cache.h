@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*  audio_decoded_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/audio_frame.h"
+#include "core/object/object_id.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/lru.h"
+#include "core/templates/vector.h"
+
+// Keeps fully decoded PCM for short compressed streams, so playbacks of the same
+// stream copy frames instead of each running its own decoder. Entries are keyed
+// by the stream's ObjectID and evicted least-recently-used first once the memory
+// budget is exceeded. Playbacks hold their own reference to the frames, so an
+// eviction never pulls data out from under the mixer.
+// Streams are decoded on the WorkerThreadPool, playbacks started before a decode
+// finishes stream as if the stream wasn't cached.
+class AudioDecodedCache {
+public:
+	// Decodes one stream on a worker thread. It is created on the thread starting the
+	// decode and must hold what it reads, as the stream may change while it runs.
+	class Decoder {
+	public:
+		virtual Vector<AudioFrame> decode() = 0;
+		virtual ~Decoder() {}
+	};
+
+private:
+	static AudioDecodedCache *singleton;
+
+	static void _before_evict(ObjectID &p_stream, Vector<AudioFrame> &p_frames);
+
+	struct PendingDecode {
+		ObjectID stream;
+		Decoder *decoder = nullptr;
+		Vector<AudioFrame> frames;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+		bool discarded = false; // The stream changed or the cache was cleared meanwhile.
+	};
+
+	static void _decode_task(void *p_userdata);
+	void _finish_decodes(bool p_wait);
+	void _insert(ObjectID p_stream, const Vector<AudioFrame> &p_frames);
+
+	mutable Mutex mutex;
+	LRUCache<ObjectID, Vector<AudioFrame>, HashMapHasherDefault, HashMapComparatorDefault<ObjectID>, _before_evict> cache;
+	LocalVector<PendingDecode *> pending_decodes;
+	uint64_t memory_budget = 0;
+	uint64_t memory_used = 0;
+	double max_stream_length = 0.0;
+
+public:
+	_FORCE_INLINE_ static AudioDecodedCache *get_singleton() { return singleton; }
+
+	void set_memory_budget(uint64_t p_bytes);
+	uint64_t get_memory_budget() const;
+	void set_max_stream_length(double p_seconds);
+	double get_max_stream_length() const;
+
+	// Whether a stream of this length should be decoded into the cache.
+	bool is_cacheable(double p_length) const;
+
+	bool lookup(ObjectID p_stream, Vector<AudioFrame> &r_frames);
+	void insert(ObjectID p_stream, const Vector<AudioFrame> &p_frames);
+	void erase(ObjectID p_stream);
+	void clear();
+
+	// Starts decoding a stream into the cache, taking ownership of `p_decoder`.
+	// Does nothing but free it if the stream is already being decoded.
+	void decode(ObjectID p_stream, Decoder *p_decoder);
+	bool is_decoding(ObjectID p_stream);
+	// Blocks until all started decodes are in the cache.
+	void wait_for_decodes();
+
+	uint64_t get_memory_used() const;
+	int get_entry_count() const;
+
+	AudioDecodedCache();
+	~AudioDecodedCache();
+};
@@ -0,0 +1,276 @@
+/**************************************************************************/
+/*  audio_mix_kernels.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_mix_kernels.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_MIX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define AUDIO_MIX_NEON
+#include <arm_neon.h>
+#endif
+
+#include <cstring>
+
+namespace AudioMixKernels {
+
+template <bool ACCUMULATE>
+static _FORCE_INLINE_ void _ramp(AudioFrame *p_dst, const AudioFrame *p_src, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames) {
+	if (p_frames == 0) {
+		return;
+	}
+
+	// Volume at frame i is start + step * i, with the index kept as a float
+	// vector (exact up to 2^24 frames) so the ramp doesn't accumulate error.
+	const AudioFrame vol_step = (p_vol_final - p_vol_start) / float(p_frames);
+	float *dst = p_dst->levels;
+	const float *src = p_src->levels;
+	uint32_t i = 0;
+
+#if defined(AUDIO_MIX_SSE2)
+	const __m128 start = _mm_setr_ps(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const __m128 step = _mm_setr_ps(vol_step.left, vol_step.right, vol_step.left, vol_step.right);
+	const __m128 two = _mm_set1_ps(2.0f);
+	__m128 index = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+	for (; i + 2 <= p_frames; i += 2) {
+		const __m128 vol = _mm_add_ps(start, _mm_mul_ps(step, index));
+		__m128 mixed = _mm_mul_ps(_mm_loadu_ps(src + i * 2), vol);
+		if constexpr (ACCUMULATE) {
+			mixed = _mm_add_ps(_mm_loadu_ps(dst + i * 2), mixed);
+		}
+		_mm_storeu_ps(dst + i * 2, mixed);
+		index = _mm_add_ps(index, two);
+	}
+#elif defined(AUDIO_MIX_NEON)
+	const float start_values[4] = { p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right };
+	const float step_values[4] = { vol_step.left, vol_step.right, vol_step.left, vol_step.right };
+	const float index_values[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+	const float32x4_t start = vld1q_f32(start_values);
+	const float32x4_t step = vld1q_f32(step_values);
+	const float32x4_t two = vdupq_n_f32(2.0f);
+	float32x4_t index = vld1q_f32(index_values);
+	for (; i + 2 <= p_frames; i += 2) {
+		const float32x4_t vol = vmlaq_f32(start, step, index);
+		if constexpr (ACCUMULATE) {
+			vst1q_f32(dst + i * 2, vmlaq_f32(vld1q_f32(dst + i * 2), vld1q_f32(src + i * 2), vol));
+		} else {
+			vst1q_f32(dst + i * 2, vmulq_f32(vld1q_f32(src + i * 2), vol));
+		}
+		index = vaddq_f32(index, two);
+	}
+#endif
+
+	for (; i < p_frames; i++) {
+		const AudioFrame vol = p_vol_start + vol_step * float(i);
+		if constexpr (ACCUMULATE) {
+			p_dst[i] += vol * p_src[i];
+		} else {
+			p_dst[i] = vol * p_src[i];
+		}
+	}
+}
+
+void mix_ramp(AudioFrame *p_dst, const AudioFrame *p_src, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames) {
+	_ramp<true>(p_dst, p_src, p_vol_start, p_vol_final, p_frames);
+}
+
+void scale_ramp(AudioFrame *p_dst, const AudioFrame *p_src, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames) {
+	_ramp<false>(p_dst, p_src, p_vol_start, p_vol_final, p_frames);
+}
+
+AudioFrame scale_and_peak(AudioFrame *p_buf, float p_volume, uint32_t p_frames) {
+	float *buf = p_buf->levels;
+	AudioFrame peak = AudioFrame(0, 0);
+	uint32_t i = 0;
+
+#if defined(AUDIO_MIX_SSE2)
+	const __m128 volume = _mm_set1_ps(p_volume);
+	const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	__m128 peak_acc = _mm_setzero_ps();
+	for (; i + 2 <= p_frames; i += 2) {
+		const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(buf + i * 2), volume);
+		_mm_storeu_ps(buf + i * 2, scaled);
+		peak_acc = _mm_max_ps(peak_acc, _mm_and_ps(scaled, abs_mask));
+	}
+	// Fold the two frames in the register: lanes (0, 1) and (2, 3).
+	peak_acc = _mm_max_ps(peak_acc, _mm_movehl_ps(peak_acc, peak_acc));
+	float peak_values[4];
+	_mm_storeu_ps(peak_values, peak_acc);
+	peak = AudioFrame(peak_values[0], peak_values[1]);
+#elif defined(AUDIO_MIX_NEON)
+	float32x4_t peak_acc = vdupq_n_f32(0.0f);
+	for (; i + 2 <= p_frames; i += 2) {
+		const float32x4_t scaled = vmulq_n_f32(vld1q_f32(buf + i * 2), p_volume);
+		vst1q_f32(buf + i * 2, scaled);
+		peak_acc = vmaxq_f32(peak_acc, vabsq_f32(scaled));
+	}
+	const float32x2_t folded = vmax_f32(vget_low_f32(peak_acc), vget_high_f32(peak_acc));
+	peak = AudioFrame(vget_lane_f32(folded, 0), vget_lane_f32(folded, 1));
+#endif
+
+	for (; i < p_frames; i++) {
+		p_buf[i] *= p_volume;
+		peak.left = MAX(peak.left, Math::abs(p_buf[i].left));
+		peak.right = MAX(peak.right, Math::abs(p_buf[i].right));
+	}
+
+	return peak;
+}
+
+void add(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames) {
+	float *dst = p_dst->levels;
+	const float *src = p_src->levels;
+	uint32_t i = 0;
+
+#if defined(AUDIO_MIX_SSE2)
+	for (; i + 2 <= p_frames; i += 2) {
+		_mm_storeu_ps(dst + i * 2, _mm_add_ps(_mm_loadu_ps(dst + i * 2), _mm_loadu_ps(src + i * 2)));
+	}
+#elif defined(AUDIO_MIX_NEON)
+	for (; i + 2 <= p_frames; i += 2) {
+		vst1q_f32(dst + i * 2, vaddq_f32(vld1q_f32(dst + i * 2), vld1q_f32(src + i * 2)));
+	}
+#endif
+
+	for (; i < p_frames; i++) {
+		p_dst[i] += p_src[i];
+	}
+}
+
+void clear(AudioFrame *p_buf, uint32_t p_frames) {
+	memset(p_buf, 0, sizeof(AudioFrame) * p_frames);
+}
+
+// Zeroth-order modified Bessel function of the first kind, for the Kaiser window.
+static double _bessel_i0(double p_x) {
+	double sum = 1.0;
+	double term = 1.0;
+	const double half_x = p_x * 0.5;
+	for (int k = 1; k < 32; k++) {
+		term *= half_x / k;
+		sum += term * term;
+		if (term * term < sum * 1e-12) {
+			break;
+		}
+	}
+	return sum;
+}
+
+struct SincTable {
+	static constexpr double KAISER_BETA = 7.0;
+
+	float coeffs[(SINC_PHASES + 1) * SINC_TAPS];
+
+	SincTable() {
+		const double half_width = SINC_TAPS / 2;
+		const double beta_norm = 1.0 / _bessel_i0(KAISER_BETA);
+		for (int phase = 0; phase <= SINC_PHASES; phase++) {
+			const double fraction = double(phase) / SINC_PHASES;
+			float *row = coeffs + phase * SINC_TAPS;
+			double sum = 0.0;
+			for (int k = 0; k < SINC_TAPS; k++) {
+				// Tap k reads the frame at offset (k - (SINC_TAPS / 2 - 1)) from the
+				// left interpolation point.
+				const double x = double(k - (SINC_TAPS / 2 - 1)) - fraction;
+				const double sinc = Math::is_zero_approx(x) ? 1.0 : Math::sin(Math::PI * x) / (Math::PI * x);
+				const double w = x / half_width;
+				const double window = w * w < 1.0 ? _bessel_i0(KAISER_BETA * Math::sqrt(1.0 - w * w)) * beta_norm : 0.0;
+				row[k] = sinc * window;
+				sum += row[k];
+			}
+			// Normalize for unity gain at DC, so no phase adds a ripple to constant signals.
+			for (int k = 0; k < SINC_TAPS; k++) {
+				row[k] /= sum;
+			}
+		}
+	}
+};
+
+const float *get_sinc_table() {
+	static const SincTable table;
+	return table.coeffs;
+}
+
+AudioFrame sinc_interpolate(const float *p_table, const AudioFrame *p_src, float p_fraction) {
+	const float phase = p_fraction * SINC_PHASES;
+	const uint32_t phase_index = MIN(uint32_t(phase), uint32_t(SINC_PHASES - 1));
+	const float blend = phase - phase_index;
+	const float *row_a = p_table + phase_index * SINC_TAPS;
+	const float *row_b = row_a + SINC_TAPS;
+	const float *src = p_src->levels;
+
+#if defined(AUDIO_MIX_SSE2)
+	__m128 acc_a = _mm_setzero_ps();
+	__m128 acc_b = _mm_setzero_ps();
+	for (uint32_t k = 0; k < SINC_TAPS; k += 4) {
+		// Four taps cover four stereo frames, so each coefficient is spread over both channels.
+		const __m128 frames_01 = _mm_loadu_ps(src + k * 2);
+		const __m128 frames_23 = _mm_loadu_ps(src + k * 2 + 4);
+		const __m128 a = _mm_loadu_ps(row_a + k);
+		const __m128 b = _mm_loadu_ps(row_b + k);
+		acc_a = _mm_add_ps(acc_a, _mm_add_ps(_mm_mul_ps(frames_01, _mm_unpacklo_ps(a, a)), _mm_mul_ps(frames_23, _mm_unpackhi_ps(a, a))));
+		acc_b = _mm_add_ps(acc_b, _mm_add_ps(_mm_mul_ps(frames_01, _mm_unpacklo_ps(b, b)), _mm_mul_ps(frames_23, _mm_unpackhi_ps(b, b))));
+	}
+	__m128 result = _mm_add_ps(acc_a, _mm_mul_ps(_mm_sub_ps(acc_b, acc_a), _mm_set1_ps(blend)));
+	result = _mm_add_ps(result, _mm_movehl_ps(result, result));
+	float values[4];
+	_mm_storeu_ps(values, result);
+	return AudioFrame(values[0], values[1]);
+#elif defined(AUDIO_MIX_NEON)
+	float32x4_t acc_a = vdupq_n_f32(0.0f);
+	float32x4_t acc_b = vdupq_n_f32(0.0f);
+	for (uint32_t k = 0; k < SINC_TAPS; k += 4) {
+		const float32x4_t frames_01 = vld1q_f32(src + k * 2);
+		const float32x4_t frames_23 = vld1q_f32(src + k * 2 + 4);
+		const float32x4_t a = vld1q_f32(row_a + k);
+		const float32x4_t b = vld1q_f32(row_b + k);
+		const float32x4x2_t a_spread = vzipq_f32(a, a);
+		const float32x4x2_t b_spread = vzipq_f32(b, b);
+		acc_a = vmlaq_f32(vmlaq_f32(acc_a, frames_01, a_spread.val[0]), frames_23, a_spread.val[1]);
+		acc_b = vmlaq_f32(vmlaq_f32(acc_b, frames_01, b_spread.val[0]), frames_23, b_spread.val[1]);
+	}
+	const float32x4_t result = vmlaq_n_f32(acc_a, vsubq_f32(acc_b, acc_a), blend);
+	const float32x2_t folded = vadd_f32(vget_low_f32(result), vget_high_f32(result));
+	return AudioFrame(vget_lane_f32(folded, 0), vget_lane_f32(folded, 1));
+#else
+	AudioFrame acc_a = AudioFrame(0, 0);
+	AudioFrame acc_b = AudioFrame(0, 0);
+	for (uint32_t k = 0; k < SINC_TAPS; k++) {
+		acc_a += p_src[k] * row_a[k];
+		acc_b += p_src[k] * row_b[k];
+	}
+	return acc_a + (acc_b - acc_a) * blend;
+#endif
+}
+
+} // namespace AudioMixKernels
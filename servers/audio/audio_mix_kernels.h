@@ -0,0 +1,68 @@
+/**************************************************************************/
+/*  audio_mix_kernels.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/audio_frame.h"
+
+// Vectorized inner loops used by the AudioServer mixer. AudioFrame buffers are
+// treated as flat interleaved float arrays, so one 128-bit register holds two
+// stereo frames. SSE2 (x86_64) and NEON (arm64) are part of the baseline for
+// those architectures; other targets use the scalar loops.
+namespace AudioMixKernels {
+
+// p_dst[i] += p_src[i] * lerp(p_vol_start, p_vol_final, i / p_frames).
+void mix_ramp(AudioFrame *p_dst, const AudioFrame *p_src, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames);
+// p_dst[i] = p_src[i] * lerp(p_vol_start, p_vol_final, i / p_frames).
+void scale_ramp(AudioFrame *p_dst, const AudioFrame *p_src, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames);
+// p_buf[i] *= p_volume, returning the absolute peak of each side after scaling.
+AudioFrame scale_and_peak(AudioFrame *p_buf, float p_volume, uint32_t p_frames);
+// p_dst[i] += p_src[i].
+void add(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames);
+void clear(AudioFrame *p_buf, uint32_t p_frames);
+
+// Polyphase windowed-sinc interpolation used by AudioStreamPlaybackResampled.
+// The table holds SINC_PHASES + 1 rows of SINC_TAPS Kaiser-windowed sinc
+// coefficients, and is built on first use.
+enum {
+	SINC_TAPS = 16, // Must be a multiple of 4.
+	SINC_PHASE_BITS = 8,
+	SINC_PHASES = 1 << SINC_PHASE_BITS,
+};
+
+const float *get_sinc_table();
+// Returns the signal between p_src[SINC_TAPS / 2 - 1] and p_src[SINC_TAPS / 2]
+// at p_fraction (in [0, 1)), reading SINC_TAPS frames from p_src. Coefficients
+// of the two nearest phases are blended linearly.
+AudioFrame sinc_interpolate(const float *p_table, const AudioFrame *p_src, float p_fraction);
+
+} // namespace AudioMixKernels
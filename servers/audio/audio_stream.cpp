@@ -33,6 +33,7 @@
 #include "audio_stream.h"
 
 #include "core/config/project_settings.h"
+#include "servers/audio/audio_mix_kernels.h"
 
 void AudioStreamPlayback::start(double p_from_pos) {
 	if (GDVIRTUAL_CALL(_start, p_from_pos)) {
@@ -164,16 +165,30 @@ AudioStreamPlayback::~AudioStreamPlayback() {
 //////////////////////////////
 
 void AudioStreamPlaybackResampled::begin_resample() {
-	//clear cubic interpolation history
-	internal_buffer[0] = AudioFrame(0.0, 0.0);
-	internal_buffer[1] = AudioFrame(0.0, 0.0);
-	internal_buffer[2] = AudioFrame(0.0, 0.0);
-	internal_buffer[3] = AudioFrame(0.0, 0.0);
+	//clear interpolation history
+	for (int i = 0; i < INTERP_HISTORY; i++) {
+		internal_buffer[i] = AudioFrame(0.0, 0.0);
+	}
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	int mixed_frames = _mix_internal(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
+	internal_buffer_end = mixed_frames != INTERNAL_BUFFER_LEN ? INTERP_HISTORY + mixed_frames : -1;
 	mix_offset = 0;
 }
 
+void AudioStreamPlaybackResampled::_refill_internal_buffer() {
+	for (int i = 0; i < INTERP_HISTORY; i++) {
+		internal_buffer[i] = internal_buffer[INTERNAL_BUFFER_LEN + i];
+	}
+	int mixed_frames = _mix_internal(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
+	if (mixed_frames != INTERNAL_BUFFER_LEN) {
+		// internal_buffer[internal_buffer_end] is the first frame of silence.
+		internal_buffer_end = INTERP_HISTORY + mixed_frames;
+	} else {
+		// The internal buffer does not contain the first frame of silence.
+		internal_buffer_end = -1;
+	}
+}
+
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	int ret = 0;
 	GDVIRTUAL_CALL(_mix_resampled, p_buffer, p_frames, ret);
@@ -193,52 +208,74 @@ void AudioStreamPlaybackResampled::_bind_methods() {
 }
 
 int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
-	float target_rate = AudioServer::get_singleton()->get_mix_rate();
-	float playback_speed_scale = AudioServer::get_singleton()->get_playback_speed_scale();
+	const AudioServer *audio_server = AudioServer::get_singleton();
+	float target_rate = audio_server->get_mix_rate();
+	float playback_speed_scale = audio_server->get_playback_speed_scale();
 
 	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale * playback_speed_scale) / double(target_rate)) * double(FP_LEN));
 
+	// Output frame i sits between internal_buffer[idx - delay] and the frame after it,
+	// where idx is the newest frame the interpolator reads.
+	const float *sinc_table = audio_server->get_resampler_quality() == AudioServer::RESAMPLER_QUALITY_SINC ? AudioMixKernels::get_sinc_table() : nullptr;
+	const uint32_t delay = sinc_table ? AudioMixKernels::SINC_TAPS / 2 : CUBIC_INTERP_HISTORY / 2;
+
 	int mixed_frames_total = -1;
 
-	int i;
-	for (i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+	int i = 0;
+	if (mix_increment == FP_LEN && (mix_offset & FP_MASK) == 0) {
+		// The stream plays at the mix rate, so every output frame is an input frame.
+		while (i < p_frames) {
+			uint32_t pos = uint32_t(mix_offset >> FP_BITS);
+			uint32_t from = INTERP_HISTORY + pos - delay;
+			int count = MIN(p_frames - i, int(INTERNAL_BUFFER_LEN - pos));
+
+			if (mixed_frames_total == -1 && from + count > internal_buffer_end) {
+				mixed_frames_total = i + MAX(0, int(internal_buffer_end) - int(from));
+			}
+
+			memcpy(p_buffer + i, internal_buffer + from, sizeof(AudioFrame) * count);
+			i += count;
+			mix_offset += uint64_t(count) << FP_BITS;
+
+			if ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
+				_refill_internal_buffer();
+				mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
+			}
+		}
+	}
+
+	for (; i < p_frames; i++) {
+		uint32_t idx = INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
 		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
 
-		if (idx >= internal_buffer_end && mixed_frames_total == -1) {
+		if (idx - delay >= internal_buffer_end && mixed_frames_total == -1) {
 			// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
 			mixed_frames_total = i;
 		}
 
-		float mu2 = mu * mu;
-		float h11 = mu2 * (mu - 1);
-		float z = mu2 - h11;
-		float h01 = z - h11;
-		float h10 = mu - z;
-
-		p_buffer[i] = y1 + (y2 - y1) * h01 + ((y2 - y0) * h10 + (y3 - y1) * h11) * 0.5;
+		if (sinc_table) {
+			p_buffer[i] = AudioMixKernels::sinc_interpolate(sinc_table, internal_buffer + idx - (AudioMixKernels::SINC_TAPS - 1), mu);
+		} else {
+			//standard cubic interpolation (great quality/performance ratio)
+			//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+			AudioFrame y0 = internal_buffer[idx - 3];
+			AudioFrame y1 = internal_buffer[idx - 2];
+			AudioFrame y2 = internal_buffer[idx - 1];
+			AudioFrame y3 = internal_buffer[idx - 0];
+
+			float mu2 = mu * mu;
+			float h11 = mu2 * (mu - 1);
+			float z = mu2 - h11;
+			float h01 = z - h11;
+			float h10 = mu - z;
+
+			p_buffer[i] = y1 + (y2 - y1) * h01 + ((y2 - y0) * h10 + (y3 - y1) * h11) * 0.5;
+		}
 
 		mix_offset += mix_increment;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
-			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
-			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
-			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
-			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
-			if (mixed_frames != INTERNAL_BUFFER_LEN) {
-				// internal_buffer[mixed_frames] is the first frame of silence.
-				internal_buffer_end = mixed_frames;
-			} else {
-				// The internal buffer does not contain the first frame of silence.
-				internal_buffer_end = -1;
-			}
+			_refill_internal_buffer();
 			mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
 		}
 	}
@@ -287,6 +324,13 @@ bool AudioStream::has_loop() const {
 	return ret;
 }
 
+bool AudioStream::get_loop_range(double &r_loop_begin, double &r_loop_end) const {
+	r_loop_begin = 0.0;
+	r_loop_end = -1.0;
+	// Only the stream itself knows where it loops back to.
+	return !has_loop();
+}
+
 int AudioStream::get_bar_beats() const {
 	int ret = 0;
 	GDVIRTUAL_CALL(_get_bar_beats, ret);
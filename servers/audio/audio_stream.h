@@ -133,13 +133,17 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 		FP_LEN = (1 << FP_BITS),
 		FP_MASK = FP_LEN - 1,
 		INTERNAL_BUFFER_LEN = 128, // 128 warrants 3ms positional jitter at much at 44100hz
-		CUBIC_INTERP_HISTORY = 4
+		CUBIC_INTERP_HISTORY = 4,
+		SINC_INTERP_HISTORY = 16, // AudioMixKernels::SINC_TAPS.
+		INTERP_HISTORY = SINC_INTERP_HISTORY,
 	};
 
-	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
+	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	void _refill_internal_buffer();
+
 protected:
 	void begin_resample();
 	// Returns the number of frames that were mixed.
@@ -194,6 +198,10 @@ public:
 	virtual double get_length() const;
 	virtual bool is_monophonic() const;
 
+	// The section a looping stream repeats, in seconds, so its position can be followed without mixing it.
+	// `r_loop_end` is negative if the stream doesn't loop. Returns `false` if the section isn't known.
+	virtual bool get_loop_range(double &r_loop_begin, double &r_loop_end) const;
+
 	void tag_used(float p_offset);
 	uint64_t get_tagged_frame() const;
 	uint32_t get_tagged_frame_count() const;
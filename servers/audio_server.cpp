@@ -37,11 +37,14 @@
 #include "core/error/error_macros.h"
 #include "core/io/resource_loader.h"
 #include "core/math/audio_frame.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "scene/scene_string_names.h"
+#include "servers/audio/audio_decoded_cache.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_mix_kernels.h"
 #include "servers/audio/audio_stream.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
@@ -381,6 +384,9 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	// Decide which playbacks are mixed this step and which only have their position advanced.
+	_update_voices();
+
 	// Main mixing loop for audio streams.
 	// The basic idea here is to copy the samples returned by the AudioStreamPlayback's mix function into the audio buffers,
 	//  while always maintaining a lookahead buffer of size LOOKAHEAD_BUFFER_SIZE to allow fade-outs for sudden stoppages.
@@ -394,10 +400,17 @@ void AudioServer::_mix_step() {
 			continue;
 		}
 
+		if (playback->is_virtual.is_set() && _process_virtual_voice(playback)) {
+			continue;
+		}
+
+		// A playback that just became virtual is faded out like a stopping one, then skipped until it is audible again.
+		bool going_virtual = playback->wants_virtual;
+
 		// If `fading_out` is true, we're in the process of fading out the stream playback.
 		// TODO: Currently this sets the volume of the stream to 0 which creates a linear interpolation between its previous volume and silence.
 		//  A more punchy option for fading out could be to just use the lookahead buffer.
-		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		bool fading_out = going_virtual || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
 		AudioFrame *buf = mix_buffer.ptrw();
 
@@ -521,6 +534,11 @@ void AudioServer::_mix_step() {
 			}
 		}
 
+		if (going_virtual && playback->state.load() == AudioStreamPlaybackListNode::PLAYING) {
+			playback->virtual_position.set(playback->stream_playback->get_playback_position());
+			playback->is_virtual.set();
+		}
+
 		switch (playback->state.load()) {
 			case AudioStreamPlaybackListNode::AWAITING_DELETION:
 			case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
@@ -539,130 +557,295 @@ void AudioServer::_mix_step() {
 	}
 
 	// Now that all of the buses have their audio sources mixed into them, we can process the effects and bus sends.
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		Bus *bus = buses[i];
+	mix_solo_mode = solo_mode;
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				// Buffer was not used, but it's still active, so it must be cleaned.
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
-
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+	if (!process_buses_in_parallel || buses.size() < 3 || _has_sidechain_effects()) {
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			_mix_bus(i);
+			_mix_bus_send(i);
+		}
+	} else {
+		// A bus only sends to a bus with a lower index, so its depth (number of sends to reach the master bus) is always
+		// one more than its target's. Buses of the same depth never feed each other and can run their effect chains
+		// concurrently, as long as the deeper level has already been sent. Sends stay serial since several buses can share a target.
+		int bus_count = buses.size();
+		bus_depths.resize(bus_count);
+		bus_depths[0] = 0;
+		int max_depth = 0;
+		for (int i = 1; i < bus_count; i++) {
+			bus_depths[i] = bus_depths[_get_bus_send(buses[i])->index_cache] + 1;
+			max_depth = MAX(max_depth, bus_depths[i]);
+		}
+
+		// Counting sort by depth, deepest level first.
+		bus_level_offsets.resize(max_depth + 2);
+		for (uint32_t i = 0; i < bus_level_offsets.size(); i++) {
+			bus_level_offsets[i] = 0;
+		}
+		for (int i = 0; i < bus_count; i++) {
+			bus_level_offsets[max_depth - bus_depths[i] + 1]++;
+		}
+		for (uint32_t i = 1; i < bus_level_offsets.size(); i++) {
+			bus_level_offsets[i] += bus_level_offsets[i - 1];
+		}
+		bus_level_order.resize(bus_count);
+		for (int i = bus_count - 1; i >= 0; i--) {
+			bus_level_order[bus_level_offsets[max_depth - bus_depths[i]]++] = i;
+		}
+		// The fill pass advanced each offset to the start of the next level; shift them back.
+		for (int level = max_depth + 1; level > 0; level--) {
+			bus_level_offsets[level] = bus_level_offsets[level - 1];
+		}
+		bus_level_offsets[0] = 0;
+
+		for (int level = 0; level <= max_depth; level++) {
+			const uint32_t from = bus_level_offsets[level];
+			const uint32_t count = bus_level_offsets[level + 1] - from;
+			if (count > 1) {
+				bus_level_from = from;
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AudioServer::_mix_bus_task, nullptr, count, -1, true, SNAME("AudioBusProcess"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				_mix_bus(bus_level_order[from]);
+			}
+			for (uint32_t i = from; i < from + count; i++) {
+				_mix_bus_send(bus_level_order[i]);
 			}
 		}
+	}
 
-		// Process effects.
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
-
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
-				}
+void AudioServer::_update_voices() {
+	voice_candidates.clear();
+	uint32_t real_count = 0;
+	uint32_t virtual_count = 0;
 
-				// Swap buffers, so internal buffer always has the right data.
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
-				}
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->wants_virtual = false;
+		if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING || playback->stream_playback->get_is_sample()) {
+			continue;
+		}
+		if (playback->stream_length.get() <= 0.0) {
+			// Position can't be tracked without mixing, always keep it real.
+			real_count++;
+			continue;
+		}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+		AudioStreamPlaybackBusDetails *bus_details = playback->bus_details.load();
+		float audibility = 0.0f;
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+			if (!bus_details->bus_active[idx]) {
+				continue;
+			}
+			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+				const AudioFrame &volume = bus_details->volume[idx][channel_idx];
+				audibility = MAX(audibility, MAX(Math::abs(volume.left), Math::abs(volume.right)));
 			}
 		}
+		playback->audibility = audibility;
 
-		// Process send.
+		if (audibility <= voice_virtualize_threshold) {
+			playback->wants_virtual = true;
+			virtual_count++;
+		} else {
+			voice_candidates.push_back(playback);
+		}
+	}
 
-		Bus *send = nullptr;
+	uint32_t real_slots = max_real_voices > 0 ? MAX(int64_t(max_real_voices) - real_count, 0) : voice_candidates.size();
+	if (real_slots < voice_candidates.size()) {
+		voice_candidates.sort_custom<VoiceSort>();
+		for (uint32_t i = real_slots; i < voice_candidates.size(); i++) {
+			voice_candidates[i]->wants_virtual = true;
+		}
+		virtual_count += voice_candidates.size() - real_slots;
+		real_count += real_slots;
+	} else {
+		real_count += voice_candidates.size();
+	}
 
-		if (i > 0) {
-			// Everything has a send except for the master bus.
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { // Invalid, send to master.
-					send = buses[0];
-				}
+	real_voice_count.set(real_count);
+	virtual_voice_count.set(virtual_count);
+}
+
+bool AudioServer::_process_virtual_voice(AudioStreamPlaybackListNode *p_playback) {
+	switch (p_playback->state.load()) {
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE:
+			// Nothing audible to fade out.
+			p_playback->state.store(AudioStreamPlaybackListNode::PAUSED);
+			return true;
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
+		case AudioStreamPlaybackListNode::AWAITING_DELETION:
+			_delete_stream_playback_list_node(p_playback);
+			return true;
+		default:
+			break;
+	}
+
+	if (p_playback->wants_virtual) {
+		double position = p_playback->virtual_position.get() + buffer_size * p_playback->pitch_scale.get() * playback_speed_scale / get_mix_rate();
+		const double loop_end = p_playback->loop_end.get();
+		if (loop_end >= 0.0) {
+			if (position >= loop_end) {
+				// Wrap into the section the stream repeats, like the playback does when it reaches the loop end.
+				const double loop_begin = p_playback->loop_begin.get();
+				const double loop_length = loop_end - loop_begin;
+				position = loop_length > 0.0 ? loop_begin + Math::fmod(position - loop_begin, loop_length) : loop_begin;
 			}
+		} else if (position >= p_playback->stream_length.get()) {
+			// The stream ended while nobody could hear it.
+			p_playback->state.store(AudioStreamPlaybackListNode::AWAITING_DELETION);
+			_delete_stream_playback_list_node(p_playback);
+			return true;
 		}
+		p_playback->virtual_position.set(position);
+		return true;
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+	// Audible again: resume where the stream would be by now, and fade in from silence on the buses it plays to.
+	p_playback->stream_playback->seek(p_playback->virtual_position.get());
+	for (int i = 0; i < LOOKAHEAD_BUFFER_SIZE; i++) {
+		p_playback->lookahead[i] = AudioFrame(0, 0);
+	}
+	*p_playback->prev_bus_details = *p_playback->bus_details.load();
+	for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
+		for (int j = 0; j < MAX_CHANNELS_PER_BUS; j++) {
+			p_playback->prev_bus_details->volume[i][j] = AudioFrame(0, 0);
+		}
+	}
+	p_playback->is_virtual.clear();
+	return false;
+}
+
+AudioServer::Bus *AudioServer::_get_bus_send(const Bus *p_bus) const {
+	// Everything has a send except for the master bus.
+	if (p_bus->index_cache == 0) {
+		return nullptr;
+	}
+	HashMap<StringName, Bus *>::ConstIterator E = bus_map.find(p_bus->send);
+	if (!E || E->value->index_cache >= p_bus->index_cache) { // Invalid, send to master.
+		return buses[0];
+	}
+	return E->value;
+}
+
+bool AudioServer::_has_sidechain_effects() const {
+	// A sidechain reads the buffer of another bus, which may be processed at the same time, so these layouts mix serially.
+	for (const Bus *bus : buses) {
+		if (bus->bypass) {
+			continue;
+		}
+		for (const Bus::Effect &effect : bus->effects) {
+			if (!effect.enabled) {
 				continue;
 			}
+			const AudioEffectCompressor *compressor = Object::cast_to<AudioEffectCompressor>(effect.effect.ptr());
+			if (compressor && compressor->get_sidechain() != StringName()) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
-
-			AudioFrame peak = AudioFrame(0, 0);
+void AudioServer::_mix_bus(int p_bus) {
+	Bus *bus = buses[p_bus];
 
-			float volume = Math::db_to_linear(bus->volume_db);
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			// Buffer was not used, but it's still active, so it must be cleaned.
+			AudioMixKernels::clear(bus->channels.write[k].buffer.ptrw(), buffer_size);
+		}
+	}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+	// Process effects.
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
 			}
 
-			// Apply volume and compute peak.
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
 
-				float l = Math::abs(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-				float r = Math::abs(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
+				bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), bus->channels.write[k].effect_buffer.ptrw(), buffer_size);
+			}
+
+			// Swap buffers, so internal buffer always has the right data.
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(bus->channels.write[k].buffer, bus->channels.write[k].effect_buffer);
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+#ifdef DEBUG_ENABLED
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
 
-			if (!bus->channels[k].used) {
-				// See if any audio is contained, because channel was not used.
+	float volume = Math::db_to_linear(bus->volume_db);
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
-			}
+	if (mix_solo_mode) {
+		if (!bus->soloed) {
+			volume = 0.0;
+		}
+	} else {
+		if (bus->mute) {
+			volume = 0.0;
+		}
+	}
 
-			if (send) {
-				// If not master bus, send.
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+		// Apply volume and compute peak.
+		AudioFrame peak = AudioMixKernels::scale_and_peak(bus->channels.write[k].buffer.ptrw(), volume, buffer_size);
+
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+
+		if (!bus->channels[k].used) {
+			// See if any audio is contained, because channel was not used.
+
+			if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false; // Went inactive, don't send.
 			}
 		}
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+void AudioServer::_mix_bus_task(uint32_t p_index, void *p_userdata) {
+	_mix_bus(bus_level_order[bus_level_from + p_index]);
+}
+
+void AudioServer::_mix_bus_send(int p_bus) {
+	Bus *bus = buses[p_bus];
+	Bus *send = _get_bus_send(bus);
+	if (!send) {
+		return;
+	}
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			continue;
+		}
+		AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		AudioMixKernels::add(target_buf, bus->channels[k].buffer.ptr(), buffer_size);
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -696,11 +879,8 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		}
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
+		AudioMixKernels::mix_ramp(p_out_buf, p_source_buf, p_vol_start, p_vol_final, buffer_size);
 	}
 }
 
@@ -823,6 +1003,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -896,6 +1077,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -1430,6 +1612,20 @@ void AudioServer::set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playb
 	playback_node->highshelf_gain.set(p_gain);
 }
 
+void AudioServer::set_playback_voice_params(Ref<AudioStreamPlayback> p_playback, int p_priority, double p_stream_length, double p_loop_begin, double p_loop_end) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->voice_priority.set(p_priority);
+	playback_node->loop_begin.set(p_loop_begin);
+	playback_node->loop_end.set(p_loop_end);
+	playback_node->stream_length.set(p_stream_length);
+}
+
 bool AudioServer::is_playback_active(Ref<AudioStreamPlayback> p_playback) {
 	ERR_FAIL_COND_V(p_playback.is_null(), false);
 
@@ -1463,6 +1659,10 @@ float AudioServer::get_playback_position(Ref<AudioStreamPlayback> p_playback) {
 		return 0;
 	}
 
+	if (playback_node->is_virtual.is_set()) {
+		return playback_node->virtual_position.get();
+	}
+
 	return playback_node->stream_playback->get_playback_position();
 }
 
@@ -1481,6 +1681,14 @@ uint64_t AudioServer::get_mix_count() const {
 	return mix_count;
 }
 
+uint32_t AudioServer::get_real_voice_count() const {
+	return real_voice_count.get();
+}
+
+uint32_t AudioServer::get_virtual_voice_count() const {
+	return virtual_voice_count.get();
+}
+
 uint64_t AudioServer::get_mixed_frames() const {
 	return mix_frames;
 }
@@ -1497,17 +1705,13 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1516,6 +1720,14 @@ void AudioServer::init_channels_and_buffers() {
 void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_threshold_db", PropertyHint::HINT_RANGE, "-80,0,0.1,suffix:dB"), -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PropertyHint::HINT_RANGE, "0,5,0.01,or_greater"), 2.0)) * get_mix_rate();
+	process_buses_in_parallel = GLOBAL_DEF_RST("audio/buses/process_in_parallel", false);
+	resampler_quality = ResamplerQuality(int(GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/general/resampler_quality", PropertyHint::HINT_ENUM, "Cubic,Sinc"), RESAMPLER_QUALITY_CUBIC)));
+	max_real_voices = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/voices/max_real_voices", PropertyHint::HINT_RANGE, "0,1024,1,or_greater"), 0);
+	voice_virtualize_threshold = Math::db_to_linear(float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/voices/virtualize_threshold_db", PropertyHint::HINT_RANGE, "-120,0,0.1,suffix:dB"), -80.0)));
+
+	decoded_cache = memnew(AudioDecodedCache);
+	decoded_cache->set_max_stream_length(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/decoded_cache/max_stream_length", PropertyHint::HINT_RANGE, "0,60,0.1,or_greater,suffix:s"), 5.0));
+	decoded_cache->set_memory_budget(uint64_t(int(GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/decoded_cache/memory_budget_mb", PropertyHint::HINT_RANGE, "0,1024,1,or_greater,suffix:MiB"), 0))) * 1024 * 1024);
 	// TODO: Buffer size is hardcoded for now. This would be really nice to have as a project setting because currently it limits audio latency to an absolute minimum of 11ms with default mix rate, but there's some additional work required to make that happen. See TODOs in `_mix_step_for_channel`.
 	// When this becomes a project setting, it should be specified in milliseconds rather than raw sample count, because 512 samples at 192khz is shorter than it is at 48khz, for example.
 	buffer_size = 512;
@@ -1645,6 +1857,11 @@ void AudioServer::finish() {
 	}
 
 	buses.clear();
+
+	if (decoded_cache) {
+		memdelete(decoded_cache);
+		decoded_cache = nullptr;
+	}
 }
 
 /* MISC config */
@@ -1787,6 +2004,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -35,6 +35,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -42,6 +43,7 @@
 
 #include <atomic>
 
+class AudioDecodedCache;
 class AudioDriverDummy;
 class AudioSample;
 class AudioStream;
@@ -200,6 +202,12 @@ public:
 		PLAYBACK_TYPE_MAX
 	};
 
+	// Interpolation used by AudioStreamPlaybackResampled when the stream and mix rates differ.
+	enum ResamplerQuality {
+		RESAMPLER_QUALITY_CUBIC,
+		RESAMPLER_QUALITY_SINC,
+	};
+
 	enum {
 		AUDIO_DATA_INVALID_ID = -1,
 		MAX_CHANNELS_PER_BUS = 4,
@@ -248,6 +256,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Effect output, swapped with buffer after each effect.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -307,6 +316,17 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Voice management. Only playbacks with a known stream length can be virtualized, since their position is tracked without mixing.
+		SafeNumeric<int> voice_priority;
+		SafeNumeric<double> stream_length;
+		SafeNumeric<double> loop_begin;
+		SafeNumeric<double> loop_end; // Negative if the stream doesn't loop.
+		// A virtual playback isn't mixed; its position advances in `virtual_position` until it is audible again.
+		SafeFlag is_virtual;
+		SafeNumeric<double> virtual_position;
+		// Only accessed on the audio thread.
+		bool wants_virtual = false;
+		float audibility = 0.0f;
 	};
 
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
@@ -317,7 +337,6 @@ private:
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<AudioFrame> mix_buffer;
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
@@ -328,7 +347,47 @@ private:
 
 	void init_channels_and_buffers();
 
+	// Buses of the same send depth, processed concurrently when enabled.
+	bool process_buses_in_parallel = false;
+	bool mix_solo_mode = false;
+	LocalVector<int> bus_depths;
+	LocalVector<int> bus_level_order;
+	LocalVector<uint32_t> bus_level_offsets;
+	uint32_t bus_level_from = 0;
+
+	AudioDecodedCache *decoded_cache = nullptr;
+	ResamplerQuality resampler_quality = RESAMPLER_QUALITY_CUBIC;
+
+	// Voice management.
+	int max_real_voices = 0;
+	float voice_virtualize_threshold = 0.0f;
+	LocalVector<AudioStreamPlaybackListNode *> voice_candidates;
+	SafeNumeric<uint32_t> real_voice_count;
+	SafeNumeric<uint32_t> virtual_voice_count;
+
+	struct VoiceSort {
+		// Highest priority first, then loudest. Voices that are already real get a small bonus so they don't flip every mix near the cap.
+		_FORCE_INLINE_ bool operator()(const AudioStreamPlaybackListNode *p_a, const AudioStreamPlaybackListNode *p_b) const {
+			int priority_a = p_a->voice_priority.get();
+			int priority_b = p_b->voice_priority.get();
+			if (priority_a != priority_b) {
+				return priority_a > priority_b;
+			}
+			float audibility_a = p_a->is_virtual.is_set() ? p_a->audibility : p_a->audibility * 1.25f;
+			float audibility_b = p_b->is_virtual.is_set() ? p_b->audibility : p_b->audibility * 1.25f;
+			return audibility_a > audibility_b;
+		}
+	};
+
+	void _update_voices();
+	bool _process_virtual_voice(AudioStreamPlaybackListNode *p_playback);
+
 	void _mix_step();
+	Bus *_get_bus_send(const Bus *p_bus) const;
+	bool _has_sidechain_effects() const;
+	void _mix_bus(int p_bus);
+	void _mix_bus_task(uint32_t p_index, void *p_userdata = nullptr);
+	void _mix_bus_send(int p_bus);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -429,6 +488,8 @@ public:
 	void set_playback_speed_scale(float p_scale);
 	float get_playback_speed_scale() const;
 
+	_FORCE_INLINE_ ResamplerQuality get_resampler_quality() const { return resampler_quality; }
+
 	// Convenience method.
 	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time = 0, float p_pitch_scale = 1);
 	// Expose all parameters.
@@ -441,12 +502,15 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	void set_playback_voice_params(Ref<AudioStreamPlayback> p_playback, int p_priority, double p_stream_length, double p_loop_begin = 0.0, double p_loop_end = -1.0);
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
 	bool is_playback_paused(Ref<AudioStreamPlayback> p_playback);
 
 	uint64_t get_mix_count() const;
+	uint32_t get_real_voice_count() const;
+	uint32_t get_virtual_voice_count() const;
 	uint64_t get_mixed_frames() const;
 
 	String get_driver_name() const;
@@ -231,6 +231,40 @@ public:
 	EXBIND3(space_set_param, RID, SpaceParameter, real_t)
 	EXBIND2RC(real_t, space_get_param, RID, SpaceParameter)
 
+	// Not required, so existing extensions keep working.
+	GDVIRTUAL1RC(PackedByteArray, _space_save_state, RID)
+	GDVIRTUAL2R(bool, _space_restore_state, RID, const PackedByteArray &)
+
+	virtual PackedByteArray space_save_state(RID p_space) const override {
+		PackedByteArray ret;
+		GDVIRTUAL_CALL(_space_save_state, p_space, ret);
+		return ret;
+	}
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override {
+		bool ret = false;
+		GDVIRTUAL_CALL(_space_restore_state, p_space, p_state, ret);
+		return ret;
+	}
+
+	// Not required, so existing extensions keep working.
+	GDVIRTUAL2(_space_set_deterministic, RID, bool)
+	GDVIRTUAL1RC(bool, _space_is_deterministic, RID)
+	GDVIRTUAL1RC(uint32_t, _space_get_step_checksum, RID)
+
+	virtual void space_set_deterministic(RID p_space, bool p_enabled) override {
+		GDVIRTUAL_CALL(_space_set_deterministic, p_space, p_enabled);
+	}
+	virtual bool space_is_deterministic(RID p_space) const override {
+		bool ret = false;
+		GDVIRTUAL_CALL(_space_is_deterministic, p_space, ret);
+		return ret;
+	}
+	virtual uint32_t space_get_step_checksum(RID p_space) const override {
+		uint32_t ret = 0;
+		GDVIRTUAL_CALL(_space_get_step_checksum, p_space, ret);
+		return ret;
+	}
+
 	EXBIND1R(PhysicsDirectSpaceState2D *, space_get_direct_state, RID)
 
 	EXBIND2(space_set_debug_contacts, RID, int)
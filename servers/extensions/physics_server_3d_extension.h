@@ -237,6 +237,21 @@ public:
 	EXBIND3(space_set_param, RID, SpaceParameter, real_t)
 	EXBIND2RC(real_t, space_get_param, RID, SpaceParameter)
 
+	// Not required, so existing extensions keep working.
+	GDVIRTUAL1RC(PackedByteArray, _space_save_state, RID)
+	GDVIRTUAL2R(bool, _space_restore_state, RID, const PackedByteArray &)
+
+	virtual PackedByteArray space_save_state(RID p_space) const override {
+		PackedByteArray ret;
+		GDVIRTUAL_CALL(_space_save_state, p_space, ret);
+		return ret;
+	}
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override {
+		bool ret = false;
+		GDVIRTUAL_CALL(_space_restore_state, p_space, p_state, ret);
+		return ret;
+	}
+
 	EXBIND1R(PhysicsDirectSpaceState3D *, space_get_direct_state, RID)
 
 	EXBIND2(space_set_debug_contacts, RID, int)
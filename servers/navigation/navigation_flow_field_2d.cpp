@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*  navigation_flow_field_2d.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "navigation_flow_field_2d.h"
+
+#include "core/math/geometry_2d.h"
+
+// Positions closer than this to their waypoint continue to the next one.
+static constexpr real_t WAYPOINT_REACHED_DISTANCE = 0.01;
+
+void NavigationFlowField2D::_build_grid() {
+	grid_cells.clear();
+
+	const uint32_t polygon_count = polygon_costs.size();
+	if (polygon_count == 0) {
+		return;
+	}
+
+	// Size the cells after the average polygon, so lookups only test a handful of polygons.
+	real_t extent_sum = 0.0;
+	uint32_t extent_count = 0;
+	for (uint32_t p = 0; p < polygon_count; p++) {
+		const uint32_t begin = polygon_vertex_offsets[p];
+		const uint32_t end = polygon_vertex_offsets[p + 1];
+		if (begin == end) {
+			continue;
+		}
+		Rect2 bounds(polygon_vertices[begin], Vector2());
+		for (uint32_t i = begin + 1; i < end; i++) {
+			bounds.expand_to(polygon_vertices[i]);
+		}
+		extent_sum += MAX(bounds.size.x, bounds.size.y);
+		extent_count++;
+	}
+	if (extent_count == 0) {
+		return;
+	}
+	grid_cell_size = MAX(real_t(2.0) * extent_sum / extent_count, real_t(0.01));
+
+	for (uint32_t p = 0; p < polygon_count; p++) {
+		const uint32_t begin = polygon_vertex_offsets[p];
+		const uint32_t end = polygon_vertex_offsets[p + 1];
+		if (begin == end) {
+			continue;
+		}
+		Vector2 min_point = polygon_vertices[begin];
+		Vector2 max_point = min_point;
+		for (uint32_t i = begin + 1; i < end; i++) {
+			min_point = min_point.min(polygon_vertices[i]);
+			max_point = max_point.max(polygon_vertices[i]);
+		}
+		const Vector2i min_cell = (min_point / grid_cell_size).floor();
+		const Vector2i max_cell = (max_point / grid_cell_size).floor();
+		for (int y = min_cell.y; y <= max_cell.y; y++) {
+			for (int x = min_cell.x; x <= max_cell.x; x++) {
+				grid_cells[Vector2i(x, y)].push_back(p);
+			}
+		}
+	}
+}
+
+uint32_t NavigationFlowField2D::_get_polygon_at(const Vector2 &p_position) const {
+	const Vector2i cell = (p_position / grid_cell_size).floor();
+	HashMap<Vector2i, LocalVector<uint32_t>>::ConstIterator cell_it = grid_cells.find(cell);
+	if (!cell_it) {
+		return UINT32_MAX;
+	}
+
+	// Positions slightly outside of the navigation mesh use the closest polygon.
+	uint32_t closest_polygon = UINT32_MAX;
+	real_t closest_distance_squared = FLT_MAX;
+	for (uint32_t p : cell_it->value) {
+		const uint32_t begin = polygon_vertex_offsets[p];
+		const uint32_t end = polygon_vertex_offsets[p + 1];
+		for (uint32_t i = begin + 2; i < end; i++) {
+			if (Geometry2D::is_point_in_triangle(p_position, polygon_vertices[begin], polygon_vertices[i - 1], polygon_vertices[i])) {
+				return p;
+			}
+		}
+		for (uint32_t i = begin; i < end; i++) {
+			const Vector2 &from = polygon_vertices[i];
+			const Vector2 &to = polygon_vertices[i + 1 < end ? i + 1 : begin];
+			const real_t distance_squared = Geometry2D::get_closest_point_to_segment(p_position, from, to).distance_squared_to(p_position);
+			if (distance_squared < closest_distance_squared) {
+				closest_distance_squared = distance_squared;
+				closest_polygon = p;
+			}
+		}
+	}
+	return closest_polygon;
+}
+
+uint32_t NavigationFlowField2D::_get_next_waypoint(const Vector2 &p_position) const {
+	uint32_t polygon = _get_polygon_at(p_position);
+	if (polygon == UINT32_MAX || polygon_costs[polygon] == FLT_MAX) {
+		return UINT32_MAX;
+	}
+
+	// Positions on a waypoint, e.g. at the start of a link, continue to the following one.
+	while (polygon_next[polygon] != UINT32_MAX && p_position.distance_squared_to(polygon_waypoints[polygon]) < WAYPOINT_REACHED_DISTANCE * WAYPOINT_REACHED_DISTANCE) {
+		polygon = polygon_next[polygon];
+	}
+	return polygon;
+}
+
+bool NavigationFlowField2D::is_position_reachable(const Vector2 &p_position) const {
+	return _get_next_waypoint(p_position) != UINT32_MAX;
+}
+
+Vector2 NavigationFlowField2D::get_next_position(const Vector2 &p_position) const {
+	const uint32_t polygon = _get_next_waypoint(p_position);
+	if (polygon == UINT32_MAX) {
+		return p_position;
+	}
+	return polygon_waypoints[polygon];
+}
+
+Vector2 NavigationFlowField2D::get_direction(const Vector2 &p_position) const {
+	const uint32_t polygon = _get_next_waypoint(p_position);
+	if (polygon == UINT32_MAX) {
+		return Vector2();
+	}
+	const Vector2 to_waypoint = polygon_waypoints[polygon] - p_position;
+	if (to_waypoint.length_squared() < WAYPOINT_REACHED_DISTANCE * WAYPOINT_REACHED_DISTANCE) {
+		return Vector2();
+	}
+	return to_waypoint.normalized();
+}
+
+real_t NavigationFlowField2D::get_distance(const Vector2 &p_position) const {
+	const uint32_t polygon = _get_next_waypoint(p_position);
+	if (polygon == UINT32_MAX) {
+		return -1.0;
+	}
+	return p_position.distance_to(polygon_waypoints[polygon]) + polygon_costs[polygon];
+}
+
+void NavigationFlowField2D::reset() {
+	target_position = Vector2();
+	polygon_vertices.clear();
+	polygon_vertex_offsets.clear();
+	polygon_waypoints.clear();
+	polygon_next.clear();
+	polygon_costs.clear();
+	grid_cells.clear();
+}
+
+void NavigationFlowField2D::set_data(const Vector2 &p_target_position, LocalVector<Vector2> &&r_polygon_vertices, LocalVector<uint32_t> &&r_polygon_vertex_offsets, LocalVector<Vector2> &&r_polygon_waypoints, LocalVector<uint32_t> &&r_polygon_next, LocalVector<real_t> &&r_polygon_costs) {
+	ERR_FAIL_COND(r_polygon_vertex_offsets.size() != r_polygon_costs.size() + 1);
+	ERR_FAIL_COND(r_polygon_waypoints.size() != r_polygon_costs.size() || r_polygon_next.size() != r_polygon_costs.size());
+
+	target_position = p_target_position;
+	polygon_vertices = std::move(r_polygon_vertices);
+	polygon_vertex_offsets = std::move(r_polygon_vertex_offsets);
+	polygon_waypoints = std::move(r_polygon_waypoints);
+	polygon_next = std::move(r_polygon_next);
+	polygon_costs = std::move(r_polygon_costs);
+
+	_build_grid();
+}
+
+void NavigationFlowField2D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_target_position"), &NavigationFlowField2D::get_target_position);
+
+	ClassDB::bind_method(D_METHOD("is_position_reachable", "position"), &NavigationFlowField2D::is_position_reachable);
+	ClassDB::bind_method(D_METHOD("get_next_position", "position"), &NavigationFlowField2D::get_next_position);
+	ClassDB::bind_method(D_METHOD("get_direction", "position"), &NavigationFlowField2D::get_direction);
+	ClassDB::bind_method(D_METHOD("get_distance", "position"), &NavigationFlowField2D::get_distance);
+
+	ClassDB::bind_method(D_METHOD("reset"), &NavigationFlowField2D::reset);
+}
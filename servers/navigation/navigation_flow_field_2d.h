@@ -0,0 +1,77 @@
+/**************************************************************************/
+/*  navigation_flow_field_2d.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+class NavigationFlowField2D : public RefCounted {
+	GDCLASS(NavigationFlowField2D, RefCounted);
+
+	Vector2 target_position;
+
+	// Polygons are stored by their id in the map. Polygons that can not be stood on,
+	// e.g. the ones of links or with non-matching navigation layers, have no vertices.
+	LocalVector<Vector2> polygon_vertices;
+	LocalVector<uint32_t> polygon_vertex_offsets; // Vertices of polygon p are polygon_vertices[offsets[p]] to polygon_vertices[offsets[p + 1]].
+
+	// Where each polygon leads to on the way to the target, the polygon that continues from there,
+	// and the remaining cost from that point. Unreachable polygons have a cost of FLT_MAX.
+	LocalVector<Vector2> polygon_waypoints;
+	LocalVector<uint32_t> polygon_next;
+	LocalVector<real_t> polygon_costs;
+
+	// Uniform grid to find the polygons at a position.
+	real_t grid_cell_size = 1.0;
+	HashMap<Vector2i, LocalVector<uint32_t>> grid_cells;
+
+	void _build_grid();
+	uint32_t _get_polygon_at(const Vector2 &p_position) const;
+	uint32_t _get_next_waypoint(const Vector2 &p_position) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	Vector2 get_target_position() const { return target_position; }
+
+	bool is_position_reachable(const Vector2 &p_position) const;
+	Vector2 get_next_position(const Vector2 &p_position) const;
+	Vector2 get_direction(const Vector2 &p_position) const;
+	real_t get_distance(const Vector2 &p_position) const;
+
+	void reset();
+
+	void set_data(const Vector2 &p_target_position, LocalVector<Vector2> &&r_polygon_vertices, LocalVector<uint32_t> &&r_polygon_vertex_offsets, LocalVector<Vector2> &&r_polygon_waypoints, LocalVector<uint32_t> &&r_polygon_next, LocalVector<real_t> &&r_polygon_costs);
+};
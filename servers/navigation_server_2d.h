@@ -37,6 +37,7 @@
 
 #include "scene/resources/2d/navigation_mesh_source_geometry_data_2d.h"
 #include "scene/resources/2d/navigation_polygon.h"
+#include "servers/navigation/navigation_flow_field_2d.h"
 #include "servers/navigation/navigation_path_query_parameters_2d.h"
 #include "servers/navigation/navigation_path_query_result_2d.h"
 
@@ -113,6 +114,9 @@ public:
 
 	virtual Vector2 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
 
+	/// Returns a flow field that leads from anywhere on the map to the target position.
+	virtual Ref<NavigationFlowField2D> map_get_flow_field(RID p_map, Vector2 p_target_position, uint32_t p_navigation_layers = 1) const = 0;
+
 	/// Creates a new region.
 	virtual RID region_create() = 0;
 	virtual uint32_t region_get_iteration_id(RID p_region) const = 0;
@@ -303,6 +307,10 @@ public:
 
 	/// Returns a customized navigation path using a query parameters object
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	/// Queues a path query that runs on the WorkerThreadPool together with all other
+	/// queued queries. The result is filled and the callback called on the main thread
+	/// during the next process() after the one that started the batch.
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
 	/// Control activation of this server.
 	virtual void set_active(bool p_active) = 0;
@@ -60,6 +60,7 @@ public:
 	TypedArray<RID> map_get_obstacles(RID p_map) const override { return TypedArray<RID>(); }
 	void map_force_update(RID p_map) override {}
 	Vector2 map_get_random_point(RID p_map, uint32_t p_naviation_layers, bool p_uniformly) const override { return Vector2(); }
+	Ref<NavigationFlowField2D> map_get_flow_field(RID p_map, Vector2 p_target_position, uint32_t p_navigation_layers) const override { return Ref<NavigationFlowField2D>(); }
 	uint32_t map_get_iteration_id(RID p_map) const override { return 0; }
 	void map_set_use_async_iterations(RID p_map, bool p_enabled) override {}
 	bool map_get_use_async_iterations(RID p_map) const override { return false; }
@@ -164,6 +165,7 @@ public:
 	uint32_t obstacle_get_avoidance_layers(RID p_agent) const override { return 0; }
 
 	void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override {}
+	void query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override {}
 
 	void set_active(bool p_active) override {}
 	void process(double p_delta_time) override {}
@@ -64,6 +64,14 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_edge_connection_margin", "map"), &NavigationServer3D::map_get_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_set_link_connection_radius", "map", "radius"), &NavigationServer3D::map_set_link_connection_radius);
 	ClassDB::bind_method(D_METHOD("map_get_link_connection_radius", "map"), &NavigationServer3D::map_get_link_connection_radius);
+	ClassDB::bind_method(D_METHOD("map_set_hierarchical_cluster_size", "map", "cluster_size"), &NavigationServer3D::map_set_hierarchical_cluster_size);
+	ClassDB::bind_method(D_METHOD("map_get_hierarchical_cluster_size", "map"), &NavigationServer3D::map_get_hierarchical_cluster_size);
+	ClassDB::bind_method(D_METHOD("map_set_avoidance_lod_origin", "map", "origin"), &NavigationServer3D::map_set_avoidance_lod_origin);
+	ClassDB::bind_method(D_METHOD("map_get_avoidance_lod_origin", "map"), &NavigationServer3D::map_get_avoidance_lod_origin);
+	ClassDB::bind_method(D_METHOD("map_set_avoidance_lod_distance", "map", "distance"), &NavigationServer3D::map_set_avoidance_lod_distance);
+	ClassDB::bind_method(D_METHOD("map_get_avoidance_lod_distance", "map"), &NavigationServer3D::map_get_avoidance_lod_distance);
+	ClassDB::bind_method(D_METHOD("map_set_avoidance_lod_update_interval", "map", "interval"), &NavigationServer3D::map_set_avoidance_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("map_get_avoidance_lod_update_interval", "map"), &NavigationServer3D::map_get_avoidance_lod_update_interval);
 	ClassDB::bind_method(D_METHOD("map_get_path", "map", "origin", "destination", "optimize", "navigation_layers"), &NavigationServer3D::map_get_path, DEFVAL(1));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_to_segment", "map", "start", "end", "use_collision"), &NavigationServer3D::map_get_closest_point_to_segment, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point", "map", "to_point"), &NavigationServer3D::map_get_closest_point);
@@ -81,8 +89,10 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_use_async_iterations", "map"), &NavigationServer3D::map_get_use_async_iterations);
 
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer3D::map_get_random_point);
+	ClassDB::bind_method(D_METHOD("map_get_flow_field", "map", "target_position", "navigation_layers"), &NavigationServer3D::map_get_flow_field, DEFVAL(1));
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer3D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_async", "parameters", "result", "callback"), &NavigationServer3D::query_path_async, DEFVAL(Callable()));
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_get_iteration_id", "region"), &NavigationServer3D::region_get_iteration_id);
@@ -250,6 +260,7 @@ NavigationServer3D::NavigationServer3D() {
 	GLOBAL_DEF("navigation/3d/use_edge_connections", true);
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::FLOAT, "navigation/3d/default_edge_connection_margin", PropertyHint::HINT_RANGE, "0.01,10,0.001,or_greater"), NavigationDefaults3D::edge_connection_margin);
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::FLOAT, "navigation/3d/default_link_connection_radius", PropertyHint::HINT_RANGE, "0.01,10,0.001,or_greater"), NavigationDefaults3D::link_connection_radius);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "navigation/3d/default_hierarchical_cluster_size", PropertyHint::HINT_RANGE, "0,100,0.01,or_greater"), 0.0);
 
 #ifdef DEBUG_ENABLED
 #ifndef DISABLE_DEPRECATED
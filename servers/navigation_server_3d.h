@@ -37,6 +37,7 @@
 
 #include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
 #include "scene/resources/navigation_mesh.h"
+#include "servers/navigation/navigation_flow_field_3d.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
 #include "servers/navigation/navigation_path_query_result_3d.h"
 
@@ -108,6 +109,30 @@ public:
 	/// Returns the link connection radius of this map.
 	virtual real_t map_get_link_connection_radius(RID p_map) const = 0;
 
+	/// Set the size of the clusters used to speed up path queries on large maps.
+	virtual void map_set_hierarchical_cluster_size(RID p_map, real_t p_cluster_size) = 0;
+
+	/// Returns the hierarchical cluster size of this map.
+	virtual real_t map_get_hierarchical_cluster_size(RID p_map) const = 0;
+
+	/// Set the position that avoidance agents are considered near or distant from.
+	virtual void map_set_avoidance_lod_origin(RID p_map, Vector3 p_origin) = 0;
+
+	/// Returns the avoidance LOD origin of this map.
+	virtual Vector3 map_get_avoidance_lod_origin(RID p_map) const = 0;
+
+	/// Set the distance from the avoidance LOD origin beyond which agents update less often.
+	virtual void map_set_avoidance_lod_distance(RID p_map, real_t p_distance) = 0;
+
+	/// Returns the avoidance LOD distance of this map.
+	virtual real_t map_get_avoidance_lod_distance(RID p_map) const = 0;
+
+	/// Set how many avoidance steps pass between the updates of distant agents.
+	virtual void map_set_avoidance_lod_update_interval(RID p_map, int p_interval) = 0;
+
+	/// Returns the avoidance LOD update interval of this map.
+	virtual int map_get_avoidance_lod_update_interval(RID p_map) const = 0;
+
 	/// Returns the navigation path to reach the destination from the origin.
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) = 0;
 
@@ -129,6 +154,9 @@ public:
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
 
+	/// Returns a flow field that leads from anywhere on the map to the target position.
+	virtual Ref<NavigationFlowField3D> map_get_flow_field(RID p_map, Vector3 p_target_position, uint32_t p_navigation_layers = 1) const = 0;
+
 	/// Creates a new region.
 	virtual RID region_create() = 0;
 	virtual uint32_t region_get_iteration_id(RID p_region) const = 0;
@@ -357,6 +385,10 @@ public:
 
 	/// Returns a customized navigation path using a query parameters object
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	/// Queues a path query that runs on the WorkerThreadPool together with all other
+	/// queued queries. The result is filled and the callback called on the main thread
+	/// during the next process() after the one that started the batch.
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
 #ifndef _3D_DISABLED
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
@@ -56,12 +56,21 @@ public:
 	real_t map_get_edge_connection_margin(RID p_map) const override { return 0; }
 	void map_set_link_connection_radius(RID p_map, real_t p_connection_radius) override {}
 	real_t map_get_link_connection_radius(RID p_map) const override { return 0; }
+	void map_set_hierarchical_cluster_size(RID p_map, real_t p_cluster_size) override {}
+	real_t map_get_hierarchical_cluster_size(RID p_map) const override { return 0; }
+	void map_set_avoidance_lod_origin(RID p_map, Vector3 p_origin) override {}
+	Vector3 map_get_avoidance_lod_origin(RID p_map) const override { return Vector3(); }
+	void map_set_avoidance_lod_distance(RID p_map, real_t p_distance) override {}
+	real_t map_get_avoidance_lod_distance(RID p_map) const override { return 0; }
+	void map_set_avoidance_lod_update_interval(RID p_map, int p_interval) override {}
+	int map_get_avoidance_lod_update_interval(RID p_map) const override { return 0; }
 	Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) override { return Vector<Vector3>(); }
 	Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const override { return Vector3(); }
 	Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const override { return Vector3(); }
 	Vector3 map_get_closest_point_normal(RID p_map, const Vector3 &p_point) const override { return Vector3(); }
 	RID map_get_closest_point_owner(RID p_map, const Vector3 &p_point) const override { return RID(); }
 	Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override { return Vector3(); }
+	Ref<NavigationFlowField3D> map_get_flow_field(RID p_map, Vector3 p_target_position, uint32_t p_navigation_layers) const override { return Ref<NavigationFlowField3D>(); }
 	TypedArray<RID> map_get_links(RID p_map) const override { return TypedArray<RID>(); }
 	TypedArray<RID> map_get_regions(RID p_map) const override { return TypedArray<RID>(); }
 	TypedArray<RID> map_get_agents(RID p_map) const override { return TypedArray<RID>(); }
@@ -184,6 +193,7 @@ public:
 	uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const override { return 0; }
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override {}
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override {}
 
 #ifndef _3D_DISABLED
 	void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) override {}
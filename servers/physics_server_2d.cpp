@@ -638,6 +638,11 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_is_active", "space"), &PhysicsServer2D::space_is_active);
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer2D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer2D::space_get_param);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer2D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer2D::space_restore_state);
+	ClassDB::bind_method(D_METHOD("space_set_deterministic", "space", "enabled"), &PhysicsServer2D::space_set_deterministic);
+	ClassDB::bind_method(D_METHOD("space_is_deterministic", "space"), &PhysicsServer2D::space_is_deterministic);
+	ClassDB::bind_method(D_METHOD("space_get_step_checksum", "space"), &PhysicsServer2D::space_get_step_checksum);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer2D::space_get_direct_state);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer2D::area_create);
@@ -272,6 +272,14 @@ public:
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) = 0;
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const = 0;
 
+	// Binary snapshot of the simulation state, only valid for the same space in the same build.
+	virtual PackedByteArray space_save_state(RID p_space) const = 0;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) = 0;
+
+	virtual void space_set_deterministic(RID p_space, bool p_enabled) = 0;
+	virtual bool space_is_deterministic(RID p_space) const = 0;
+	virtual uint32_t space_get_step_checksum(RID p_space) const = 0;
+
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState2D *space_get_direct_state(RID p_space) = 0;
 
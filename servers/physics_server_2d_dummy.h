@@ -154,6 +154,13 @@ public:
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) override {}
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const override { return 0; }
 
+	virtual PackedByteArray space_save_state(RID p_space) const override { return PackedByteArray(); }
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override { return false; }
+
+	virtual void space_set_deterministic(RID p_space, bool p_enabled) override {}
+	virtual bool space_is_deterministic(RID p_space) const override { return false; }
+	virtual uint32_t space_get_step_checksum(RID p_space) const override { return 0; }
+
 	virtual PhysicsDirectSpaceState2D *space_get_direct_state(RID p_space) override { return space_state_dummy; }
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override {}
@@ -477,6 +477,108 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(p_ray_query.is_null(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The from and to arrays must have the same size.");
+
+	const int count = p_from.size();
+	LocalVector<RayResult> results;
+	results.resize(count);
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptr());
+
+	PackedVector3Array positions;
+	PackedVector3Array normals;
+	PackedInt64Array collider_ids;
+	PackedInt32Array shapes;
+	PackedInt32Array face_indices;
+	TypedArray<RID> rids;
+	positions.resize(count);
+	normals.resize(count);
+	collider_ids.resize(count);
+	shapes.resize(count);
+	face_indices.resize(count);
+	rids.resize(count);
+
+	Vector3 *positions_ptrw = positions.ptrw();
+	Vector3 *normals_ptrw = normals.ptrw();
+	int64_t *collider_ids_ptrw = collider_ids.ptrw();
+	int32_t *shapes_ptrw = shapes.ptrw();
+	int32_t *face_indices_ptrw = face_indices.ptrw();
+	for (int i = 0; i < count; i++) {
+		const RayResult &result = results[i];
+		const bool hit = result.rid.is_valid();
+		positions_ptrw[i] = result.position;
+		normals_ptrw[i] = result.normal;
+		collider_ids_ptrw[i] = (int64_t)result.collider_id;
+		shapes_ptrw[i] = hit ? result.shape : -1;
+		face_indices_ptrw[i] = result.face_index;
+		if (hit) {
+			rids[i] = result.rid;
+		}
+	}
+
+	Dictionary d;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+	d["face_index"] = face_indices;
+	d["rid"] = rids;
+
+	return d;
+}
+
+Vector<real_t> PhysicsDirectSpaceState3D::_cast_motions(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_origins, const PackedVector3Array &p_motions) {
+	ERR_FAIL_COND_V(p_shape_query.is_null(), Vector<real_t>());
+	ERR_FAIL_COND_V_MSG(p_origins.size() != p_motions.size(), Vector<real_t>(), "The origins and motions arrays must have the same size.");
+
+	const int count = p_origins.size();
+	LocalVector<real_t> closest_safe;
+	LocalVector<real_t> closest_unsafe;
+	closest_safe.resize(count);
+	closest_unsafe.resize(count);
+	if (!cast_motions(p_shape_query->get_parameters(), p_origins.ptr(), p_motions.ptr(), count, closest_safe.ptr(), closest_unsafe.ptr())) {
+		return Vector<real_t>();
+	}
+
+	Vector<real_t> ret;
+	ret.resize(count * 2);
+	real_t *ret_ptrw = ret.ptrw();
+	for (int i = 0; i < count; i++) {
+		ret_ptrw[i * 2 + 0] = closest_safe[i];
+		ret_ptrw[i * 2 + 1] = closest_unsafe[i];
+	}
+	return ret;
+}
+
+int PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results) {
+	RayParameters parameters = p_parameters;
+	int hit_count = 0;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_results[i] = RayResult();
+		if (intersect_ray(parameters, r_results[i])) {
+			hit_count++;
+		}
+	}
+	return hit_count;
+}
+
+bool PhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform.origin = p_origins[i];
+		parameters.motion = p_motions[i];
+		r_closest_safe[i] = 1.0;
+		r_closest_unsafe[i] = 1.0;
+		if (!cast_motion(parameters, r_closest_safe[i], r_closest_unsafe[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -487,6 +589,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays);
+	ClassDB::bind_method(D_METHOD("cast_motions", "parameters", "origins", "motions"), &PhysicsDirectSpaceState3D::_cast_motions);
 }
 
 ///////////////////////////////
@@ -716,6 +820,8 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_is_active", "space"), &PhysicsServer3D::space_is_active);
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer3D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer3D::space_restore_state);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
@@ -1102,6 +1208,10 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_BROAD_PHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_NARROW_PHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_SOLVER_TIME);
+	BIND_ENUM_CONSTANT(INFO_TEMP_MEMORY_PEAK);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
@@ -1135,6 +1245,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/sleep_threshold_linear", PropertyHint::HINT_RANGE, "0,1,0.001,or_greater"), 0.1);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/sleep_threshold_angular", PropertyHint::HINT_RANGE, "0,90,0.1,radians_as_degrees"), Math::deg_to_rad(8.0));
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/time_before_sleep", PropertyHint::HINT_RANGE, "0,5,0.01,or_greater"), 0.5);
+	GLOBAL_DEF("physics/3d/step_spaces_in_parallel", false);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/solver_iterations", PropertyHint::HINT_RANGE, "1,32,1,or_greater"), 16);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_recycle_radius", PropertyHint::HINT_RANGE, "0,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PropertyHint::HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
@@ -130,6 +130,8 @@ private:
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 	TypedArray<Vector3> _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
+	Dictionary _intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
+	Vector<real_t> _cast_motions(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_origins, const PackedVector3Array &p_motions);
 
 protected:
 	static void _bind_methods();
@@ -208,6 +210,15 @@ public:
 
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const = 0;
 
+	// Batched queries. Every query in a batch shares the filter settings of p_parameters and only
+	// differs in its endpoints. The default implementations run the single queries one by one,
+	// servers override them to spread the batch over the worker threads.
+
+	// Rays that hit nothing get a default RayResult, with an invalid rid. Returns the number of hits.
+	virtual int intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results);
+	// Each cast uses p_parameters.transform moved to p_origins[i], along p_motions[i].
+	virtual bool cast_motions(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe);
+
 	PhysicsDirectSpaceState3D();
 };
 
@@ -302,6 +313,10 @@ public:
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) = 0;
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const = 0;
 
+	// Binary snapshot of the simulation state, only valid for the same space in the same build.
+	virtual PackedByteArray space_save_state(RID p_space) const = 0;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) = 0;
+
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) = 0;
 
@@ -808,7 +823,11 @@ public:
 	enum ProcessInfo {
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_BROAD_PHASE_TIME,
+		INFO_NARROW_PHASE_TIME,
+		INFO_SOLVER_TIME,
+		INFO_TEMP_MEMORY_PEAK,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
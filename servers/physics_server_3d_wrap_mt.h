@@ -112,6 +112,9 @@ public:
 	FUNC3(space_set_param, RID, SpaceParameter, real_t);
 	FUNC2RC(real_t, space_get_param, RID, SpaceParameter);
 
+	FUNC1RC(PackedByteArray, space_save_state, RID);
+	FUNC2R(bool, space_restore_state, RID, const PackedByteArray &);
+
 	// this function only works on physics process, errors and returns null otherwise
 	PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override {
 		ERR_FAIL_COND_V(!Thread::is_main_thread(), nullptr);
@@ -78,6 +78,19 @@ public:
 
 	PagedAllocator<GeometryInstanceDummy> geometry_instance_alloc;
 
+	// Render buffers that hold no data; only handed out when culling is enabled in Utilities,
+	// since the scene cull refuses to run without valid render buffers.
+	class RenderSceneBuffersDummy : public RenderSceneBuffers {
+		GDCLASS(RenderSceneBuffersDummy, RenderSceneBuffers);
+
+	public:
+		virtual void configure(const RenderSceneBuffersConfiguration *p_config) override {}
+		virtual void set_fsr_sharpness(float p_fsr_sharpness) override {}
+		virtual void set_texture_mipmap_bias(float p_texture_mipmap_bias) override {}
+		virtual void set_anisotropic_filtering_level(RS::ViewportAnisotropicFiltering p_anisotropic_filtering_level) override {}
+		virtual void set_use_debanding(bool p_use_debanding) override {}
+	};
+
 public:
 	RenderGeometryInstance *geometry_instance_create(RID p_base) override {
 		RS::InstanceType type = RendererDummy::Utilities::get_singleton()->get_base_type(p_base);
@@ -153,7 +166,15 @@ public:
 
 	void voxel_gi_set_quality(RS::VoxelGIQuality) override {}
 
-	void render_scene(const Ref<RenderSceneBuffers> &p_render_buffers, const CameraData *p_camera_data, const CameraData *p_prev_camera_data, const PagedArray<RenderGeometryInstance *> &p_instances, const PagedArray<RID> &p_lights, const PagedArray<RID> &p_reflection_probes, const PagedArray<RID> &p_voxel_gi_instances, const PagedArray<RID> &p_decals, const PagedArray<RID> &p_lightmaps, const PagedArray<RID> &p_fog_volumes, RID p_environment, RID p_camera_attributes, RID p_compositor, RID p_shadow_atlas, RID p_occluder_debug_tex, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, const RenderShadowData *p_render_shadows, int p_render_shadow_count, const RenderSDFGIData *p_render_sdfgi_regions, int p_render_sdfgi_region_count, const RenderSDFGIUpdateData *p_sdfgi_update_data = nullptr, RenderingMethod::RenderInfo *r_info = nullptr) override {}
+	void render_scene(const Ref<RenderSceneBuffers> &p_render_buffers, const CameraData *p_camera_data, const CameraData *p_prev_camera_data, const PagedArray<RenderGeometryInstance *> &p_instances, const PagedArray<RID> &p_lights, const PagedArray<RID> &p_reflection_probes, const PagedArray<RID> &p_voxel_gi_instances, const PagedArray<RID> &p_decals, const PagedArray<RID> &p_lightmaps, const PagedArray<RID> &p_fog_volumes, RID p_environment, RID p_camera_attributes, RID p_compositor, RID p_shadow_atlas, RID p_occluder_debug_tex, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, const RenderShadowData *p_render_shadows, int p_render_shadow_count, const RenderSDFGIData *p_render_sdfgi_regions, int p_render_sdfgi_region_count, const RenderSDFGIUpdateData *p_sdfgi_update_data = nullptr, RenderingMethod::RenderInfo *r_info = nullptr) override {
+		if (r_info) {
+			// Report what survived culling, as a real renderer would draw it.
+			r_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME] += p_instances.size();
+			for (int i = 0; i < p_render_shadow_count; i++) {
+				r_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME] += p_render_shadows[i].instances.size();
+			}
+		}
+	}
 	void render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) override {}
 	void render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) override {}
 
@@ -161,7 +182,14 @@ public:
 	void set_time(double p_time, double p_step) override {}
 	void set_debug_draw_mode(RS::ViewportDebugDraw p_debug_draw) override {}
 
-	Ref<RenderSceneBuffers> render_buffers_create() override { return Ref<RenderSceneBuffers>(); }
+	Ref<RenderSceneBuffers> render_buffers_create() override {
+		if (!RendererDummy::Utilities::is_culling_enabled()) {
+			return Ref<RenderSceneBuffers>();
+		}
+		Ref<RenderSceneBuffersDummy> rb;
+		rb.instantiate();
+		return rb;
+	}
 	void gi_set_use_half_resolution(bool p_enable) override {}
 
 	void screen_space_roughness_limiter_set_active(bool p_enable, float p_amount, float p_curve) override {}
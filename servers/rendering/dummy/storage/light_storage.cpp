@@ -32,6 +32,8 @@
 
 #include "light_storage.h"
 
+#include "utilities.h"
+
 using namespace RendererDummy;
 
 LightStorage *LightStorage::singleton = nullptr;
@@ -49,7 +51,10 @@ LightStorage::~LightStorage() {
 }
 
 bool LightStorage::free(RID p_rid) {
-	if (owns_lightmap(p_rid)) {
+	if (owns_light(p_rid)) {
+		light_free(p_rid);
+		return true;
+	} else if (owns_lightmap(p_rid)) {
 		lightmap_free(p_rid);
 		return true;
 	} else if (owns_lightmap_instance(p_rid)) {
@@ -60,6 +65,250 @@ bool LightStorage::free(RID p_rid) {
 	return false;
 }
 
+/* LIGHT API */
+
+void LightStorage::_light_initialize(RID p_light, RS::LightType p_type) {
+	Light light;
+	light.type = p_type;
+
+	for (int i = 0; i < RS::LIGHT_PARAM_MAX; i++) {
+		light.param[i] = 0.0;
+	}
+	light.param[RS::LIGHT_PARAM_ENERGY] = 1.0;
+	light.param[RS::LIGHT_PARAM_INDIRECT_ENERGY] = 1.0;
+	light.param[RS::LIGHT_PARAM_VOLUMETRIC_FOG_ENERGY] = 1.0;
+	light.param[RS::LIGHT_PARAM_SPECULAR] = 0.5;
+	light.param[RS::LIGHT_PARAM_RANGE] = 1.0;
+	light.param[RS::LIGHT_PARAM_ATTENUATION] = 1.0;
+	light.param[RS::LIGHT_PARAM_SPOT_ANGLE] = 45;
+	light.param[RS::LIGHT_PARAM_SPOT_ATTENUATION] = 1.0;
+	light.param[RS::LIGHT_PARAM_SHADOW_SPLIT_1_OFFSET] = 0.1;
+	light.param[RS::LIGHT_PARAM_SHADOW_SPLIT_2_OFFSET] = 0.3;
+	light.param[RS::LIGHT_PARAM_SHADOW_SPLIT_3_OFFSET] = 0.6;
+	light.param[RS::LIGHT_PARAM_SHADOW_FADE_START] = 0.8;
+	light.param[RS::LIGHT_PARAM_SHADOW_NORMAL_BIAS] = 1.0;
+	light.param[RS::LIGHT_PARAM_SHADOW_BIAS] = 0.02;
+	light.param[RS::LIGHT_PARAM_SHADOW_OPACITY] = 1.0;
+	light.param[RS::LIGHT_PARAM_SHADOW_PANCAKE_SIZE] = 20.0;
+	light.param[RS::LIGHT_PARAM_TRANSMITTANCE_BIAS] = 0.05;
+	light.param[RS::LIGHT_PARAM_INTENSITY] = p_type == RS::LIGHT_DIRECTIONAL ? 100000.0 : 1000.0;
+
+	light_owner.initialize_rid(p_light, light);
+}
+
+RID LightStorage::directional_light_allocate() {
+	if (!Utilities::is_culling_enabled()) {
+		return RID();
+	}
+	return light_owner.allocate_rid();
+}
+
+void LightStorage::directional_light_initialize(RID p_light) {
+	if (p_light.is_valid()) {
+		_light_initialize(p_light, RS::LIGHT_DIRECTIONAL);
+	}
+}
+
+RID LightStorage::omni_light_allocate() {
+	if (!Utilities::is_culling_enabled()) {
+		return RID();
+	}
+	return light_owner.allocate_rid();
+}
+
+void LightStorage::omni_light_initialize(RID p_light) {
+	if (p_light.is_valid()) {
+		_light_initialize(p_light, RS::LIGHT_OMNI);
+	}
+}
+
+RID LightStorage::spot_light_allocate() {
+	if (!Utilities::is_culling_enabled()) {
+		return RID();
+	}
+	return light_owner.allocate_rid();
+}
+
+void LightStorage::spot_light_initialize(RID p_light) {
+	if (p_light.is_valid()) {
+		_light_initialize(p_light, RS::LIGHT_SPOT);
+	}
+}
+
+void LightStorage::light_free(RID p_rid) {
+	Light *light = light_owner.get_or_null(p_rid);
+	if (!light) {
+		return;
+	}
+	light->dependency.deleted_notify(p_rid);
+	light_owner.free(p_rid);
+}
+
+void LightStorage::light_set_color(RID p_light, const Color &p_color) {
+	Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return;
+	}
+	light->color = p_color;
+}
+
+void LightStorage::light_set_param(RID p_light, RS::LightParam p_param, float p_value) {
+	Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return;
+	}
+	ERR_FAIL_INDEX(p_param, RS::LIGHT_PARAM_MAX);
+
+	if (light->param[p_param] == p_value) {
+		return;
+	}
+	light->param[p_param] = p_value;
+
+	if (p_param == RS::LIGHT_PARAM_RANGE || p_param == RS::LIGHT_PARAM_SPOT_ANGLE) {
+		light->version++;
+		light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+	}
+}
+
+void LightStorage::light_set_shadow(RID p_light, bool p_enabled) {
+	Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return;
+	}
+	light->shadow = p_enabled;
+
+	light->version++;
+	light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+}
+
+void LightStorage::light_set_cull_mask(RID p_light, uint32_t p_mask) {
+	Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return;
+	}
+	light->cull_mask = p_mask;
+
+	light->version++;
+	light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+}
+
+void LightStorage::light_set_shadow_caster_mask(RID p_light, uint32_t p_caster_mask) {
+	Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return;
+	}
+	light->shadow_caster_mask = p_caster_mask;
+
+	light->version++;
+	light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+}
+
+uint32_t LightStorage::light_get_shadow_caster_mask(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return 0xFFFFFFFF;
+	}
+	return light->shadow_caster_mask;
+}
+
+void LightStorage::light_set_bake_mode(RID p_light, RS::LightBakeMode p_bake_mode) {
+	Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return;
+	}
+	light->bake_mode = p_bake_mode;
+
+	light->version++;
+	light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+}
+
+bool LightStorage::light_has_shadow(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return false;
+	}
+	return light->shadow;
+}
+
+RS::LightType LightStorage::light_get_type(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return RS::LIGHT_OMNI;
+	}
+	return light->type;
+}
+
+AABB LightStorage::light_get_aabb(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return AABB();
+	}
+
+	switch (light->type) {
+		case RS::LIGHT_SPOT: {
+			float len = light->param[RS::LIGHT_PARAM_RANGE];
+			float size = Math::tan(Math::deg_to_rad(light->param[RS::LIGHT_PARAM_SPOT_ANGLE])) * len;
+			return AABB(Vector3(-size, -size, -len), Vector3(size * 2, size * 2, len));
+		};
+		case RS::LIGHT_OMNI: {
+			float r = light->param[RS::LIGHT_PARAM_RANGE];
+			return AABB(-Vector3(r, r, r), Vector3(r, r, r) * 2);
+		};
+		case RS::LIGHT_DIRECTIONAL: {
+			return AABB();
+		};
+	}
+
+	ERR_FAIL_V(AABB());
+}
+
+float LightStorage::light_get_param(RID p_light, RS::LightParam p_param) {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return 0.0;
+	}
+	ERR_FAIL_INDEX_V(p_param, RS::LIGHT_PARAM_MAX, 0.0);
+	return light->param[p_param];
+}
+
+Color LightStorage::light_get_color(RID p_light) {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return Color();
+	}
+	return light->color;
+}
+
+RS::LightBakeMode LightStorage::light_get_bake_mode(RID p_light) {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return RS::LIGHT_BAKE_DISABLED;
+	}
+	return light->bake_mode;
+}
+
+uint64_t LightStorage::light_get_version(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return 0;
+	}
+	return light->version;
+}
+
+uint32_t LightStorage::light_get_cull_mask(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	if (!light) {
+		return 0;
+	}
+	return light->cull_mask;
+}
+
+void LightStorage::light_update_dependency(RID p_light, DependencyTracker *p_instance) const {
+	Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL(light);
+	p_instance->update_dependency(&light->dependency);
+}
+
 /* LIGHTMAP API */
 
 RID LightStorage::lightmap_allocate() {
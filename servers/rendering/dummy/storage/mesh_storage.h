@@ -42,6 +42,7 @@ struct DummyMesh {
 	int blend_shape_count;
 	RS::BlendShapeMode blend_shape_mode;
 	PackedFloat32Array blend_shape_values;
+	AABB custom_aabb;
 	Dependency dependency;
 };
 
@@ -123,9 +124,36 @@ public:
 		return m->surfaces.size();
 	}
 
-	virtual void mesh_set_custom_aabb(RID p_mesh, const AABB &p_aabb) override {}
-	virtual AABB mesh_get_custom_aabb(RID p_mesh) const override { return AABB(); }
-	virtual AABB mesh_get_aabb(RID p_mesh, RID p_skeleton = RID()) override { return AABB(); }
+	virtual void mesh_set_custom_aabb(RID p_mesh, const AABB &p_aabb) override {
+		DummyMesh *m = mesh_owner.get_or_null(p_mesh);
+		ERR_FAIL_NULL(m);
+		m->custom_aabb = p_aabb;
+		m->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
+	}
+
+	virtual AABB mesh_get_custom_aabb(RID p_mesh) const override {
+		DummyMesh *m = mesh_owner.get_or_null(p_mesh);
+		ERR_FAIL_NULL_V(m, AABB());
+		return m->custom_aabb;
+	}
+
+	virtual AABB mesh_get_aabb(RID p_mesh, RID p_skeleton = RID()) override {
+		DummyMesh *m = mesh_owner.get_or_null(p_mesh);
+		ERR_FAIL_NULL_V(m, AABB());
+		if (m->custom_aabb != AABB()) {
+			return m->custom_aabb;
+		}
+
+		AABB aabb;
+		for (int i = 0; i < m->surfaces.size(); i++) {
+			if (i == 0) {
+				aabb = m->surfaces[i].aabb;
+			} else {
+				aabb.merge_with(m->surfaces[i].aabb);
+			}
+		}
+		return aabb;
+	}
 
 	virtual void mesh_set_path(RID p_mesh, const String &p_path) override {}
 	virtual String mesh_get_path(RID p_mesh) const override { return String(); }
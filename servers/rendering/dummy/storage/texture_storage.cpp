@@ -32,6 +32,8 @@
 
 #include "texture_storage.h"
 
+#include "utilities.h"
+
 using namespace RendererDummy;
 
 TextureStorage *TextureStorage::singleton = nullptr;
@@ -43,3 +45,83 @@ TextureStorage::TextureStorage() {
 TextureStorage::~TextureStorage() {
 	singleton = nullptr;
 }
+
+/* RENDER TARGET */
+
+RID TextureStorage::render_target_create() {
+	if (!Utilities::is_culling_enabled()) {
+		return RID();
+	}
+	return render_target_owner.make_rid(DummyRenderTarget());
+}
+
+void TextureStorage::render_target_free(RID p_rid) {
+	if (render_target_owner.owns(p_rid)) {
+		render_target_owner.free(p_rid);
+	}
+}
+
+void TextureStorage::render_target_set_position(RID p_render_target, int p_x, int p_y) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return;
+	}
+	rt->position = Point2i(p_x, p_y);
+}
+
+Point2i TextureStorage::render_target_get_position(RID p_render_target) const {
+	const DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return Point2i();
+	}
+	return rt->position;
+}
+
+void TextureStorage::render_target_set_size(RID p_render_target, int p_width, int p_height, uint32_t p_view_count) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return;
+	}
+	rt->size = Size2i(p_width, p_height);
+	rt->view_count = p_view_count;
+}
+
+Size2i TextureStorage::render_target_get_size(RID p_render_target) const {
+	const DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return Size2i();
+	}
+	return rt->size;
+}
+
+void TextureStorage::render_target_set_transparent(RID p_render_target, bool p_is_transparent) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return;
+	}
+	rt->is_transparent = p_is_transparent;
+}
+
+bool TextureStorage::render_target_get_transparent(RID p_render_target) const {
+	const DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return false;
+	}
+	return rt->is_transparent;
+}
+
+void TextureStorage::render_target_set_direct_to_screen(RID p_render_target, bool p_direct_to_screen) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return;
+	}
+	rt->direct_to_screen = p_direct_to_screen;
+}
+
+bool TextureStorage::render_target_get_direct_to_screen(RID p_render_target) const {
+	const DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt) {
+		return false;
+	}
+	return rt->direct_to_screen;
+}
@@ -45,6 +45,16 @@ private:
 	};
 	mutable RID_PtrOwner<DummyTexture> texture_owner;
 
+	// Only allocated when Utilities::is_culling_enabled(), otherwise viewports are never drawn.
+	struct DummyRenderTarget {
+		Point2i position;
+		Size2i size;
+		uint32_t view_count = 1;
+		bool is_transparent = false;
+		bool direct_to_screen = false;
+	};
+	mutable RID_Owner<DummyRenderTarget> render_target_owner;
+
 public:
 	static TextureStorage *get_singleton() { return singleton; }
 
@@ -163,16 +173,18 @@ public:
 
 	/* RENDER TARGET */
 
-	virtual RID render_target_create() override { return RID(); }
-	virtual void render_target_free(RID p_rid) override {}
-	virtual void render_target_set_position(RID p_render_target, int p_x, int p_y) override {}
-	virtual Point2i render_target_get_position(RID p_render_target) const override { return Point2i(); }
-	virtual void render_target_set_size(RID p_render_target, int p_width, int p_height, uint32_t p_view_count) override {}
-	virtual Size2i render_target_get_size(RID p_render_target) const override { return Size2i(); }
-	virtual void render_target_set_transparent(RID p_render_target, bool p_is_transparent) override {}
-	virtual bool render_target_get_transparent(RID p_render_target) const override { return false; }
-	virtual void render_target_set_direct_to_screen(RID p_render_target, bool p_direct_to_screen) override {}
-	virtual bool render_target_get_direct_to_screen(RID p_render_target) const override { return false; }
+	bool owns_render_target(RID p_rid) { return render_target_owner.owns(p_rid); }
+
+	virtual RID render_target_create() override;
+	virtual void render_target_free(RID p_rid) override;
+	virtual void render_target_set_position(RID p_render_target, int p_x, int p_y) override;
+	virtual Point2i render_target_get_position(RID p_render_target) const override;
+	virtual void render_target_set_size(RID p_render_target, int p_width, int p_height, uint32_t p_view_count) override;
+	virtual Size2i render_target_get_size(RID p_render_target) const override;
+	virtual void render_target_set_transparent(RID p_render_target, bool p_is_transparent) override;
+	virtual bool render_target_get_transparent(RID p_render_target) const override;
+	virtual void render_target_set_direct_to_screen(RID p_render_target, bool p_direct_to_screen) override;
+	virtual bool render_target_get_direct_to_screen(RID p_render_target) const override;
 	virtual bool render_target_was_used(RID p_render_target) const override { return false; }
 	virtual void render_target_set_as_unused(RID p_render_target) override {}
 	virtual void render_target_set_msaa(RID p_render_target, RS::ViewportMSAA p_msaa) override {}
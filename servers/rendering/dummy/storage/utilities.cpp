@@ -40,6 +40,7 @@
 using namespace RendererDummy;
 
 Utilities *Utilities::singleton = nullptr;
+bool Utilities::culling_enabled = false;
 
 RS::InstanceType Utilities::get_base_type(RID p_rid) const {
 	if (RendererDummy::MeshStorage::get_singleton()->owns_mesh(p_rid)) {
@@ -48,6 +49,8 @@ RS::InstanceType Utilities::get_base_type(RID p_rid) const {
 		return RS::INSTANCE_MULTIMESH;
 	} else if (RendererDummy::LightStorage::get_singleton()->owns_lightmap(p_rid)) {
 		return RS::INSTANCE_LIGHTMAP;
+	} else if (RendererDummy::LightStorage::get_singleton()->owns_light(p_rid)) {
+		return RS::INSTANCE_LIGHT;
 	}
 	return RS::INSTANCE_NONE;
 }
@@ -78,6 +81,8 @@ void Utilities::base_update_dependency(RID p_base, DependencyTracker *p_instance
 	if (RendererDummy::MeshStorage::get_singleton()->owns_mesh(p_base)) {
 		DummyMesh *mesh = RendererDummy::MeshStorage::get_singleton()->get_mesh(p_base);
 		p_instance->update_dependency(&mesh->dependency);
+	} else if (RendererDummy::LightStorage::get_singleton()->owns_light(p_base)) {
+		RendererDummy::LightStorage::get_singleton()->light_update_dependency(p_base, p_instance);
 	}
 }
 
@@ -39,10 +39,17 @@ namespace RendererDummy {
 class Utilities : public RendererUtilities {
 private:
 	static Utilities *singleton;
+	static bool culling_enabled;
 
 public:
 	static Utilities *get_singleton() { return singleton; }
 
+	// When enabled, render targets, render buffers and lights are backed by real objects,
+	// so viewports go through the full scene and canvas culling while nothing is sent to a GPU.
+	// Used to measure the CPU cost of rendering on machines without one.
+	static void set_culling_enabled(bool p_enabled) { culling_enabled = p_enabled; }
+	static bool is_culling_enabled() { return culling_enabled; }
+
 	Utilities();
 	~Utilities();
 
@@ -253,6 +253,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 
 		if (ci->update_when_visible) {
 			RenderingServerDefault::redraw_request();
+			item_requested_redraw = true;
 		}
 
 		if (ci->commands != nullptr || ci->copy_back_buffer) {
@@ -285,6 +286,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 			}
 
 			ci->visibility_notifier->visible_in_frame = RSG::rasterizer->get_frame_number();
+			ci->visibility_notifier->canvas = _current_canvas;
 		}
 	} else if (ci->repeat_source) {
 		// If repeat source does not draw itself it still needs transform updated as its child items' repeat offsets are relative to it.
@@ -488,6 +490,7 @@ void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, co
 
 	sdf_used = false;
 	snapping_2d_transforms_to_pixel = p_snap_2d_transforms_to_pixel;
+	_current_canvas = p_canvas;
 
 	if (p_canvas->children_order_dirty) {
 		p_canvas->child_items.sort();
@@ -506,6 +509,38 @@ bool RendererCanvasCull::was_sdf_used() {
 	return sdf_used;
 }
 
+void RendererCanvasCull::_mark_item_canvas_changed(Item *p_item) {
+	// Walk up to the canvas owning this item; items that aren't attached to any canvas can't affect a viewport.
+	Item *item = p_item;
+	while (item->parent.is_valid()) {
+		Item *parent_item = canvas_item_owner.get_or_null(item->parent);
+		if (!parent_item) {
+			Canvas *canvas = canvas_owner.get_or_null(item->parent);
+			if (canvas) {
+				canvas->changed_version = ++changed_version;
+			}
+			return;
+		}
+		item = parent_item;
+	}
+}
+
+bool RendererCanvasCull::canvas_changed_since(const Canvas *p_canvas, uint64_t p_version) const {
+	if (p_canvas->changed_version > p_version || global_changed_version > p_version) {
+		return true;
+	}
+
+	// Interpolated transforms keep moving between physics ticks until they settle.
+	if (_interpolation_data.interpolation_enabled) {
+		const InterpolationData &id = _interpolation_data;
+		return !id.canvas_item_transform_update_list_curr->is_empty() || !id.canvas_item_transform_update_list_prev->is_empty() ||
+				!id.canvas_light_transform_update_list_curr->is_empty() || !id.canvas_light_transform_update_list_prev->is_empty() ||
+				!id.canvas_light_occluder_transform_update_list_curr->is_empty() || !id.canvas_light_occluder_transform_update_list_prev->is_empty();
+	}
+
+	return false;
+}
+
 RID RendererCanvasCull::canvas_allocate() {
 	return canvas_owner.allocate_rid();
 }
@@ -521,6 +556,7 @@ void RendererCanvasCull::canvas_set_item_mirroring(RID p_canvas, RID p_item, con
 
 	int idx = canvas->find_item(canvas_item);
 	ERR_FAIL_COND(idx == -1);
+	_canvas_changed(canvas);
 
 	bool is_repeat_source = (p_mirroring.x || p_mirroring.y);
 	canvas_item->repeat_source = is_repeat_source;
@@ -533,6 +569,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 	ERR_FAIL_COND(p_repeat_times < 0);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	bool is_repeat_source = (p_repeat_size.x || p_repeat_size.y) && p_repeat_times;
 	canvas_item->repeat_source = is_repeat_source;
@@ -544,6 +581,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 void RendererCanvasCull::canvas_set_modulate(RID p_canvas, const Color &p_color) {
 	Canvas *canvas = canvas_owner.get_or_null(p_canvas);
 	ERR_FAIL_NULL(canvas);
+	_canvas_changed(canvas);
 	canvas->modulate = p_color;
 }
 
@@ -554,6 +592,7 @@ void RendererCanvasCull::canvas_set_disable_scale(bool p_disable) {
 void RendererCanvasCull::canvas_set_parent(RID p_canvas, RID p_parent, float p_scale) {
 	Canvas *canvas = canvas_owner.get_or_null(p_canvas);
 	ERR_FAIL_NULL(canvas);
+	_canvas_changed(canvas);
 
 	canvas->parent = p_parent;
 	canvas->parent_scale = p_scale;
@@ -571,6 +610,7 @@ void RendererCanvasCull::canvas_item_initialize(RID p_rid) {
 void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	if (canvas_item->parent.is_valid()) {
 		if (canvas_owner.owns(canvas_item->parent)) {
@@ -610,11 +650,13 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 	}
 
 	canvas_item->parent = p_parent;
+	_item_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visible(RID p_item, bool p_visible) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->visible = p_visible;
 
@@ -624,6 +666,7 @@ void RendererCanvasCull::canvas_item_set_visible(RID p_item, bool p_visible) {
 void RendererCanvasCull::canvas_item_set_light_mask(RID p_item, int p_mask) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->light_mask = p_mask;
 }
@@ -631,6 +674,7 @@ void RendererCanvasCull::canvas_item_set_light_mask(RID p_item, int p_mask) {
 void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	if (_interpolation_data.interpolation_enabled && canvas_item->interpolated) {
 		if (!canvas_item->on_interpolate_transform_list) {
@@ -647,6 +691,7 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->visibility_layer = p_visibility_layer;
 }
@@ -662,6 +707,7 @@ uint32_t RendererCanvasCull::canvas_item_get_visibility_layer(RID p_item) {
 void RendererCanvasCull::canvas_item_set_clip(RID p_item, bool p_clip) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->clip = p_clip;
 }
@@ -669,6 +715,7 @@ void RendererCanvasCull::canvas_item_set_clip(RID p_item, bool p_clip) {
 void RendererCanvasCull::canvas_item_set_distance_field_mode(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->distance_field = p_enable;
 }
@@ -676,6 +723,7 @@ void RendererCanvasCull::canvas_item_set_distance_field_mode(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
@@ -684,6 +732,7 @@ void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 void RendererCanvasCull::canvas_item_set_modulate(RID p_item, const Color &p_color) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->modulate = p_color;
 }
@@ -691,6 +740,7 @@ void RendererCanvasCull::canvas_item_set_modulate(RID p_item, const Color &p_col
 void RendererCanvasCull::canvas_item_set_self_modulate(RID p_item, const Color &p_color) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->self_modulate = p_color;
 }
@@ -698,6 +748,7 @@ void RendererCanvasCull::canvas_item_set_self_modulate(RID p_item, const Color &
 void RendererCanvasCull::canvas_item_set_draw_behind_parent(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->behind = p_enable;
 }
@@ -705,6 +756,7 @@ void RendererCanvasCull::canvas_item_set_draw_behind_parent(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_set_use_identity_transform(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->use_identity_transform = p_enable;
 }
@@ -714,11 +766,13 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
+	_item_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(line);
@@ -948,6 +1002,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	ERR_FAIL_COND(p_points.size() < 2);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Color color = Color(1, 1, 1, 1);
 
@@ -1218,6 +1273,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 		}
 		Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 		ERR_FAIL_NULL(canvas_item);
+		_item_changed(canvas_item);
 
 		Vector<Color> colors;
 		if (p_colors.size() == 1) {
@@ -1260,6 +1316,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1424,6 +1481,7 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos, float p_radius, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	static const int circle_segments = 64;
 
@@ -1515,6 +1573,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile, const Color &p_modulate, bool p_transpose) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1546,6 +1605,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, int p_outline_size, float p_px_range, float p_scale) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1580,6 +1640,7 @@ void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, co
 void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1612,6 +1673,7 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1653,6 +1715,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RS::NinePatchAxisMode p_x_axis_mode, RS::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_NULL(style);
@@ -1677,6 +1740,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(prim);
@@ -1703,6 +1767,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -1724,6 +1789,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
@@ -1745,6 +1811,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_NULL(tr);
@@ -1754,6 +1821,7 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, const Transform2D &p_transform, const Color &p_modulate, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 	ERR_FAIL_COND(!p_mesh.is_valid());
 
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
@@ -1773,6 +1841,7 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_NULL(part);
@@ -1787,6 +1856,7 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_NULL(mm);
@@ -1798,6 +1868,7 @@ void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
 void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>();
 	ERR_FAIL_NULL(ci);
@@ -1807,6 +1878,7 @@ void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore)
 void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_animation_length, double p_slice_begin, double p_slice_end, double p_offset) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	Item::CommandAnimationSlice *as = canvas_item->alloc_command<Item::CommandAnimationSlice>();
 	ERR_FAIL_NULL(as);
@@ -1819,6 +1891,7 @@ void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_an
 void RendererCanvasCull::canvas_item_set_sort_children_by_y(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->sort_y = p_enable;
 
@@ -1830,6 +1903,7 @@ void RendererCanvasCull::canvas_item_set_z_index(RID p_item, int p_z) {
 
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->z_index = p_z;
 }
@@ -1837,6 +1911,7 @@ void RendererCanvasCull::canvas_item_set_z_index(RID p_item, int p_z) {
 void RendererCanvasCull::canvas_item_set_z_as_relative_to_parent(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->z_relative = p_enable;
 }
@@ -1844,6 +1919,7 @@ void RendererCanvasCull::canvas_item_set_z_as_relative_to_parent(RID p_item, boo
 void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 	if (canvas_item->skeleton == p_skeleton) {
 		return;
 	}
@@ -1873,6 +1949,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_enable, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 	if (p_enable && (canvas_item->copy_back_buffer == nullptr)) {
 		canvas_item->copy_back_buffer = memnew(RendererCanvasRender::Item::CopyBackBuffer);
 	}
@@ -1890,6 +1967,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->clear();
 
@@ -1903,6 +1981,7 @@ void RendererCanvasCull::canvas_item_clear(RID p_item) {
 void RendererCanvasCull::canvas_item_set_draw_index(RID p_item, int p_index) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->index = p_index;
 
@@ -1922,6 +2001,7 @@ void RendererCanvasCull::canvas_item_set_draw_index(RID p_item, int p_index) {
 void RendererCanvasCull::canvas_item_set_material(RID p_item, RID p_material) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->material = p_material;
 	_item_queue_update(canvas_item, true);
@@ -1930,6 +2010,7 @@ void RendererCanvasCull::canvas_item_set_material(RID p_item, RID p_material) {
 void RendererCanvasCull::canvas_item_set_use_parent_material(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	canvas_item->use_parent_material = p_enable;
 	_item_queue_update(canvas_item, true);
@@ -1938,6 +2019,7 @@ void RendererCanvasCull::canvas_item_set_use_parent_material(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_set_instance_shader_parameter(RID p_item, const StringName &p_parameter, const Variant &p_value) {
 	Item *item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(item);
+	_item_changed(item);
 
 	item->instance_uniforms.set(item->self, p_parameter, p_value);
 }
@@ -1983,6 +2065,9 @@ void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_
 			canvas_item->visibility_notifier = nullptr;
 		}
 	}
+
+	// Notifiers are only updated while culling, so make sure the item's viewports are drawn again.
+	_item_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_debug_redraw(bool p_enabled) {
@@ -2003,6 +2088,7 @@ void RendererCanvasCull::canvas_item_set_interpolated(RID p_item, bool p_interpo
 void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 	canvas_item->xform_prev = canvas_item->xform_curr;
 }
 
@@ -2010,6 +2096,7 @@ void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 	canvas_item->xform_prev = p_transform * canvas_item->xform_prev;
 	canvas_item->xform_curr = p_transform * canvas_item->xform_curr;
 }
@@ -2017,6 +2104,7 @@ void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item,
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_changed(canvas_item);
 
 	if (p_mode == RS::CANVAS_GROUP_MODE_DISABLED) {
 		if (canvas_item->canvas_group != nullptr) {
@@ -2045,6 +2133,8 @@ void RendererCanvasCull::canvas_light_initialize(RID p_rid) {
 }
 
 void RendererCanvasCull::canvas_light_set_mode(RID p_light, RS::CanvasLightMode p_mode) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2066,6 +2156,8 @@ void RendererCanvasCull::canvas_light_set_mode(RID p_light, RS::CanvasLightMode
 }
 
 void RendererCanvasCull::canvas_light_attach_to_canvas(RID p_light, RID p_canvas) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2095,6 +2187,8 @@ void RendererCanvasCull::canvas_light_attach_to_canvas(RID p_light, RID p_canvas
 }
 
 void RendererCanvasCull::canvas_light_set_enabled(RID p_light, bool p_enabled) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2102,6 +2196,8 @@ void RendererCanvasCull::canvas_light_set_enabled(RID p_light, bool p_enabled) {
 }
 
 void RendererCanvasCull::canvas_light_set_texture_scale(RID p_light, float p_scale) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2109,6 +2205,8 @@ void RendererCanvasCull::canvas_light_set_texture_scale(RID p_light, float p_sca
 }
 
 void RendererCanvasCull::canvas_light_set_transform(RID p_light, const Transform2D &p_transform) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2125,6 +2223,8 @@ void RendererCanvasCull::canvas_light_set_transform(RID p_light, const Transform
 }
 
 void RendererCanvasCull::canvas_light_set_texture(RID p_light, RID p_texture) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2137,6 +2237,8 @@ void RendererCanvasCull::canvas_light_set_texture(RID p_light, RID p_texture) {
 }
 
 void RendererCanvasCull::canvas_light_set_texture_offset(RID p_light, const Vector2 &p_offset) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2144,6 +2246,8 @@ void RendererCanvasCull::canvas_light_set_texture_offset(RID p_light, const Vect
 }
 
 void RendererCanvasCull::canvas_light_set_color(RID p_light, const Color &p_color) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2151,6 +2255,8 @@ void RendererCanvasCull::canvas_light_set_color(RID p_light, const Color &p_colo
 }
 
 void RendererCanvasCull::canvas_light_set_height(RID p_light, float p_height) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2158,6 +2264,8 @@ void RendererCanvasCull::canvas_light_set_height(RID p_light, float p_height) {
 }
 
 void RendererCanvasCull::canvas_light_set_energy(RID p_light, float p_energy) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2165,6 +2273,8 @@ void RendererCanvasCull::canvas_light_set_energy(RID p_light, float p_energy) {
 }
 
 void RendererCanvasCull::canvas_light_set_z_range(RID p_light, int p_min_z, int p_max_z) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2173,6 +2283,8 @@ void RendererCanvasCull::canvas_light_set_z_range(RID p_light, int p_min_z, int
 }
 
 void RendererCanvasCull::canvas_light_set_layer_range(RID p_light, int p_min_layer, int p_max_layer) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2181,6 +2293,8 @@ void RendererCanvasCull::canvas_light_set_layer_range(RID p_light, int p_min_lay
 }
 
 void RendererCanvasCull::canvas_light_set_item_cull_mask(RID p_light, int p_mask) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2188,6 +2302,8 @@ void RendererCanvasCull::canvas_light_set_item_cull_mask(RID p_light, int p_mask
 }
 
 void RendererCanvasCull::canvas_light_set_item_shadow_cull_mask(RID p_light, int p_mask) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2195,6 +2311,8 @@ void RendererCanvasCull::canvas_light_set_item_shadow_cull_mask(RID p_light, int
 }
 
 void RendererCanvasCull::canvas_light_set_directional_distance(RID p_light, float p_distance) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2202,6 +2320,8 @@ void RendererCanvasCull::canvas_light_set_directional_distance(RID p_light, floa
 }
 
 void RendererCanvasCull::canvas_light_set_blend_mode(RID p_light, RS::CanvasLightBlendMode p_mode) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2209,6 +2329,8 @@ void RendererCanvasCull::canvas_light_set_blend_mode(RID p_light, RS::CanvasLigh
 }
 
 void RendererCanvasCull::canvas_light_set_shadow_enabled(RID p_light, bool p_enabled) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2221,6 +2343,8 @@ void RendererCanvasCull::canvas_light_set_shadow_enabled(RID p_light, bool p_ena
 }
 
 void RendererCanvasCull::canvas_light_set_shadow_filter(RID p_light, RS::CanvasLightShadowFilter p_filter) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2228,6 +2352,8 @@ void RendererCanvasCull::canvas_light_set_shadow_filter(RID p_light, RS::CanvasL
 }
 
 void RendererCanvasCull::canvas_light_set_shadow_color(RID p_light, const Color &p_color) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 
@@ -2235,6 +2361,8 @@ void RendererCanvasCull::canvas_light_set_shadow_color(RID p_light, const Color
 }
 
 void RendererCanvasCull::canvas_light_set_shadow_smooth(RID p_light, float p_smooth) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 	clight->shadow_smooth = p_smooth;
@@ -2247,12 +2375,16 @@ void RendererCanvasCull::canvas_light_set_interpolated(RID p_light, bool p_inter
 }
 
 void RendererCanvasCull::canvas_light_reset_physics_interpolation(RID p_light) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 	clight->xform_prev = clight->xform_curr;
 }
 
 void RendererCanvasCull::canvas_light_transform_physics_interpolation(RID p_light, const Transform2D &p_transform) {
+	_global_changed();
+
 	RendererCanvasRender::Light *clight = canvas_light_owner.get_or_null(p_light);
 	ERR_FAIL_NULL(clight);
 	clight->xform_prev = p_transform * clight->xform_prev;
@@ -2267,6 +2399,8 @@ void RendererCanvasCull::canvas_light_occluder_initialize(RID p_rid) {
 }
 
 void RendererCanvasCull::canvas_light_occluder_attach_to_canvas(RID p_occluder, RID p_canvas) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 
@@ -2288,6 +2422,8 @@ void RendererCanvasCull::canvas_light_occluder_attach_to_canvas(RID p_occluder,
 }
 
 void RendererCanvasCull::canvas_light_occluder_set_enabled(RID p_occluder, bool p_enabled) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 
@@ -2295,6 +2431,8 @@ void RendererCanvasCull::canvas_light_occluder_set_enabled(RID p_occluder, bool
 }
 
 void RendererCanvasCull::canvas_light_occluder_set_polygon(RID p_occluder, RID p_polygon) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 
@@ -2323,6 +2461,8 @@ void RendererCanvasCull::canvas_light_occluder_set_polygon(RID p_occluder, RID p
 }
 
 void RendererCanvasCull::canvas_light_occluder_set_as_sdf_collision(RID p_occluder, bool p_enable) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 
@@ -2330,6 +2470,8 @@ void RendererCanvasCull::canvas_light_occluder_set_as_sdf_collision(RID p_occlud
 }
 
 void RendererCanvasCull::canvas_light_occluder_set_transform(RID p_occluder, const Transform2D &p_xform) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 
@@ -2346,6 +2488,8 @@ void RendererCanvasCull::canvas_light_occluder_set_transform(RID p_occluder, con
 }
 
 void RendererCanvasCull::canvas_light_occluder_set_light_mask(RID p_occluder, int p_mask) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 
@@ -2359,12 +2503,16 @@ void RendererCanvasCull::canvas_light_occluder_set_interpolated(RID p_occluder,
 }
 
 void RendererCanvasCull::canvas_light_occluder_reset_physics_interpolation(RID p_occluder) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 	occluder->xform_prev = occluder->xform_curr;
 }
 
 void RendererCanvasCull::canvas_light_occluder_transform_physics_interpolation(RID p_occluder, const Transform2D &p_transform) {
+	_global_changed();
+
 	RendererCanvasRender::LightOccluderInstance *occluder = canvas_light_occluder_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(occluder);
 	occluder->xform_prev = p_transform * occluder->xform_prev;
@@ -2381,6 +2529,8 @@ void RendererCanvasCull::canvas_occluder_polygon_initialize(RID p_rid) {
 }
 
 void RendererCanvasCull::canvas_occluder_polygon_set_shape(RID p_occluder_polygon, const Vector<Vector2> &p_shape, bool p_closed) {
+	_global_changed();
+
 	LightOccluderPolygon *occluder_poly = canvas_light_occluder_polygon_owner.get_or_null(p_occluder_polygon);
 	ERR_FAIL_NULL(occluder_poly);
 
@@ -2405,6 +2555,8 @@ void RendererCanvasCull::canvas_occluder_polygon_set_shape(RID p_occluder_polygo
 }
 
 void RendererCanvasCull::canvas_occluder_polygon_set_cull_mode(RID p_occluder_polygon, RS::CanvasOccluderPolygonCullMode p_mode) {
+	_global_changed();
+
 	LightOccluderPolygon *occluder_poly = canvas_light_occluder_polygon_owner.get_or_null(p_occluder_polygon);
 	ERR_FAIL_NULL(occluder_poly);
 	occluder_poly->cull_mode = p_mode;
@@ -2415,6 +2567,8 @@ void RendererCanvasCull::canvas_occluder_polygon_set_cull_mode(RID p_occluder_po
 }
 
 void RendererCanvasCull::canvas_set_shadow_texture_size(int p_size) {
+	_global_changed();
+
 	RSG::canvas_render->set_shadow_texture_size(p_size);
 }
 
@@ -2426,29 +2580,39 @@ void RendererCanvasCull::canvas_texture_initialize(RID p_rid) {
 }
 
 void RendererCanvasCull::canvas_texture_set_channel(RID p_canvas_texture, RS::CanvasTextureChannel p_channel, RID p_texture) {
+	_global_changed();
+
 	RSG::texture_storage->canvas_texture_set_channel(p_canvas_texture, p_channel, p_texture);
 }
 
 void RendererCanvasCull::canvas_texture_set_shading_parameters(RID p_canvas_texture, const Color &p_base_color, float p_shininess) {
+	_global_changed();
+
 	RSG::texture_storage->canvas_texture_set_shading_parameters(p_canvas_texture, p_base_color, p_shininess);
 }
 
 void RendererCanvasCull::canvas_texture_set_texture_filter(RID p_canvas_texture, RS::CanvasItemTextureFilter p_filter) {
+	_global_changed();
+
 	RSG::texture_storage->canvas_texture_set_texture_filter(p_canvas_texture, p_filter);
 }
 
 void RendererCanvasCull::canvas_texture_set_texture_repeat(RID p_canvas_texture, RS::CanvasItemTextureRepeat p_repeat) {
+	_global_changed();
+
 	RSG::texture_storage->canvas_texture_set_texture_repeat(p_canvas_texture, p_repeat);
 }
 
 void RendererCanvasCull::canvas_item_set_default_texture_filter(RID p_item, RS::CanvasItemTextureFilter p_filter) {
 	Item *ci = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(ci);
+	_item_changed(ci);
 	ci->texture_filter = p_filter;
 }
 void RendererCanvasCull::canvas_item_set_default_texture_repeat(RID p_item, RS::CanvasItemTextureRepeat p_repeat) {
 	Item *ci = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(ci);
+	_item_changed(ci);
 	ci->texture_repeat = p_repeat;
 }
 
@@ -2492,6 +2656,21 @@ Rect2 RendererCanvasCull::_debug_canvas_item_get_rect(RID p_item) {
 	return canvas_item->get_rect();
 }
 
+void RendererCanvasCull::keep_visibility_notifiers_visible(const LocalVector<const Canvas *> &p_canvases) {
+	// Called with the canvases of viewports that skipped rendering because those canvases didn't change.
+	// Notifiers seen in them on the previous frame are still on screen, so don't report them as exiting.
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+
+	SelfList<Item::VisibilityNotifierData> *E = visibility_notifier_list.first();
+	while (E) {
+		Item::VisibilityNotifierData *visibility_notifier = E->self();
+		if (visibility_notifier->visible_in_frame + 1 == frame && p_canvases.has(static_cast<const Canvas *>(visibility_notifier->canvas))) {
+			visibility_notifier->visible_in_frame = frame;
+		}
+		E = E->next();
+	}
+}
+
 void RendererCanvasCull::_item_queue_update(Item *p_item, bool p_update_dependencies) {
 	if (p_update_dependencies) {
 		p_item->update_dependencies = true;
@@ -2543,6 +2722,7 @@ void RendererCanvasCull::_update_dirty_item(Item *p_item) {
 	}
 	_item_update_list.remove(&p_item->update_item);
 	p_item->update_dependencies = false;
+	_item_changed(p_item);
 }
 
 void RendererCanvasCull::update() {
@@ -2583,6 +2763,7 @@ bool RendererCanvasCull::free(RID p_rid) {
 		Item *canvas_item = canvas_item_owner.get_or_null(p_rid);
 		ERR_FAIL_NULL_V(canvas_item, true);
 		_interpolation_data.notify_free_canvas_item(p_rid, *canvas_item);
+		_item_changed(canvas_item);
 
 		if (canvas_item->parent.is_valid()) {
 			if (canvas_owner.owns(canvas_item->parent)) {
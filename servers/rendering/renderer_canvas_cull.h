@@ -69,6 +69,7 @@ public:
 			Callable exit_callable;
 			bool just_visible = false;
 			uint64_t visible_in_frame = 0;
+			const void *canvas = nullptr; // Canvas the notifier was last seen in.
 			SelfList<VisibilityNotifierData> visible_element;
 			VisibilityNotifierData() :
 					visible_element(this) {
@@ -163,6 +164,9 @@ public:
 		RID parent;
 		float parent_scale;
 
+		// Value of RendererCanvasCull::changed_version when anything in this canvas last changed.
+		uint64_t changed_version = 0;
+
 		int find_item(Item *p_item) {
 			for (int i = 0; i < child_items.size(); i++) {
 				if (child_items[i].item == p_item) {
@@ -200,6 +204,33 @@ public:
 	double debug_redraw_time = 0;
 	Color debug_redraw_color;
 
+	// Change tracking for viewports that only redraw when their canvases changed.
+	// Only maintained while at least one viewport uses it, so regular viewports don't pay for it.
+	uint32_t dirty_tracking_viewport_count = 0;
+	uint64_t changed_version = 1;
+	uint64_t global_changed_version = 1; // Lights, occluders and canvas textures, which may affect any canvas.
+	bool item_requested_redraw = false; // Set when a visible item asked to be redrawn every frame (update_when_visible).
+
+	void _mark_item_canvas_changed(Item *p_item);
+
+	_FORCE_INLINE_ void _item_changed(Item *p_item) {
+		if (unlikely(dirty_tracking_viewport_count > 0)) {
+			_mark_item_canvas_changed(p_item);
+		}
+	}
+
+	_FORCE_INLINE_ void _canvas_changed(Canvas *p_canvas) {
+		if (unlikely(dirty_tracking_viewport_count > 0)) {
+			p_canvas->changed_version = ++changed_version;
+		}
+	}
+
+	_FORCE_INLINE_ void _global_changed() {
+		if (unlikely(dirty_tracking_viewport_count > 0)) {
+			global_changed_version = ++changed_version;
+		}
+	}
+
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
 
@@ -219,12 +250,21 @@ private:
 	RendererCanvasRender::Item **z_last_list;
 
 	Transform2D _current_camera_transform;
+	const Canvas *_current_canvas = nullptr;
 
 public:
 	void render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
 	bool was_sdf_used();
 
+	void dirty_tracking_viewport_add() { dirty_tracking_viewport_count++; }
+	void dirty_tracking_viewport_remove() {
+		ERR_FAIL_COND(dirty_tracking_viewport_count == 0);
+		dirty_tracking_viewport_count--;
+	}
+	uint64_t get_changed_version() const { return changed_version; }
+	bool canvas_changed_since(const Canvas *p_canvas, uint64_t p_version) const;
+
 	RID canvas_allocate();
 	void canvas_initialize(RID p_rid);
 
@@ -374,6 +414,7 @@ public:
 	void canvas_item_set_default_texture_repeat(RID p_item, RS::CanvasItemTextureRepeat p_repeat);
 
 	void update_visibility_notifiers();
+	void keep_visibility_notifiers_visible(const LocalVector<const Canvas *> &p_canvases);
 	void update_dirty_items();
 
 	void _update_dirty_item(Item *p_item);
@@ -726,6 +726,35 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 	}
 }
 
+bool RendererViewport::_viewport_needs_redraw(Viewport *p_viewport) const {
+	if (!p_viewport->canvas_dirty_tracking || p_viewport->canvas_dirty || p_viewport->canvas_redraw_requested) {
+		return true;
+	}
+
+	if (p_viewport->update_mode == RS::VIEWPORT_UPDATE_ONCE || p_viewport->measure_render_time) {
+		return true;
+	}
+
+	if (p_viewport->viewport_render_direct_to_screen && RSG::rasterizer->is_low_end()) {
+		// Nothing is kept between frames when rendering straight to the window.
+		return true;
+	}
+
+	if (RSG::scene->is_camera(p_viewport->camera) && !p_viewport->disable_3d) {
+		// Only 2D content is tracked.
+		return true;
+	}
+
+	for (const KeyValue<RID, Viewport::CanvasData> &E : p_viewport->canvas_map) {
+		const RendererCanvasCull::Canvas *canvas = static_cast<const RendererCanvasCull::Canvas *>(E.value.canvas);
+		if (RSG::canvas->canvas_changed_since(canvas, p_viewport->canvas_drawn_version)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	timestamp_vp_map.clear();
 
@@ -817,6 +846,10 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	int objects_drawn = 0;
 	int draw_calls_used = 0;
 
+	// Once any viewport has been drawn, viewports after it may be sampling its texture and can't be skipped.
+	bool viewport_drawn = false;
+	LocalVector<const RendererCanvasCull::Canvas *> skipped_canvases;
+
 	for (int i = 0; i < sorted_active_viewports.size(); i++) {
 		Viewport *vp = sorted_active_viewports[i];
 
@@ -855,6 +888,7 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 
 				// and draw viewport
 				_draw_viewport(vp);
+				viewport_drawn = true;
 
 				// commit our eyes
 				Vector<BlitToScreen> blits = xr_interface->post_draw_viewport(vp->render_target, vp->viewport_to_screen_rect);
@@ -881,7 +915,29 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 			RSG::scene->set_debug_draw_mode(vp->debug_draw);
 
 			// render standard mono camera
-			_draw_viewport(vp);
+			if (viewport_drawn || _viewport_needs_redraw(vp)) {
+				RSG::canvas->item_requested_redraw = false;
+
+				_draw_viewport(vp);
+				viewport_drawn = true;
+
+				vp->canvas_dirty = false;
+				vp->canvas_redraw_requested = RSG::canvas->item_requested_redraw;
+				vp->canvas_drawn_version = RSG::canvas->get_changed_version();
+			} else {
+				// Nothing this viewport shows has changed, keep the previous contents of the render target.
+				for (int j = 0; j < RS::VIEWPORT_RENDER_INFO_TYPE_MAX; j++) {
+					for (int k = 0; k < RS::VIEWPORT_RENDER_INFO_MAX; k++) {
+						vp->render_info.info[j][k] = 0;
+					}
+				}
+				for (const KeyValue<RID, Viewport::CanvasData> &E : vp->canvas_map) {
+					const RendererCanvasCull::Canvas *canvas = static_cast<const RendererCanvasCull::Canvas *>(E.value.canvas);
+					if (!skipped_canvases.has(canvas)) {
+						skipped_canvases.push_back(canvas);
+					}
+				}
+			}
 
 			if (vp->viewport_to_screen != DisplayServer::INVALID_WINDOW_ID && (!vp->viewport_render_direct_to_screen || !RSG::rasterizer->is_low_end())) {
 				//copy to screen if set as such
@@ -924,6 +980,10 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	}
 	RSG::scene->set_debug_draw_mode(RS::VIEWPORT_DEBUG_DRAW_DISABLED);
 
+	if (!skipped_canvases.is_empty()) {
+		RSG::canvas->keep_visibility_notifiers_visible(skipped_canvases);
+	}
+
 	total_objects_drawn = objects_drawn;
 	total_vertices_drawn = vertices_drawn;
 	total_draw_calls_used = draw_calls_used;
@@ -1050,6 +1110,7 @@ void RendererViewport::_viewport_set_size(Viewport *p_viewport, int p_width, int
 		_configure_3d_render_buffers(p_viewport);
 
 		p_viewport->occlusion_buffer_dirty = true;
+		p_viewport->canvas_dirty = true;
 	}
 }
 
@@ -1062,6 +1123,7 @@ bool RendererViewport::_viewport_requires_motion_vectors(Viewport *p_viewport) {
 void RendererViewport::viewport_set_active(RID p_viewport, bool p_active) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (p_active) {
 		ERR_FAIL_COND_MSG(active_viewports.has(viewport), "Can't make active a Viewport that is already active.");
@@ -1084,6 +1146,7 @@ void RendererViewport::viewport_set_parent_viewport(RID p_viewport, RID p_parent
 void RendererViewport::viewport_set_clear_mode(RID p_viewport, RS::ViewportClearMode p_clear_mode) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->clear_mode = p_clear_mode;
 }
@@ -1091,6 +1154,7 @@ void RendererViewport::viewport_set_clear_mode(RID p_viewport, RS::ViewportClear
 void RendererViewport::viewport_attach_to_screen(RID p_viewport, const Rect2 &p_rect, DisplayServer::WindowID p_screen) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (p_screen != DisplayServer::INVALID_WINDOW_ID) {
 		// If using OpenGL we can optimize this operation by rendering directly to system_fbo
@@ -1117,6 +1181,7 @@ void RendererViewport::viewport_attach_to_screen(RID p_viewport, const Rect2 &p_
 void RendererViewport::viewport_set_render_direct_to_screen(RID p_viewport, bool p_enable) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (p_enable == viewport->viewport_render_direct_to_screen) {
 		return;
@@ -1141,6 +1206,7 @@ void RendererViewport::viewport_set_render_direct_to_screen(RID p_viewport, bool
 void RendererViewport::viewport_set_update_mode(RID p_viewport, RS::ViewportUpdateMode p_mode) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->update_mode = p_mode;
 }
@@ -1195,6 +1261,7 @@ const RendererSceneRender::CameraData *RendererViewport::viewport_get_prev_camer
 void RendererViewport::viewport_set_disable_2d(RID p_viewport, bool p_disable) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->disable_2d = p_disable;
 }
@@ -1202,6 +1269,7 @@ void RendererViewport::viewport_set_disable_2d(RID p_viewport, bool p_disable) {
 void RendererViewport::viewport_set_environment_mode(RID p_viewport, RS::ViewportEnvironmentMode p_mode) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->disable_environment = p_mode;
 }
@@ -1219,6 +1287,7 @@ bool RendererViewport::viewport_is_environment_disabled(Viewport *viewport) {
 void RendererViewport::viewport_set_disable_3d(RID p_viewport, bool p_disable) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->disable_3d = p_disable;
 }
@@ -1226,6 +1295,7 @@ void RendererViewport::viewport_set_disable_3d(RID p_viewport, bool p_disable) {
 void RendererViewport::viewport_attach_camera(RID p_viewport, RID p_camera) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->camera = p_camera;
 }
@@ -1233,6 +1303,7 @@ void RendererViewport::viewport_attach_camera(RID p_viewport, RID p_camera) {
 void RendererViewport::viewport_set_scenario(RID p_viewport, RID p_scenario) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (viewport->scenario.is_valid()) {
 		RSG::scene->scenario_remove_viewport_visibility_mask(viewport->scenario, p_viewport);
@@ -1247,6 +1318,7 @@ void RendererViewport::viewport_set_scenario(RID p_viewport, RID p_scenario) {
 void RendererViewport::viewport_attach_canvas(RID p_viewport, RID p_canvas) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	ERR_FAIL_COND(viewport->canvas_map.has(p_canvas));
 	RendererCanvasCull::Canvas *canvas = RSG::canvas->canvas_owner.get_or_null(p_canvas);
@@ -1262,6 +1334,7 @@ void RendererViewport::viewport_attach_canvas(RID p_viewport, RID p_canvas) {
 void RendererViewport::viewport_remove_canvas(RID p_viewport, RID p_canvas) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	RendererCanvasCull::Canvas *canvas = RSG::canvas->canvas_owner.get_or_null(p_canvas);
 	ERR_FAIL_NULL(canvas);
@@ -1273,6 +1346,7 @@ void RendererViewport::viewport_remove_canvas(RID p_viewport, RID p_canvas) {
 void RendererViewport::viewport_set_canvas_transform(RID p_viewport, RID p_canvas, const Transform2D &p_offset) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	ERR_FAIL_COND(!viewport->canvas_map.has(p_canvas));
 	viewport->canvas_map[p_canvas].transform = p_offset;
@@ -1281,6 +1355,7 @@ void RendererViewport::viewport_set_canvas_transform(RID p_viewport, RID p_canva
 void RendererViewport::viewport_set_transparent_background(RID p_viewport, bool p_enabled) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 	if (viewport->transparent_bg == p_enabled) {
 		return;
 	}
@@ -1292,6 +1367,7 @@ void RendererViewport::viewport_set_transparent_background(RID p_viewport, bool
 void RendererViewport::viewport_set_global_canvas_transform(RID p_viewport, const Transform2D &p_transform) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->global_transform = p_transform;
 }
@@ -1299,6 +1375,7 @@ void RendererViewport::viewport_set_global_canvas_transform(RID p_viewport, cons
 void RendererViewport::viewport_set_canvas_stacking(RID p_viewport, RID p_canvas, int p_layer, int p_sublayer) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	ERR_FAIL_COND(!viewport->canvas_map.has(p_canvas));
 	viewport->canvas_map[p_canvas].layer = p_layer;
@@ -1325,6 +1402,7 @@ void RendererViewport::viewport_set_positional_shadow_atlas_quadrant_subdivision
 void RendererViewport::viewport_set_msaa_2d(RID p_viewport, RS::ViewportMSAA p_msaa) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (viewport->msaa_2d == p_msaa) {
 		return;
@@ -1347,6 +1425,7 @@ void RendererViewport::viewport_set_msaa_3d(RID p_viewport, RS::ViewportMSAA p_m
 void RendererViewport::viewport_set_use_hdr_2d(RID p_viewport, bool p_use_hdr_2d) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (viewport->use_hdr_2d == p_use_hdr_2d) {
 		return;
@@ -1365,6 +1444,7 @@ bool RendererViewport::viewport_is_using_hdr_2d(RID p_viewport) const {
 void RendererViewport::viewport_set_screen_space_aa(RID p_viewport, RS::ViewportScreenSpaceAA p_mode) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (viewport->screen_space_aa == p_mode) {
 		return;
@@ -1396,6 +1476,7 @@ void RendererViewport::viewport_set_use_taa(RID p_viewport, bool p_use_taa) {
 void RendererViewport::viewport_set_use_debanding(RID p_viewport, bool p_use_debanding) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	if (viewport->use_debanding == p_use_debanding) {
 		return;
@@ -1484,6 +1565,7 @@ int RendererViewport::viewport_get_render_info(RID p_viewport, RS::ViewportRende
 void RendererViewport::viewport_set_debug_draw(RID p_viewport, RS::ViewportDebugDraw p_draw) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	bool motion_vectors_before = _viewport_requires_motion_vectors(viewport);
 	viewport->debug_draw = p_draw;
@@ -1518,12 +1600,14 @@ float RendererViewport::viewport_get_measured_render_time_gpu(RID p_viewport) co
 void RendererViewport::viewport_set_snap_2d_transforms_to_pixel(RID p_viewport, bool p_enabled) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 	viewport->snap_2d_transforms_to_pixel = p_enabled;
 }
 
 void RendererViewport::viewport_set_snap_2d_vertices_to_pixel(RID p_viewport, bool p_enabled) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 	viewport->snap_2d_vertices_to_pixel = p_enabled;
 }
 
@@ -1531,6 +1615,7 @@ void RendererViewport::viewport_set_default_canvas_item_texture_filter(RID p_vie
 	ERR_FAIL_COND_MSG(p_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT, "Viewport does not accept DEFAULT as texture filter (it's the topmost choice already).)");
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->texture_filter = p_filter;
 }
@@ -1538,6 +1623,7 @@ void RendererViewport::viewport_set_default_canvas_item_texture_repeat(RID p_vie
 	ERR_FAIL_COND_MSG(p_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT, "Viewport does not accept DEFAULT as texture repeat (it's the topmost choice already).)");
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	viewport->texture_repeat = p_repeat;
 }
@@ -1545,6 +1631,7 @@ void RendererViewport::viewport_set_default_canvas_item_texture_repeat(RID p_vie
 void RendererViewport::viewport_set_sdf_oversize_and_scale(RID p_viewport, RS::ViewportSDFOversize p_size, RS::ViewportSDFScale p_scale) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 
 	RSG::texture_storage->render_target_set_sdf_size_and_scale(viewport->render_target, p_size, p_scale);
 }
@@ -1612,6 +1699,10 @@ bool RendererViewport::free(RID p_rid) {
 			num_viewports_with_motion_vectors--;
 		}
 
+		if (viewport->canvas_dirty_tracking) {
+			RSG::canvas->dirty_tracking_viewport_remove();
+		}
+
 		viewport_owner.free(p_rid);
 
 		return true;
@@ -1645,9 +1736,27 @@ void RendererViewport::handle_timestamp(String p_timestamp, uint64_t p_cpu_time,
 void RendererViewport::viewport_set_canvas_cull_mask(RID p_viewport, uint32_t p_canvas_cull_mask) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
+	viewport->canvas_dirty = true;
 	viewport->canvas_cull_mask = p_canvas_cull_mask;
 }
 
+void RendererViewport::viewport_set_canvas_dirty_tracking(RID p_viewport, bool p_enabled) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+	if (viewport->canvas_dirty_tracking == p_enabled) {
+		return;
+	}
+
+	if (p_enabled) {
+		RSG::canvas->dirty_tracking_viewport_add();
+	} else {
+		RSG::canvas->dirty_tracking_viewport_remove();
+	}
+
+	viewport->canvas_dirty_tracking = p_enabled;
+	viewport->canvas_dirty = true;
+}
+
 // Workaround for setting this on thread.
 void RendererViewport::call_set_vsync_mode(DisplayServer::VSyncMode p_mode, DisplayServer::WindowID p_window) {
 	DisplayServer::get_singleton()->window_set_vsync_mode(p_mode, p_window);
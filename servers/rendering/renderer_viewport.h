@@ -121,6 +121,12 @@ public:
 
 		uint32_t canvas_cull_mask = 0xffffffff;
 
+		// When enabled, 2D-only viewports skip rendering while none of their canvases changed.
+		bool canvas_dirty_tracking = false;
+		bool canvas_dirty = true;
+		bool canvas_redraw_requested = false;
+		uint64_t canvas_drawn_version = 0;
+
 		struct CanvasKey {
 			int64_t stacking;
 			RID canvas;
@@ -209,6 +215,7 @@ private:
 	void _configure_3d_render_buffers(Viewport *p_viewport);
 	void _draw_3d(Viewport *p_viewport);
 	void _draw_viewport(Viewport *p_viewport);
+	bool _viewport_needs_redraw(Viewport *p_viewport) const;
 
 	int occlusion_rays_per_thread = 512;
 
@@ -267,6 +274,7 @@ public:
 	void viewport_set_canvas_stacking(RID p_viewport, RID p_canvas, int p_layer, int p_sublayer);
 
 	void viewport_set_canvas_cull_mask(RID p_viewport, uint32_t p_canvas_cull_mask);
+	void viewport_set_canvas_dirty_tracking(RID p_viewport, bool p_enabled);
 
 	void viewport_set_positional_shadow_atlas_size(RID p_viewport, int p_size, bool p_16_bits = true);
 	void viewport_set_positional_shadow_atlas_quadrant_subdivision(RID p_viewport, int p_quadrant, int p_subdiv);
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
 
 #include "tests/test_macros.h"
 
@@ -214,6 +215,145 @@ TEST_CASE("[AStar3D] Add/Remove") {
 	// It's been great work, cheers. \(^ ^)/
 }
 
+TEST_CASE("[AStar3D] Frozen graph") {
+	ABCX abcx;
+	abcx.freeze();
+	CHECK(abcx.is_frozen());
+
+	// Connection costs are taken from the overridden `_compute_cost()`.
+	Vector<int64_t> path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 4);
+	CHECK(path[0] == ABCX::X);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::B);
+	CHECK(path[3] == ABCX::C);
+
+	// Disabling points keeps the graph frozen.
+	abcx.set_point_disabled(ABCX::B);
+	CHECK(abcx.is_frozen());
+	path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::C);
+
+	// Partial paths end at the closest reachable point.
+	abcx.set_point_disabled(ABCX::C);
+	CHECK(abcx.get_id_path(ABCX::X, ABCX::C).is_empty());
+	path = abcx.get_id_path(ABCX::X, ABCX::C, true);
+	REQUIRE(path.size() == 2);
+	CHECK(path[1] == ABCX::A);
+
+	// Changing the connections unfreezes the graph.
+	abcx.set_point_disabled(ABCX::B, false);
+	abcx.set_point_disabled(ABCX::C, false);
+	abcx.disconnect_points(ABCX::A, ABCX::B);
+	CHECK_FALSE(abcx.is_frozen());
+	path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::C);
+}
+
+TEST_CASE("[AStar3D] Frozen graph paths match unfrozen paths") {
+	constexpr int N = 50;
+	Math::seed(1);
+
+	AStar3D a;
+	for (int u = 0; u < N; u++) {
+		a.add_point(u, Vector3(Math::rand() % 100, Math::rand() % 100, Math::rand() % 100), 1.0 + (Math::rand() % 3));
+	}
+	for (int i = 0; i < N * 3; i++) {
+		int u = Math::rand() % N;
+		int v = Math::rand() % N;
+		if (u != v) {
+			a.connect_points(u, v, Math::rand() % 2);
+		}
+	}
+
+	// Paths of the same cost may differ on ties, so compare the costs.
+	auto get_path_cost = [&a](const Vector<int64_t> &p_path) -> real_t {
+		if (p_path.is_empty()) {
+			return -1.0;
+		}
+		real_t cost = 0.0;
+		for (int i = 1; i < p_path.size(); i++) {
+			cost += a.get_point_position(p_path[i - 1]).distance_to(a.get_point_position(p_path[i])) * a.get_point_weight_scale(p_path[i]);
+		}
+		return cost;
+	};
+
+	LocalVector<real_t> unfrozen_costs;
+	for (int u = 0; u < N; u++) {
+		for (int v = 0; v < N; v++) {
+			unfrozen_costs.push_back(get_path_cost(a.get_id_path(u, v)));
+		}
+	}
+
+	a.freeze();
+	bool match = true;
+	for (int u = 0; u < N; u++) {
+		for (int v = 0; v < N; v++) {
+			if (!Math::is_equal_approx(get_path_cost(a.get_id_path(u, v)), unfrozen_costs[u * N + v])) {
+				match = false;
+			}
+		}
+	}
+	CHECK_MESSAGE(match, "Frozen and unfrozen graphs find the same paths.");
+}
+
+TEST_CASE("[AStarGrid2D] Jumping and chunked grids reach the same points") {
+	constexpr int SIZE = 24;
+	Math::seed(2);
+
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_size(Vector2i(SIZE, SIZE));
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES);
+	grid->update();
+	for (int i = 0; i < SIZE * SIZE / 4; i++) {
+		grid->set_point_solid(Vector2i(Math::rand() % SIZE, Math::rand() % SIZE));
+	}
+
+	LocalVector<Vector2i> targets;
+	for (int i = 0; i < 16; i++) {
+		targets.push_back(Vector2i(Math::rand() % SIZE, Math::rand() % SIZE));
+		grid->set_point_solid(targets[i], false);
+	}
+
+	LocalVector<bool> reachable;
+	for (const Vector2i &from : targets) {
+		for (const Vector2i &to : targets) {
+			reachable.push_back(!grid->get_id_path(from, to).is_empty());
+		}
+	}
+
+	auto check_grid = [&]() -> bool {
+		uint32_t index = 0;
+		for (const Vector2i &from : targets) {
+			for (const Vector2i &to : targets) {
+				TypedArray<Vector2i> path = grid->get_id_path(from, to);
+				if (path.is_empty() == reachable[index++]) {
+					return false;
+				}
+				if (!path.is_empty() && (Vector2i(path[0]) != from || Vector2i(path[path.size() - 1]) != to)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	};
+
+	grid->set_chunk_size(4);
+	CHECK_MESSAGE(check_grid(), "Chunked grid reaches the same points.");
+
+	grid->set_chunk_size(0);
+	grid->set_jumping_enabled(true);
+	CHECK_MESSAGE(check_grid(), "Jumping grid reaches the same points.");
+
+	grid->set_chunk_size(5);
+	CHECK_MESSAGE(check_grid(), "Jumping and chunked grid reaches the same points.");
+}
+
 TEST_CASE("[Stress][AStar3D] Find paths") {
 	// Random stress tests with Floyd-Warshall.
 	constexpr int N = 30;
@@ -95,4 +95,25 @@ TEST_CASE("[LRU] Resize and clear") {
 	CHECK(!lru.has(3));
 	CHECK(!lru.has(4));
 }
+
+TEST_CASE("[LRU] Evict oldest") {
+	LRUCache<int, int> lru;
+
+	lru.insert(1, 1);
+	lru.insert(2, 2);
+	lru.insert(3, 3);
+	lru.get(1); // <2> is now the least recently used.
+
+	CHECK(lru.evict_oldest());
+	CHECK(!lru.has(2));
+	CHECK(lru.has(1));
+	CHECK(lru.has(3));
+
+	CHECK(lru.evict_oldest());
+	CHECK(!lru.has(3));
+	CHECK(lru.evict_oldest());
+	CHECK(!lru.has(1));
+	CHECK(!lru.evict_oldest());
+	CHECK(lru.get_size() == 0);
+}
 } // namespace TestLRU
@@ -280,6 +280,45 @@ TEST_CASE("[Animation] Create blend shape track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sampling with a key cursor matches sampling without one") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(4.0);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy"));
+	for (int i = 0; i < 40; i++) {
+		animation->position_track_insert_key(track_index, i * 0.1 + (i % 3) * 0.02, Vector3(i, Math::sin(i * 0.7), i % 5));
+	}
+
+	LocalVector<double> times;
+	for (int i = 0; i <= 400; i++) {
+		times.push_back(i * 0.01); // Forward.
+	}
+	for (int i = 400; i >= 0; i--) {
+		times.push_back(i * 0.01); // Backward.
+	}
+	for (int i = 0; i < 100; i++) {
+		times.push_back(Math::fmod(i * 1.37, 4.0)); // Seeking around.
+	}
+
+	auto check_samples = [&]() -> bool {
+		Animation::KeyCursor cursor;
+		for (double time : times) {
+			Vector3 expected;
+			Vector3 sampled;
+			if (animation->try_position_track_interpolate(track_index, time, &expected) != animation->try_position_track_interpolate(track_index, time, &sampled, false, &cursor) || expected != sampled) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	CHECK_MESSAGE(check_samples(), "Sampling with a key cursor returns the same values.");
+
+	animation->compress();
+	REQUIRE(animation->track_is_compressed(track_index));
+	CHECK_MESSAGE(check_samples(), "Sampling a compressed track with a key cursor returns the same values.");
+}
+
 TEST_CASE("[Animation] Create Bezier track") {
 	Ref<Animation> animation = memnew(Animation);
 	const int track_index = animation->add_track(Animation::TYPE_BEZIER);
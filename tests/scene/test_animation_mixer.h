@@ -0,0 +1,310 @@
+/**************************************************************************/
+/*  test_animation_mixer.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#pragma once
+
+#include "tests/test_macros.h"
+
+#include "core/math/random_pcg.h"
+#include "scene/3d/camera_3d.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/animation/animation_blend_tree.h"
+#include "scene/animation/animation_player.h"
+#include "scene/animation/animation_tree.h"
+#include "scene/main/viewport.h"
+#include "scene/main/window.h"
+
+namespace TestAnimationMixer {
+
+static Ref<Animation> create_bone_animation(uint64_t p_seed, int p_key_count, double p_length) {
+	RandomPCG rng(p_seed);
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(p_length);
+	int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Skeleton:bone"));
+	int scale_track = animation->add_track(Animation::TYPE_SCALE_3D);
+	animation->track_set_path(scale_track, NodePath("Skeleton:bone"));
+	for (int i = 0; i < p_key_count; i++) {
+		double time = p_length * i / (p_key_count - 1);
+		animation->position_track_insert_key(position_track, time, Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)));
+		animation->scale_track_insert_key(scale_track, time, Vector3(rng.random(0.5, 1.5), rng.random(0.5, 1.5), rng.random(0.5, 1.5)));
+	}
+	return animation;
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Blended animations on one bone keep separate key cursors") {
+	Node3D *root = memnew(Node3D);
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton");
+	skeleton->add_bone("bone");
+	root->add_child(skeleton);
+
+	// Different key counts so the two animations never share a key index at the same time.
+	Ref<Animation> animation_a = create_bone_animation(1, 41, 2.0);
+	Ref<Animation> animation_b = create_bone_animation(2, 17, 2.0);
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("a", animation_a);
+	library->add_animation("b", animation_b);
+
+	Ref<AnimationNodeBlendTree> blend_tree;
+	blend_tree.instantiate();
+	Ref<AnimationNodeAnimation> node_a;
+	node_a.instantiate();
+	node_a->set_animation("a");
+	Ref<AnimationNodeAnimation> node_b;
+	node_b.instantiate();
+	node_b->set_animation("b");
+	Ref<AnimationNodeBlend2> blend;
+	blend.instantiate();
+	blend_tree->add_node("a", node_a);
+	blend_tree->add_node("b", node_b);
+	blend_tree->add_node("blend", blend);
+	blend_tree->connect_node("blend", 0, "a");
+	blend_tree->connect_node("blend", 1, "b");
+	blend_tree->connect_node("output", 0, "blend");
+
+	AnimationTree *animation_tree = memnew(AnimationTree);
+	animation_tree->set_deterministic(true);
+	animation_tree->set_callback_mode_process(AnimationMixer::ANIMATION_CALLBACK_MODE_PROCESS_MANUAL);
+	animation_tree->add_animation_library("", library);
+	animation_tree->set_root_animation_node(blend_tree);
+	root->add_child(animation_tree);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	animation_tree->set("parameters/blend/blend_amount", 0.5);
+
+	// Uneven steps so the cursors both stay on a key and hop several keys at once.
+	const double steps[] = { 0.013, 0.05, 0.2, 0.007, 0.11, 0.031 };
+	double time = 0.0;
+	animation_tree->advance(0.0);
+	for (int i = 0; time + steps[i % 6] < 1.9; i++) {
+		time += steps[i % 6];
+		animation_tree->advance(steps[i % 6]);
+
+		// The uncached lookups are the reference: equal weights average both animations.
+		Vector3 expected_position = (animation_a->position_track_interpolate(0, time) + animation_b->position_track_interpolate(0, time)) * 0.5;
+		Vector3 expected_scale = (animation_a->scale_track_interpolate(1, time) + animation_b->scale_track_interpolate(1, time)) * 0.5;
+		CHECK(skeleton->get_bone_pose_position(0).is_equal_approx(expected_position));
+		CHECK(skeleton->get_bone_pose_scale(0).is_equal_approx(expected_scale));
+	}
+
+	memdelete(root);
+}
+
+static Ref<Animation> create_target_animation(uint64_t p_seed) {
+	RandomPCG rng(p_seed);
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+	int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Target"));
+	int scale_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(scale_track, NodePath("Target:scale"));
+	animation->value_track_set_update_mode(scale_track, Animation::UPDATE_CONTINUOUS);
+	for (int i = 0; i < 9; i++) {
+		animation->position_track_insert_key(position_track, i * 0.125, Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)));
+		animation->track_insert_key(scale_track, i * 0.125, Vector3(rng.random(0.5, 1.5), rng.random(0.5, 1.5), rng.random(0.5, 1.5)));
+	}
+	return animation;
+}
+
+// A Node3D "Target" animated by a sibling AnimationPlayer, both under the returned node.
+static Node3D *create_animated_target(const Ref<Animation> &p_animation, bool p_independent, AnimationPlayer **r_player, Node3D **r_target) {
+	Node3D *character = memnew(Node3D);
+	Node3D *target = memnew(Node3D);
+	target->set_name("Target");
+	target->set_position(Vector3(100, 100, 100));
+	character->add_child(target);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("anim", p_animation);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->set_independent(p_independent);
+	player->add_animation_library("", library);
+	character->add_child(player);
+
+	*r_player = player;
+	*r_target = target;
+	return character;
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Independent mixers blend like the serial path") {
+	const int character_count = 8;
+	Node3D *serial_targets[character_count];
+	Node3D *parallel_targets[character_count];
+	Node *root = memnew(Node);
+	for (int i = 0; i < character_count; i++) {
+		Ref<Animation> animation = create_target_animation(i + 1);
+		AnimationPlayer *serial_player = nullptr;
+		AnimationPlayer *parallel_player = nullptr;
+		root->add_child(create_animated_target(animation, false, &serial_player, &serial_targets[i]));
+		root->add_child(create_animated_target(animation, true, &parallel_player, &parallel_targets[i]));
+		serial_player->play("anim");
+		parallel_player->play("anim");
+	}
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	SUBCASE("Frames") {
+		const double steps[] = { 0.016, 0.033, 0.25, 0.007, 0.1 };
+		for (int frame = 0; frame < 20; frame++) {
+			SceneTree::get_singleton()->process(steps[frame % 5]);
+			for (int i = 0; i < character_count; i++) {
+				CHECK(parallel_targets[i]->get_position() == serial_targets[i]->get_position());
+				CHECK(parallel_targets[i]->get_scale() == serial_targets[i]->get_scale());
+				CHECK(parallel_targets[i]->get_position() != Vector3(100, 100, 100));
+			}
+		}
+	}
+
+	SUBCASE("Deferred apply") {
+		AnimationPlayer *serial_player = Object::cast_to<AnimationPlayer>(serial_targets[0]->get_parent()->get_child(1));
+		AnimationPlayer *parallel_player = Object::cast_to<AnimationPlayer>(parallel_targets[0]->get_parent()->get_child(1));
+		serial_player->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		parallel_player->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+
+		// Independent mixers leave the scene untouched until the queue is flushed at the end of the frame.
+		CHECK(serial_targets[0]->get_position() != Vector3(100, 100, 100));
+		CHECK(parallel_targets[0]->get_position() == Vector3(100, 100, 100));
+		MessageQueue::get_singleton()->flush();
+		CHECK(parallel_targets[0]->get_position() == serial_targets[0]->get_position());
+		CHECK(parallel_targets[0]->get_scale() == serial_targets[0]->get_scale());
+
+		// Seeking applies the pending blend before its own, so the seek wins as it does serially.
+		serial_player->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		parallel_player->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		serial_player->seek(0.3, true);
+		parallel_player->seek(0.3, true);
+		CHECK(parallel_targets[0]->get_position() == serial_targets[0]->get_position());
+		CHECK(parallel_targets[0]->get_scale() == serial_targets[0]->get_scale());
+		MessageQueue::get_singleton()->flush();
+		CHECK(parallel_targets[0]->get_position() == serial_targets[0]->get_position());
+
+		// A mixer freed while queued is skipped by the flush.
+		Node *character = parallel_targets[1]->get_parent();
+		Object::cast_to<AnimationPlayer>(character->get_child(1))->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		memdelete(character);
+		MessageQueue::get_singleton()->flush();
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Distant mixers blend less often and ease in between") {
+	SubViewport *viewport = memnew(SubViewport);
+	SceneTree::get_singleton()->get_root()->add_child(viewport);
+	Camera3D *camera = memnew(Camera3D);
+	viewport->add_child(camera);
+	REQUIRE(camera->is_current());
+
+	Node3D *root = memnew(Node3D);
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton");
+	skeleton->set_position(Vector3(0, 0, -5));
+	int root_bone = skeleton->add_bone("root");
+	int arm_bone = skeleton->add_bone("arm");
+	skeleton->set_bone_parent(arm_bone, root_bone);
+	int finger_bone = skeleton->add_bone("finger");
+	skeleton->set_bone_parent(finger_bone, arm_bone);
+	root->add_child(skeleton);
+
+	// Every bone moves along X by one unit per second, so the blended X is the playback position.
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(10.0);
+	const char *bone_paths[] = { "Skeleton:root", "Skeleton:arm", "Skeleton:finger" };
+	for (const char *bone_path : bone_paths) {
+		int track = animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(track, NodePath(bone_path));
+		animation->position_track_insert_key(track, 0.0, Vector3());
+		animation->position_track_insert_key(track, 10.0, Vector3(10, 0, 0));
+	}
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("anim", animation);
+
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->add_animation_library("", library);
+	player->set_lod_node(NodePath("../Skeleton"));
+	player->set_lod_distance(10.0);
+	player->set_lod_max_interval(4);
+	player->set_lod_bone_depth(1);
+	root->add_child(player);
+	viewport->add_child(root);
+	player->play("anim");
+
+	// Closer than lod_distance: blends every frame.
+	for (int i = 0; i < 3; i++) {
+		SceneTree::get_singleton()->process(0.1);
+		double position = player->get_current_animation_position();
+		CHECK(skeleton->get_bone_pose_position(root_bone).x == doctest::Approx(position));
+		CHECK(skeleton->get_bone_pose_position(finger_bone).x == doctest::Approx(position));
+	}
+	const double near_position = player->get_current_animation_position();
+
+	// 25 m away is an interval of 3 frames: the two frames in between neither advance nor move the bones.
+	skeleton->set_position(Vector3(0, 0, -25));
+	for (int i = 0; i < 2; i++) {
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(player->get_current_animation_position() == doctest::Approx(near_position));
+		CHECK(skeleton->get_bone_pose_position(root_bone).x == doctest::Approx(near_position));
+	}
+
+	// The third frame blends the accumulated time, then the bones ease to it over the interval.
+	SceneTree::get_singleton()->process(0.1);
+	const double far_position = player->get_current_animation_position();
+	CHECK(far_position == doctest::Approx(near_position + 0.3));
+	const double expected_offsets[] = { 0.1, 0.2, 0.3 };
+	for (int i = 0; i < 3; i++) {
+		if (i > 0) {
+			SceneTree::get_singleton()->process(0.1);
+			CHECK(player->get_current_animation_position() == doctest::Approx(far_position));
+		}
+		CHECK(skeleton->get_bone_pose_position(root_bone).x == doctest::Approx(near_position + expected_offsets[i]));
+		CHECK(skeleton->get_bone_pose_position(arm_bone).x == doctest::Approx(near_position + expected_offsets[i]));
+		// Deeper than lod_bone_depth: keeps the pose from the last full blend.
+		CHECK(skeleton->get_bone_pose_position(finger_bone).x == doctest::Approx(near_position));
+	}
+
+	// Back in range: the next frame blends everything again, including the time of the eased frames.
+	skeleton->set_position(Vector3(0, 0, -5));
+	SceneTree::get_singleton()->process(0.1);
+	double position = player->get_current_animation_position();
+	CHECK(position == doctest::Approx(far_position + 0.3));
+	CHECK(skeleton->get_bone_pose_position(root_bone).x == doctest::Approx(position));
+	CHECK(skeleton->get_bone_pose_position(finger_bone).x == doctest::Approx(position));
+
+	memdelete(viewport);
+}
+
+} // namespace TestAnimationMixer
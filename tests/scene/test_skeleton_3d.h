@@ -34,10 +34,38 @@
 
 #include "tests/test_macros.h"
 
+#include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/3d/skeleton_modifier_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
+#include "scene/resources/mesh.h"
 
 namespace TestSkeleton3D {
 
+// Rotates one bone, and records the pose the skeleton had for it when processed.
+class _TestBoneModifier3D : public SkeletonModifier3D {
+	GDCLASS(_TestBoneModifier3D, SkeletonModifier3D);
+
+protected:
+	virtual void _process_modification(double p_delta) override {
+		Skeleton3D *skeleton = get_skeleton();
+		processed_rotation = skeleton->get_bone_pose_rotation(bone);
+		processed_child_global_pose = skeleton->get_bone_global_pose(bone + 1);
+		if (rotate) {
+			skeleton->set_bone_pose_rotation(bone, rotation);
+		}
+	}
+
+public:
+	int bone = 0;
+	bool rotate = false;
+	Quaternion rotation;
+
+	Quaternion processed_rotation;
+	Transform3D processed_child_global_pose;
+};
+
 TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	Skeleton3D *skeleton = memnew(Skeleton3D);
 	skeleton->add_bone("root");
@@ -74,4 +102,243 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+
+TEST_CASE("[Skeleton3D] Global poses propagate through the nested set") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	// Two roots, with children added out of hierarchy order.
+	skeleton->add_bone("root_a");
+	skeleton->add_bone("root_b");
+	skeleton->add_bone("child_b");
+	skeleton->add_bone("child_a");
+	skeleton->add_bone("grandchild_a");
+	skeleton->set_bone_parent(2, 1);
+	skeleton->set_bone_parent(3, 0);
+	skeleton->set_bone_parent(4, 3);
+
+	for (int i = 0; i < skeleton->get_bone_count(); i++) {
+		skeleton->set_bone_pose_position(i, Vector3(i + 1, 0, 0));
+		skeleton->set_bone_pose_rotation(i, Quaternion(Vector3(0, 1, 0), 0.25 * i));
+	}
+	skeleton->force_update_all_bone_transforms();
+
+	auto expected_global_pose = [&](int p_bone) {
+		Transform3D pose;
+		for (int bone = p_bone; bone >= 0; bone = skeleton->get_bone_parent(bone)) {
+			pose = skeleton->get_bone_pose(bone) * pose;
+		}
+		return pose;
+	};
+	for (int i = 0; i < skeleton->get_bone_count(); i++) {
+		CHECK(skeleton->get_bone_global_pose(i).is_equal_approx(expected_global_pose(i)));
+	}
+
+	// Updating a subtree also picks up a dirty parent.
+	skeleton->set_bone_pose_position(0, Vector3(0, 5, 0));
+	skeleton->force_update_bone_children_transforms(3);
+	CHECK(skeleton->get_bone_global_pose(4).is_equal_approx(expected_global_pose(4)));
+	CHECK(skeleton->get_bone_global_pose(2).is_equal_approx(expected_global_pose(2)));
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[SceneTree][Skeleton3D] Modifier influence blends only the bones the modifier changed") {
+	GDREGISTER_CLASS(_TestBoneModifier3D);
+
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->add_bone("root");
+	skeleton->add_bone("arm");
+	skeleton->add_bone("hand");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->set_bone_parent(2, 1);
+	skeleton->set_bone_pose_position(2, Vector3(0, 1, 0));
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+
+	_TestBoneModifier3D *rotator = memnew(_TestBoneModifier3D);
+	rotator->bone = 1;
+	rotator->rotate = true;
+	rotator->rotation = Quaternion(Vector3(0, 0, 1), Math::PI / 2);
+	rotator->set_influence(0.5);
+	skeleton->add_child(rotator);
+	_TestBoneModifier3D *observer = memnew(_TestBoneModifier3D);
+	observer->bone = 1;
+	skeleton->add_child(observer);
+
+	skeleton->advance(0.0);
+	skeleton->notification(Skeleton3D::NOTIFICATION_UPDATE_SKELETON);
+
+	const Quaternion blended = Quaternion().slerp(rotator->rotation, 0.5);
+	CHECK(observer->processed_rotation.is_equal_approx(blended));
+	CHECK(observer->processed_child_global_pose.origin.is_equal_approx(blended.xform(Vector3(0, 1, 0))));
+	CHECK_MESSAGE(skeleton->get_bone_pose_rotation(1).is_equal_approx(Quaternion()), "Modified poses should be restored after the update.");
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[SceneTree][Skeleton3D] Skins registered to a follower are bound to the pose source") {
+	Node *root = memnew(Node);
+	Skeleton3D *source = memnew(Skeleton3D);
+	source->set_name("Source");
+	source->add_bone("root");
+	root->add_child(source);
+	Skeleton3D *follower = memnew(Skeleton3D);
+	follower->set_name("Follower");
+	follower->add_bone("root");
+	root->add_child(follower);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	Ref<Skin> skin = follower->create_skin_from_rest_transforms();
+	follower->set_pose_source(NodePath("../Source"));
+	Ref<SkinReference> follower_ref = follower->register_skin(skin);
+	Ref<SkinReference> source_ref = source->register_skin(skin);
+	CHECK_MESSAGE(follower_ref == source_ref, "Follower should share the skin reference of its pose source.");
+
+	// A loop falls back to the skeleton's own pose.
+	source->set_pose_source(NodePath("../Follower"));
+	ERR_PRINT_OFF;
+	Ref<SkinReference> own_ref = follower->register_skin(skin);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(own_ref != source_ref, "A pose source loop should not be followed.");
+
+	follower_ref.unref();
+	source_ref.unref();
+	own_ref.unref();
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Skeleton3D] A pose source added after its follower is picked up") {
+	Node *root = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	Skeleton3D *follower = memnew(Skeleton3D);
+	follower->add_bone("root");
+	follower->set_pose_source(NodePath("../Source"));
+	root->add_child(follower);
+
+	SIGNAL_WATCH(follower, SceneStringName(pose_source_changed));
+
+	Ref<Skin> skin = follower->create_skin_from_rest_transforms();
+	Ref<SkinReference> before_ref = follower->register_skin(skin);
+
+	Skeleton3D *source = memnew(Skeleton3D);
+	source->set_name("Source");
+	source->add_bone("root");
+	root->add_child(source);
+
+	// The follower reports the pose source once it enters the tree.
+	Array signal_args = { {} };
+	SIGNAL_CHECK(SceneStringName(pose_source_changed), signal_args);
+	SIGNAL_UNWATCH(follower, SceneStringName(pose_source_changed));
+	Ref<SkinReference> after_ref = follower->register_skin(skin);
+	Ref<SkinReference> source_ref = source->register_skin(skin);
+	CHECK(after_ref == source_ref);
+	CHECK(after_ref != before_ref);
+
+	before_ref.unref();
+	after_ref.unref();
+	source_ref.unref();
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Skeleton3D] Followers notice changes along the pose source chain") {
+	Node *root = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	Skeleton3D *skeletons[3];
+	for (int i = 0; i < 3; i++) {
+		skeletons[i] = memnew(Skeleton3D);
+		skeletons[i]->set_name(vformat("Skeleton%d", i));
+		skeletons[i]->add_bone("root");
+		root->add_child(skeletons[i]);
+	}
+	Skeleton3D *follower = skeletons[0];
+	Skeleton3D *middle = skeletons[1];
+	Skeleton3D *source = skeletons[2];
+	follower->set_pose_source(NodePath("../Skeleton1"));
+	middle->set_pose_source(NodePath("../Skeleton2"));
+
+	Ref<Skin> skin = follower->create_skin_from_rest_transforms();
+	Ref<SkinReference> source_ref = source->register_skin(skin);
+	CHECK(follower->register_skin(skin) == source_ref);
+
+	Array signal_args = { {} };
+	SIGNAL_WATCH(follower, SceneStringName(pose_source_changed));
+
+	SUBCASE("A skeleton further along the chain changing its source is forwarded") {
+		middle->set_pose_source(NodePath());
+		SIGNAL_CHECK(SceneStringName(pose_source_changed), signal_args);
+		CHECK(follower->register_skin(skin) == middle->register_skin(skin));
+	}
+
+	SUBCASE("The source leaving the tree makes the follower use its own pose") {
+		root->remove_child(source);
+		SIGNAL_CHECK(SceneStringName(pose_source_changed), signal_args);
+		CHECK(follower->register_skin(skin) != source_ref);
+		CHECK(follower->register_skin(skin) == middle->register_skin(skin));
+
+		// Skeletons following each other in a loop notify each other only once.
+		middle->set_pose_source(NodePath("../Skeleton0"));
+		SIGNAL_CHECK(SceneStringName(pose_source_changed), signal_args);
+
+		source_ref.unref();
+		memdelete(source);
+	}
+
+	SIGNAL_UNWATCH(follower, SceneStringName(pose_source_changed));
+	source_ref.unref();
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Skeleton3D] Vertex animation texture bake") {
+	Node3D *root = memnew(Node3D);
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton");
+	skeleton->add_bone("root");
+	root->add_child(skeleton);
+
+	// One triangle, fully weighted to the only bone.
+	Array arrays;
+	arrays.resize(Mesh::ARRAY_MAX);
+	arrays[Mesh::ARRAY_VERTEX] = Vector<Vector3>({ Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 0, 1) });
+	arrays[Mesh::ARRAY_BONES] = Vector<int>({ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 });
+	arrays[Mesh::ARRAY_WEIGHTS] = Vector<float>({ 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0 });
+	Ref<ArrayMesh> mesh;
+	mesh.instantiate();
+	mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+	MeshInstance3D *mesh_instance = memnew(MeshInstance3D);
+	mesh_instance->set_mesh(mesh);
+	skeleton->add_child(mesh_instance);
+
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	int track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track, NodePath("Skeleton:root"));
+	animation->position_track_insert_key(track, 0.0, Vector3());
+	animation->position_track_insert_key(track, 1.0, Vector3(0, 2, 0));
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->add_animation_library("", library);
+	root->add_child(player);
+
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	Ref<Image> image = mesh_instance->bake_vertex_animation_texture(player, "move", 4.0);
+	REQUIRE(image.is_valid());
+	CHECK(image->get_format() == Image::FORMAT_RGBF);
+	CHECK(image->get_width() == 3);
+	CHECK(image->get_height() == 5);
+	for (int frame = 0; frame < image->get_height(); frame++) {
+		const Color pixel = image->get_pixel(1, frame);
+		CHECK(Vector3(pixel.r, pixel.g, pixel.b).is_equal_approx(Vector3(1, 0.5 * frame, 0)));
+	}
+
+	// The player had no animation before, and the skeleton is back in its previous pose.
+	CHECK(player->get_assigned_animation().is_empty());
+	CHECK_FALSE(player->is_playing());
+	CHECK(skeleton->get_bone_pose_position(0).is_equal_approx(Vector3()));
+
+	memdelete(root);
+}
 } // namespace TestSkeleton3D
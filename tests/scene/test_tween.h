@@ -0,0 +1,250 @@
+/**************************************************************************/
+/*  test_tween.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#pragma once
+
+#include "tests/test_macros.h"
+
+#include "core/object/script_instance.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
+#include "scene/animation/tween.h"
+#include "scene/main/scene_tree.h"
+
+namespace TestTween {
+
+// Leaves every property to the native setters, but makes the tween take the generic Variant path.
+class _PassThroughScriptInstance : public ScriptInstance {
+public:
+	bool set(const StringName &p_name, const Variant &p_value) override {
+		return false;
+	}
+	bool get(const StringName &p_name, Variant &r_ret) const override {
+		return false;
+	}
+	void get_property_list(List<PropertyInfo> *p_properties) const override {
+	}
+	Variant::Type get_property_type(const StringName &p_name, bool *r_is_valid) const override {
+		if (r_is_valid) {
+			*r_is_valid = false;
+		}
+		return Variant::NIL;
+	}
+	virtual void validate_property(PropertyInfo &p_property) const override {
+	}
+	bool property_can_revert(const StringName &p_name) const override {
+		return false;
+	}
+	bool property_get_revert(const StringName &p_name, Variant &r_ret) const override {
+		return false;
+	}
+	void get_method_list(List<MethodInfo> *p_list) const override {
+	}
+	bool has_method(const StringName &p_method) const override {
+		return false;
+	}
+	int get_method_argument_count(const StringName &p_method, bool *r_is_valid = nullptr) const override {
+		if (r_is_valid) {
+			*r_is_valid = false;
+		}
+		return 0;
+	}
+	Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) override {
+		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		return Variant();
+	}
+	void notification(int p_notification, bool p_reversed = false) override {
+	}
+	Ref<Script> get_script() const override {
+		return Ref<Script>();
+	}
+	const Variant get_rpc_config() const override {
+		return Variant();
+	}
+	ScriptLanguage *get_language() override {
+		return nullptr;
+	}
+};
+
+// Overrides "position" the way a script setter would, storing twice the value instead of moving the node.
+class _PositionScriptInstance : public _PassThroughScriptInstance {
+public:
+	Vector2 position;
+
+	bool set(const StringName &p_name, const Variant &p_value) override {
+		if (p_name == SNAME("position")) {
+			position = Vector2(p_value) * 2;
+			return true;
+		}
+		return false;
+	}
+	bool get(const StringName &p_name, Variant &r_ret) const override {
+		if (p_name == SNAME("position")) {
+			r_ret = position;
+			return true;
+		}
+		return false;
+	}
+};
+
+static bool is_variant_equal_approx(const Variant &p_a, const Variant &p_b) {
+	if (p_a.get_type() != p_b.get_type()) {
+		return false;
+	}
+	switch (p_a.get_type()) {
+		case Variant::FLOAT:
+			return Math::is_equal_approx(double(p_a), double(p_b));
+		case Variant::VECTOR2:
+			return Vector2(p_a).is_equal_approx(p_b);
+		case Variant::VECTOR3:
+			return Vector3(p_a).is_equal_approx(p_b);
+		case Variant::COLOR:
+			return Color(p_a).is_equal_approx(p_b);
+		default:
+			return p_a == p_b;
+	}
+}
+
+// Tweens the same property on both objects in parallel and checks they stay equal at every step.
+static void check_tween_matches(Object *p_typed, Object *p_generic, const NodePath &p_property, const Variant &p_to, double p_delay = 0.0) {
+	Ref<Tween> tween = SceneTree::get_singleton()->create_tween();
+	tween->set_parallel(true);
+	tween->set_trans(Tween::TRANS_QUAD);
+	tween->set_ease(Tween::EASE_IN_OUT);
+	tween->tween_property(p_typed, p_property, p_to, 1.0)->set_delay(p_delay);
+	tween->tween_property(p_generic, p_property, p_to, 1.0)->set_delay(p_delay);
+
+	const Vector<StringName> property = p_property.get_as_property_path().get_subnames();
+	for (int i = 0; i < 12; i++) {
+		tween->custom_step(0.13);
+		CHECK(is_variant_equal_approx(p_typed->get_indexed(property), p_generic->get_indexed(property)));
+	}
+	CHECK_FALSE(tween->is_running());
+	CHECK(is_variant_equal_approx(p_typed->get_indexed(property), p_to));
+}
+
+TEST_CASE("[SceneTree][Tween] Typed properties end with the same values as the Variant path") {
+	Node2D *typed_2d = memnew(Node2D);
+	Node2D *generic_2d = memnew(Node2D);
+	generic_2d->set_script_instance(memnew(_PassThroughScriptInstance));
+	Node3D *typed_3d = memnew(Node3D);
+	Node3D *generic_3d = memnew(Node3D);
+	generic_3d->set_script_instance(memnew(_PassThroughScriptInstance));
+
+	SUBCASE("float") {
+		typed_2d->set_rotation(0.5);
+		generic_2d->set_rotation(0.5);
+		check_tween_matches(typed_2d, generic_2d, NodePath("rotation"), -1.25);
+	}
+
+	SUBCASE("Vector2") {
+		check_tween_matches(typed_2d, generic_2d, NodePath("position"), Vector2(4, -2));
+	}
+
+	SUBCASE("Vector3") {
+		typed_3d->set_position(Vector3(1, 2, 3));
+		generic_3d->set_position(Vector3(1, 2, 3));
+		check_tween_matches(typed_3d, generic_3d, NodePath("position"), Vector3(-3, 0.5, 8));
+	}
+
+	SUBCASE("Color") {
+		check_tween_matches(typed_2d, generic_2d, NodePath("modulate"), Color(0.2, 0.4, 0.6, 0.5));
+	}
+
+	SUBCASE("Start value read after the delay") {
+		check_tween_matches(typed_2d, generic_2d, NodePath("position"), Vector2(4, -2), 0.2);
+	}
+
+	memdelete(typed_2d);
+	memdelete(generic_2d);
+	memdelete(typed_3d);
+	memdelete(generic_3d);
+}
+
+TEST_CASE("[SceneTree][Tween] Script overridden setters still receive the tweened values") {
+	Node2D *node = memnew(Node2D);
+	_PositionScriptInstance *script_instance = memnew(_PositionScriptInstance);
+	node->set_script_instance(script_instance);
+
+	Ref<Tween> tween = SceneTree::get_singleton()->create_tween();
+	tween->tween_property(node, NodePath("position"), Vector2(4, 2), 1.0);
+	tween->custom_step(0.5);
+	CHECK(script_instance->position.is_equal_approx(Vector2(4, 2)));
+	tween->custom_step(0.5);
+	CHECK(script_instance->position.is_equal_approx(Vector2(8, 4)));
+	// The native setter was never called.
+	CHECK(node->get_position() == Vector2());
+
+	memdelete(node);
+}
+
+TEST_CASE("[SceneTree][Tween] Freed and invalid targets") {
+	SUBCASE("Freed while tweening") {
+		Node2D *freed = memnew(Node2D);
+		Node2D *kept = memnew(Node2D);
+		Ref<Tween> tween = SceneTree::get_singleton()->create_tween();
+		tween->set_parallel(true);
+		tween->tween_property(freed, NodePath("position"), Vector2(4, 2), 1.0);
+		tween->tween_property(kept, NodePath("position"), Vector2(4, 2), 1.0);
+		tween->custom_step(0.25);
+		memdelete(freed);
+		tween->custom_step(0.5);
+		CHECK(tween->is_running());
+		tween->custom_step(0.5);
+		CHECK_FALSE(tween->is_running());
+		CHECK(kept->get_position() == Vector2(4, 2));
+		memdelete(kept);
+	}
+
+	SUBCASE("Freed before starting") {
+		Node2D *node = memnew(Node2D);
+		Ref<Tween> tween = SceneTree::get_singleton()->create_tween();
+		tween->tween_property(node, NodePath("position"), Vector2(4, 2), 1.0);
+		memdelete(node);
+		ERR_PRINT_OFF;
+		tween->custom_step(0.5);
+		tween->custom_step(0.5);
+		ERR_PRINT_ON;
+		CHECK_FALSE(tween->is_running());
+	}
+
+	SUBCASE("Mismatched final value") {
+		Node2D *node = memnew(Node2D);
+		Ref<Tween> tween = SceneTree::get_singleton()->create_tween();
+		ERR_PRINT_OFF;
+		CHECK(tween->tween_property(node, NodePath("position"), Color(1, 0, 0), 1.0).is_null());
+		ERR_PRINT_ON;
+		tween->kill();
+		memdelete(node);
+	}
+}
+
+} // namespace TestTween
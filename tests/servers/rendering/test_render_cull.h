@@ -0,0 +1,338 @@
+/**************************************************************************/
+/*  test_render_cull.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/dummy/storage/utilities.h"
+#include "servers/rendering_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRenderCull {
+
+class NotifierCounter : public Object {
+	GDCLASS(NotifierCounter, Object);
+
+public:
+	int entered = 0;
+	int exited = 0;
+
+	void enter() { entered++; }
+	void exit() { exited++; }
+};
+
+// Runs the real scene and canvas culling on top of the dummy renderer.
+// Tests must have [SceneTree] in their name so a RenderingServer exists.
+class CullScene {
+public:
+	RID viewport;
+	RID scenario;
+	RID camera;
+	RID canvas;
+	RID mesh;
+	Vector<RID> instances;
+	Vector<RID> lights;
+	Vector<RID> canvas_items;
+
+	CullScene() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		RendererDummy::Utilities::set_culling_enabled(true);
+
+		viewport = rs->viewport_create();
+		rs->viewport_set_size(viewport, 256, 256);
+		rs->viewport_set_update_mode(viewport, RS::VIEWPORT_UPDATE_ALWAYS);
+		rs->viewport_set_active(viewport, true);
+
+		scenario = rs->scenario_create();
+		rs->viewport_set_scenario(viewport, scenario);
+
+		// Looks down -Z from the origin.
+		camera = rs->camera_create();
+		rs->camera_set_perspective(camera, 70, 0.05, 100);
+		rs->camera_set_transform(camera, Transform3D());
+		rs->viewport_attach_camera(viewport, camera);
+
+		canvas = rs->canvas_create();
+		rs->viewport_attach_canvas(viewport, canvas);
+
+		PackedVector3Array vertices = { Vector3(-0.5, -0.5, 0), Vector3(0.5, -0.5, 0), Vector3(0, 0.5, 0) };
+		Array arrays;
+		arrays.resize(RS::ARRAY_MAX);
+		arrays[RS::ARRAY_VERTEX] = vertices;
+		mesh = rs->mesh_create();
+		rs->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, arrays);
+	}
+
+	~CullScene() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		for (const RID &E : canvas_items) {
+			rs->free(E);
+		}
+		for (const RID &E : instances) {
+			rs->free(E);
+		}
+		for (const RID &E : lights) {
+			rs->free(E);
+		}
+		rs->free(mesh);
+		rs->free(canvas);
+		rs->free(camera);
+		rs->free(viewport);
+		rs->free(scenario);
+
+		RendererDummy::Utilities::set_culling_enabled(false);
+	}
+
+	void add_instance(const Vector3 &p_position) {
+		RID instance = RS::get_singleton()->instance_create2(mesh, scenario);
+		RS::get_singleton()->instance_set_transform(instance, Transform3D(Basis(), p_position));
+		instances.push_back(instance);
+	}
+
+	void add_omni_light(const Vector3 &p_position, float p_range) {
+		RID light = RS::get_singleton()->omni_light_create();
+		RS::get_singleton()->light_set_param(light, RS::LIGHT_PARAM_RANGE, p_range);
+		RID instance = RS::get_singleton()->instance_create2(light, scenario);
+		RS::get_singleton()->instance_set_transform(instance, Transform3D(Basis(), p_position));
+		lights.push_back(light);
+		instances.push_back(instance);
+	}
+
+	void add_canvas_rect(const Rect2 &p_rect) {
+		RID item = RS::get_singleton()->canvas_item_create();
+		RS::get_singleton()->canvas_item_set_parent(item, canvas);
+		RS::get_singleton()->canvas_item_add_rect(item, p_rect, Color(1, 1, 1));
+		canvas_items.push_back(item);
+	}
+
+	// Fills a grid of meshes in front of the camera and the same amount behind it,
+	// with a light over every fourth cell and half of the canvas items off screen.
+	void populate(int p_size) {
+		for (int x = 0; x < p_size; x++) {
+			for (int y = 0; y < p_size; y++) {
+				Vector3 offset = Vector3(x - p_size * 0.5, y - p_size * 0.5, 0) * (4.0 / p_size);
+				add_instance(offset + Vector3(0, 0, -10));
+				add_instance(offset + Vector3(0, 0, 10));
+				if ((x + y) % 4 == 0) {
+					add_omni_light(offset + Vector3(0, 0, -9), 2.0);
+				}
+				add_canvas_rect(Rect2(x * 4 % 256, y * 4 % 256, 4, 4));
+				add_canvas_rect(Rect2(1000 + x * 4, 1000 + y * 4, 4, 4));
+			}
+		}
+	}
+
+	int get_render_info(RS::ViewportRenderInfoType p_type) const {
+		return RS::get_singleton()->viewport_get_render_info(viewport, p_type, RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME);
+	}
+};
+
+TEST_CASE("[SceneTree][RenderCull] Dummy renderer allocates real objects only when culling is enabled") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	RID light = rs->omni_light_create();
+	CHECK_MESSAGE(light.is_null(), "Without culling the dummy renderer should not allocate lights.");
+
+	RendererDummy::Utilities::set_culling_enabled(true);
+	light = rs->omni_light_create();
+	CHECK(light.is_valid());
+	rs->free(light);
+	RendererDummy::Utilities::set_culling_enabled(false);
+}
+
+TEST_CASE("[SceneTree][RenderCull] Scene cull keeps instances in the camera frustum") {
+	CullScene scene;
+	scene.populate(4);
+
+	RS::get_singleton()->draw(false);
+
+	CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE) == 16, "Only the meshes in front of the camera should survive culling.");
+
+	// Turn the camera around.
+	RS::get_singleton()->camera_set_transform(scene.camera, Transform3D(Basis(Vector3(0, 1, 0), Math::PI), Vector3()));
+	RS::get_singleton()->draw(false);
+
+	CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE) == 16, "Only the meshes in front of the camera should survive culling.");
+
+	// Move everything out of the way.
+	RS::get_singleton()->camera_set_transform(scene.camera, Transform3D(Basis(), Vector3(0, 1000, 0)));
+	RS::get_singleton()->draw(false);
+
+	CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE) == 0);
+}
+
+TEST_CASE("[SceneTree][RenderCull] Canvas cull keeps items in the viewport") {
+	CullScene scene;
+	scene.populate(4);
+
+	RS::get_singleton()->draw(false);
+
+	CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 16, "Only the canvas items inside the viewport should survive culling.");
+}
+
+TEST_CASE("[SceneTree][RenderCull] Canvas dirty tracking only redraws changed 2D viewports") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	CullScene scene;
+	rs->viewport_set_disable_3d(scene.viewport, true);
+	rs->viewport_set_canvas_dirty_tracking(scene.viewport, true);
+	scene.add_canvas_rect(Rect2(0, 0, 16, 16));
+	scene.add_canvas_rect(Rect2(32, 0, 16, 16));
+	RID item = scene.canvas_items[0];
+
+	// Skipped viewports report no canvas items in frame.
+	rs->draw(false);
+	CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 2);
+	rs->draw(false);
+	CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0, "An unchanged viewport should be skipped.");
+
+	SUBCASE("Canvas item changes force a redraw") {
+		rs->canvas_item_add_rect(item, Rect2(16, 16, 8, 8), Color(1, 0, 0));
+		rs->draw(false);
+		CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 2, "Adding draw commands should redraw the viewport.");
+		rs->draw(false);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+
+		rs->canvas_item_set_transform(item, Transform2D(0, Vector2(64, 64)));
+		rs->draw(false);
+		CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 2, "Moving an item should redraw the viewport.");
+		rs->draw(false);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+
+		rs->canvas_item_set_visible(item, false);
+		rs->draw(false);
+		CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 1, "Hiding an item should redraw the viewport.");
+		rs->draw(false);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+	}
+
+	SUBCASE("Light changes force a redraw") {
+		RID light = rs->canvas_light_create();
+		rs->canvas_light_attach_to_canvas(light, scene.canvas);
+		rs->draw(false);
+		CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 2, "Adding a light should redraw the viewport.");
+		rs->draw(false);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+
+		rs->canvas_light_set_color(light, Color(1, 0, 0));
+		rs->draw(false);
+		CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 2, "Changing a light should redraw the viewport.");
+		rs->draw(false);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+
+		rs->free(light);
+	}
+
+	SUBCASE("Visibility notifiers stay visible while the viewport is skipped") {
+		NotifierCounter counter;
+		rs->canvas_item_set_visibility_notifier(item, true, Rect2(0, 0, 16, 16), callable_mp(&counter, &NotifierCounter::enter), callable_mp(&counter, &NotifierCounter::exit));
+		rs->draw(false);
+		CHECK_MESSAGE(counter.entered == 1, "Enabling a notifier should redraw the viewport so it can enter.");
+
+		for (int i = 0; i < 4; i++) {
+			rs->draw(false);
+			CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+		}
+		CHECK_MESSAGE(counter.exited == 0, "Skipped frames should not make a notifier exit.");
+		CHECK(counter.entered == 1);
+
+		rs->canvas_item_set_transform(item, Transform2D(0, Vector2(1000, 1000)));
+		rs->draw(false);
+		CHECK(counter.exited == 1);
+
+		rs->canvas_item_set_visibility_notifier(item, false, Rect2(), Callable(), Callable());
+	}
+
+	SUBCASE("Notifiers in other viewports still exit while this one is skipped") {
+		RID other_viewport = rs->viewport_create();
+		rs->viewport_set_size(other_viewport, 256, 256);
+		rs->viewport_set_update_mode(other_viewport, RS::VIEWPORT_UPDATE_ALWAYS);
+		rs->viewport_set_disable_3d(other_viewport, true);
+		rs->viewport_set_active(other_viewport, true);
+		RID other_canvas = rs->canvas_create();
+		rs->viewport_attach_canvas(other_viewport, other_canvas);
+		RID other_item = rs->canvas_item_create();
+		rs->canvas_item_set_parent(other_item, other_canvas);
+
+		NotifierCounter counter;
+		rs->canvas_item_set_visibility_notifier(other_item, true, Rect2(0, 0, 16, 16), callable_mp(&counter, &NotifierCounter::enter), callable_mp(&counter, &NotifierCounter::exit));
+		rs->draw(false);
+		CHECK(counter.entered == 1);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+
+		rs->canvas_item_set_transform(other_item, Transform2D(0, Vector2(1000, 1000)));
+		rs->draw(false);
+		CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0, "Changes to another canvas should not redraw this viewport.");
+		CHECK_MESSAGE(counter.exited == 1, "Skipping one viewport should not keep notifiers of other canvases visible.");
+
+		rs->free(other_item);
+		rs->free(other_canvas);
+		rs->free(other_viewport);
+	}
+
+	SUBCASE("Turning on update when visible forces a redraw") {
+		rs->canvas_item_set_update_when_visible(item, true);
+		rs->draw(false);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 2);
+		rs->draw(false);
+		CHECK_MESSAGE(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 2, "Items updated when visible should redraw the viewport every frame.");
+
+		rs->canvas_item_set_update_when_visible(item, false);
+		rs->draw(false);
+		rs->draw(false);
+		CHECK(scene.get_render_info(RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS) == 0);
+	}
+}
+
+TEST_CASE_BENCHMARK("[SceneTree][RenderCull][Benchmark] Scene and canvas cull frame time") {
+	const int frames = 200;
+	const int sizes[] = { 16, 64, 128 };
+
+	for (int size : sizes) {
+		CullScene scene;
+		scene.populate(size);
+
+		// Warm up, so instance updates and pairing are not measured.
+		RS::get_singleton()->draw(false);
+
+		const BenchmarkFrameTimes times = benchmark_frames(frames, [&](int p_frame) {
+			// Orbit the camera so the culled set changes every frame.
+			float angle = Math::TAU * p_frame / frames;
+			RS::get_singleton()->camera_set_transform(scene.camera, Transform3D(Basis(Vector3(0, 1, 0), angle), Vector3()));
+			RS::get_singleton()->draw(false);
+		});
+
+		print_line(vformat("%d meshes, %d lights, %d canvas items: %s.",
+				size * size * 2, scene.lights.size(), scene.canvas_items.size(), times.to_string()));
+	}
+}
+
+} // namespace TestRenderCull
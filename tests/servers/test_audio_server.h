@@ -0,0 +1,373 @@
+/**************************************************************************/
+/*  test_audio_server.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/audio/audio_decoded_cache.h"
+#include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_mix_kernels.h"
+#include "servers/audio/effects/audio_effect_reverb.h"
+#include "servers/audio/effects/audio_stream_generator.h"
+#include "servers/audio_server.h"
+
+#include "scene/resources/audio_stream_wav.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioServer {
+
+static Vector<AudioFrame> make_test_frames(uint32_t p_frames, uint32_t p_seed) {
+	Vector<AudioFrame> frames;
+	frames.resize(p_frames);
+	for (uint32_t i = 0; i < p_frames; i++) {
+		frames.write[i] = AudioFrame(Math::sin(0.01f * (i + p_seed)), Math::cos(0.03f * (i * 7 + p_seed)));
+	}
+	return frames;
+}
+
+TEST_CASE("[AudioServer] Mix kernels match the scalar mix") {
+	// Odd length so the scalar tail after the vector loop is covered too.
+	const uint32_t frame_count = 515;
+	const Vector<AudioFrame> source = make_test_frames(frame_count, 3);
+	const AudioFrame vol_start = AudioFrame(0.25, 1.0);
+	const AudioFrame vol_final = AudioFrame(0.75, 0.0);
+
+	SUBCASE("Ramped mix") {
+		Vector<AudioFrame> mixed = make_test_frames(frame_count, 11);
+		const Vector<AudioFrame> expected_base = mixed;
+		AudioMixKernels::mix_ramp(mixed.ptrw(), source.ptr(), vol_start, vol_final, frame_count);
+
+		for (uint32_t i = 0; i < frame_count; i++) {
+			float lerp_param = (float)i / frame_count;
+			AudioFrame expected = expected_base[i] + (vol_final * lerp_param + (1 - lerp_param) * vol_start) * source[i];
+			CHECK(mixed[i].left == doctest::Approx(expected.left));
+			CHECK(mixed[i].right == doctest::Approx(expected.right));
+		}
+	}
+
+	SUBCASE("Scale and peak") {
+		Vector<AudioFrame> scaled = source;
+		AudioFrame peak = AudioMixKernels::scale_and_peak(scaled.ptrw(), -0.5, frame_count);
+
+		AudioFrame expected_peak = AudioFrame(0, 0);
+		for (uint32_t i = 0; i < frame_count; i++) {
+			CHECK(scaled[i].left == source[i].left * -0.5f);
+			CHECK(scaled[i].right == source[i].right * -0.5f);
+			expected_peak.left = MAX(expected_peak.left, Math::abs(scaled[i].left));
+			expected_peak.right = MAX(expected_peak.right, Math::abs(scaled[i].right));
+		}
+		CHECK(peak.left == expected_peak.left);
+		CHECK(peak.right == expected_peak.right);
+	}
+
+	SUBCASE("Add and clear") {
+		Vector<AudioFrame> sum = make_test_frames(frame_count, 5);
+		const Vector<AudioFrame> expected_base = sum;
+		AudioMixKernels::add(sum.ptrw(), source.ptr(), frame_count);
+		for (uint32_t i = 0; i < frame_count; i++) {
+			CHECK(sum[i].left == expected_base[i].left + source[i].left);
+			CHECK(sum[i].right == expected_base[i].right + source[i].right);
+		}
+
+		AudioMixKernels::clear(sum.ptrw(), frame_count);
+		for (uint32_t i = 0; i < frame_count; i++) {
+			CHECK(sum[i].left == 0);
+			CHECK(sum[i].right == 0);
+		}
+	}
+
+	SUBCASE("Sinc interpolation") {
+		const float *table = AudioMixKernels::get_sinc_table();
+		const int center = AudioMixKernels::SINC_TAPS / 2 - 1;
+
+		// Whole frame positions pass the input through unchanged.
+		AudioFrame frame = AudioMixKernels::sinc_interpolate(table, source.ptr(), 0.0);
+		CHECK(frame.left == doctest::Approx(source[center].left));
+		CHECK(frame.right == doctest::Approx(source[center].right));
+
+		// Constant signals stay constant at every phase.
+		Vector<AudioFrame> constant;
+		constant.resize(AudioMixKernels::SINC_TAPS);
+		constant.fill(AudioFrame(0.5, -0.25));
+		for (int phase = 0; phase < 16; phase++) {
+			frame = AudioMixKernels::sinc_interpolate(table, constant.ptr(), phase / 16.0);
+			CHECK(frame.left == doctest::Approx(0.5));
+			CHECK(frame.right == doctest::Approx(-0.25));
+		}
+	}
+}
+
+class TestResampledPlayback : public AudioStreamPlaybackResampled {
+public:
+	Vector<AudioFrame> data;
+	int position = 0;
+	float rate = 0.0;
+
+	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override {
+		int mixed = MIN(p_frames, data.size() - position);
+		for (int i = 0; i < p_frames; i++) {
+			p_buffer[i] = i < mixed ? data[position + i] : AudioFrame(0, 0);
+		}
+		position += mixed;
+		return mixed;
+	}
+	virtual float get_stream_sampling_rate() override { return rate; }
+
+	void start_resampling() { begin_resample(); }
+};
+
+TEST_CASE("[Audio][AudioServer] Resampled playbacks at the mix rate are copied") {
+	const int frame_count = 300;
+	Ref<TestResampledPlayback> playback;
+	playback.instantiate();
+	playback->data = make_test_frames(frame_count, 7);
+	playback->rate = AudioServer::get_singleton()->get_mix_rate();
+	playback->start_resampling();
+
+	// Cubic interpolation trails the input by two frames.
+	Vector<AudioFrame> output;
+	output.resize(512);
+	int mixed = playback->mix(output.ptrw(), 1.0, output.size());
+	CHECK(mixed == frame_count + 2);
+	for (int i = 2; i < frame_count + 2; i++) {
+		CHECK(output[i].left == playback->data[i - 2].left);
+		CHECK(output[i].right == playback->data[i - 2].right);
+	}
+}
+
+// Drive the mixer from the test thread instead of the dummy driver's own thread.
+static AudioDriverDummy *begin_manual_mixing() {
+	AudioDriverDummy *driver = AudioDriverDummy::get_dummy_singleton();
+	driver->finish();
+	driver->set_use_threads(false);
+	driver->init();
+	driver->start();
+	return driver;
+}
+
+static void end_manual_mixing(AudioDriverDummy *p_driver) {
+	// Leave the driver so that AudioServer::finish() only frees the sample buffer once.
+	p_driver->set_use_threads(true);
+}
+
+TEST_CASE("[Audio][AudioServer] Inaudible playbacks are virtualized") {
+	AudioDriverDummy *driver = begin_manual_mixing();
+	AudioServer *audio_server = AudioServer::get_singleton();
+
+	Ref<AudioStreamWAV> stream;
+	stream.instantiate();
+	stream->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	stream->set_mix_rate(driver->get_mix_rate());
+	Vector<uint8_t> data;
+	data.resize(driver->get_mix_rate() / 2 * sizeof(int16_t)); // Half a second.
+	data.fill(0);
+	stream->set_data(data);
+
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+	Vector<AudioFrame> silent;
+	silent.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	silent.fill(AudioFrame(0, 0));
+	audio_server->start_playback_stream(playback, "Master", silent);
+	audio_server->set_playback_voice_params(playback, 0, stream->get_length());
+
+	Vector<int32_t> output;
+	output.resize(512 * 8 * driver->get_channels());
+	driver->mix_audio(512 * 8, output.ptrw());
+
+	CHECK(audio_server->get_real_voice_count() == 0);
+	CHECK(audio_server->get_virtual_voice_count() == 1);
+	// The first step fades the voice out, after that its position keeps advancing without mixing.
+	CHECK(audio_server->get_playback_position(playback) == doctest::Approx(512.0 * 8 / driver->get_mix_rate()).epsilon(0.01));
+	CHECK(audio_server->is_playback_active(playback));
+
+	// A one-shot stream that ends while virtual is stopped without being mixed.
+	output.resize(driver->get_mix_rate() * driver->get_channels());
+	driver->mix_audio(driver->get_mix_rate(), output.ptrw());
+	CHECK_FALSE(audio_server->is_playback_active(playback));
+
+	end_manual_mixing(driver);
+}
+
+TEST_CASE("[Audio][AudioServer] Virtual looping playbacks stay within their loop") {
+	AudioDriverDummy *driver = begin_manual_mixing();
+	AudioServer *audio_server = AudioServer::get_singleton();
+	const int mix_rate = driver->get_mix_rate();
+
+	Ref<AudioStreamWAV> stream;
+	stream.instantiate();
+	stream->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	stream->set_mix_rate(mix_rate);
+	Vector<uint8_t> data;
+	data.resize(mix_rate * sizeof(int16_t)); // One second.
+	data.fill(0);
+	stream->set_data(data);
+	stream->set_loop_mode(AudioStreamWAV::LOOP_FORWARD);
+	stream->set_loop_begin(mix_rate / 4);
+	stream->set_loop_end(mix_rate / 2);
+
+	double loop_begin = 0.0;
+	double loop_end = 0.0;
+	REQUIRE(stream->get_loop_range(loop_begin, loop_end));
+	CHECK(loop_begin == doctest::Approx(0.25));
+	CHECK(loop_end == doctest::Approx(0.5));
+
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+	Vector<AudioFrame> silent;
+	silent.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	silent.fill(AudioFrame(0, 0));
+	audio_server->start_playback_stream(playback, "Master", silent);
+	audio_server->set_playback_voice_params(playback, 0, stream->get_length(), loop_begin, loop_end);
+
+	// Play past the end of the stream while virtual, it should wrap into the loop instead of the whole stream.
+	const int frames = 512 * 8 + mix_rate;
+	Vector<int32_t> output;
+	output.resize(frames * driver->get_channels());
+	driver->mix_audio(frames, output.ptrw());
+
+	CHECK(audio_server->get_virtual_voice_count() == 1);
+	CHECK(audio_server->is_playback_active(playback));
+	const double expected_position = 0.25 + Math::fmod(double(frames) / mix_rate - 0.25, 0.25);
+	CHECK(audio_server->get_playback_position(playback) == doctest::Approx(expected_position).epsilon(0.05));
+
+	// Seeking doesn't restore the direction of a ping-pong loop, so it can't be followed.
+	stream->set_loop_mode(AudioStreamWAV::LOOP_PINGPONG);
+	CHECK_FALSE(stream->get_loop_range(loop_begin, loop_end));
+
+	audio_server->stop_playback_stream(playback);
+	end_manual_mixing(driver);
+}
+
+TEST_CASE("[Audio][AudioServer] Decoded cache stays within its memory budget") {
+	AudioDecodedCache *cache = AudioDecodedCache::get_singleton();
+	REQUIRE(cache != nullptr);
+
+	const uint64_t old_budget = cache->get_memory_budget();
+	const int frames = 1000;
+	const uint64_t entry_size = frames * sizeof(AudioFrame);
+	cache->set_memory_budget(entry_size * 2);
+
+	Vector<AudioFrame> pcm;
+	pcm.resize(frames);
+	cache->insert(ObjectID(uint64_t(1)), pcm);
+	cache->insert(ObjectID(uint64_t(2)), pcm);
+	CHECK(cache->get_entry_count() == 2);
+	CHECK(cache->get_memory_used() == entry_size * 2);
+
+	// Touch the first entry so the second one is the least recently used.
+	Vector<AudioFrame> found;
+	CHECK(cache->lookup(ObjectID(uint64_t(1)), found));
+	CHECK(found.size() == frames);
+
+	cache->insert(ObjectID(uint64_t(3)), pcm);
+	CHECK(cache->get_entry_count() == 2);
+	CHECK(cache->get_memory_used() == entry_size * 2);
+	CHECK(cache->lookup(ObjectID(uint64_t(1)), found));
+	CHECK_FALSE(cache->lookup(ObjectID(uint64_t(2)), found));
+
+	// Entries larger than the whole budget are never stored.
+	Vector<AudioFrame> large;
+	large.resize(frames * 3);
+	cache->insert(ObjectID(uint64_t(4)), large);
+	CHECK_FALSE(cache->lookup(ObjectID(uint64_t(4)), found));
+
+	cache->erase(ObjectID(uint64_t(1)));
+	CHECK(cache->get_memory_used() == entry_size);
+
+	cache->clear();
+	CHECK(cache->get_entry_count() == 0);
+	CHECK(cache->get_memory_used() == 0);
+	cache->set_memory_budget(old_budget);
+}
+
+TEST_CASE_BENCHMARK("[Audio][AudioServer][Benchmark] Bus mixing") {
+	const int bus_count = 16;
+	const int mix_frames = 512 * 200;
+
+	AudioDriverDummy *driver = begin_manual_mixing();
+
+	AudioServer *audio_server = AudioServer::get_singleton();
+	audio_server->set_bus_count(bus_count);
+
+	Vector<AudioFrame> volume;
+	volume.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	volume.fill(AudioFrame(1, 1));
+
+	Ref<AudioStreamGenerator> generator;
+	generator.instantiate();
+	generator->set_buffer_length(2.0);
+
+	Vector<Ref<AudioStreamGeneratorPlayback>> playbacks;
+	for (int i = 1; i < bus_count; i++) {
+		audio_server->set_bus_name(i, vformat("Bus%d", i));
+		// Half of the buses feed the master directly, the other half send through the first group.
+		audio_server->set_bus_send(i, i > bus_count / 2 ? StringName(vformat("Bus%d", i - bus_count / 2)) : StringName("Master"));
+		Ref<AudioEffectReverb> reverb;
+		reverb.instantiate();
+		audio_server->add_bus_effect(i, reverb);
+
+		Ref<AudioStreamGeneratorPlayback> playback = generator->instantiate_playback();
+		playbacks.push_back(playback);
+		audio_server->start_playback_stream(playback, audio_server->get_bus_name(i), volume);
+	}
+
+	Vector<int32_t> output;
+	output.resize(mix_frames * driver->get_channels());
+
+	const Vector<AudioFrame> source = make_test_frames(512, 0);
+	PackedVector2Array push_frames;
+	push_frames.resize(source.size());
+	for (int i = 0; i < source.size(); i++) {
+		push_frames.write[i] = Vector2(source[i].left, source[i].right);
+	}
+
+	uint64_t mix_usec = 0;
+	for (int done = 0; done < mix_frames; done += 512) {
+		for (Ref<AudioStreamGeneratorPlayback> &playback : playbacks) {
+			playback->push_buffer(push_frames);
+		}
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		driver->mix_audio(512, output.ptrw() + done * driver->get_channels());
+		mix_usec += OS::get_singleton()->get_ticks_usec() - begin;
+	}
+
+	MESSAGE(vformat("Mixed %d frames through %d buses in %.3f ms (%.2f%% of real time).", mix_frames, bus_count, mix_usec / 1000.0, 100.0 * mix_usec / (1000000.0 * mix_frames / driver->get_mix_rate())));
+
+	for (Ref<AudioStreamGeneratorPlayback> &playback : playbacks) {
+		audio_server->stop_playback_stream(playback);
+	}
+	// Let the fade-outs run so the playbacks are released.
+	driver->mix_audio(512, output.ptrw());
+
+	end_manual_mixing(driver);
+}
+
+} // namespace TestAudioServer
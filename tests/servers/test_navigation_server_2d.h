@@ -746,6 +746,53 @@ TEST_SUITE("[Navigation2D]") {
 			CHECK_EQ(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Async queries should yield the same paths as synchronous ones on the next frame") {
+			Ref<NavigationPathQueryParameters2D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector2(10, 10));
+			query_parameters->set_target_position(Vector2(0, 0));
+			Ref<NavigationPathQueryResult2D> expected_result;
+			expected_result.instantiate();
+			navigation_server->query_path(query_parameters, expected_result);
+
+			LocalVector<Ref<NavigationPathQueryResult2D>> query_results;
+			for (int i = 0; i < 16; i++) {
+				Ref<NavigationPathQueryResult2D> query_result;
+				query_result.instantiate();
+				navigation_server->query_path_async(query_parameters, query_result);
+				query_results.push_back(query_result);
+			}
+			CHECK_EQ(query_results[0]->get_path().size(), 0);
+
+			navigation_server->process(0.0); // Starts the batch.
+			navigation_server->process(0.0); // Delivers the results.
+			for (const Ref<NavigationPathQueryResult2D> &query_result : query_results) {
+				CHECK_EQ(query_result->get_path(), expected_result->get_path());
+			}
+		}
+
+		SUBCASE("Following a flow field should lead to its target around obstacles") {
+			Ref<NavigationFlowField2D> flow_field = navigation_server->map_get_flow_field(map, Vector2(500, 500));
+			REQUIRE(flow_field.is_valid());
+
+			Vector2 position(-500, -500);
+			CHECK(flow_field->is_position_reachable(position));
+			// The obstruction in the middle makes the way longer than the straight line.
+			CHECK_GT(flow_field->get_distance(position), position.distance_to(Vector2(500, 500)) + 1.0);
+			for (int i = 0; i < 1000; i++) {
+				const Vector2 direction = flow_field->get_direction(position);
+				if (direction == Vector2()) {
+					break;
+				}
+				position += direction * MIN(real_t(5.0), position.distance_to(flow_field->get_next_position(position)));
+			}
+			CHECK(position.is_equal_approx(Vector2(500, 500)));
+
+			CHECK_FALSE(flow_field->is_position_reachable(Vector2(5000, 5000)));
+			CHECK_EQ(flow_field->get_direction(Vector2(5000, 5000)), Vector2());
+		}
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
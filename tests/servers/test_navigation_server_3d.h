@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include "modules/navigation_3d/3d/nav_mesh_generator_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -156,6 +157,10 @@ TEST_SUITE("[Navigation3D]") {
 			navigation_server->map_set_cell_size(map, 0.55);
 			navigation_server->map_set_edge_connection_margin(map, 0.66);
 			navigation_server->map_set_link_connection_radius(map, 0.77);
+			navigation_server->map_set_hierarchical_cluster_size(map, 8.0);
+			navigation_server->map_set_avoidance_lod_origin(map, Vector3(1, 2, 3));
+			navigation_server->map_set_avoidance_lod_distance(map, 40.0);
+			navigation_server->map_set_avoidance_lod_update_interval(map, 3);
 			navigation_server->map_set_up(map, Vector3(1, 0, 0));
 			bool initial_use_edge_connections = navigation_server->map_get_use_edge_connections(map);
 			navigation_server->map_set_use_edge_connections(map, !initial_use_edge_connections);
@@ -164,6 +169,10 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(navigation_server->map_get_cell_size(map), doctest::Approx(0.55));
 			CHECK_EQ(navigation_server->map_get_edge_connection_margin(map), doctest::Approx(0.66));
 			CHECK_EQ(navigation_server->map_get_link_connection_radius(map), doctest::Approx(0.77));
+			CHECK_EQ(navigation_server->map_get_hierarchical_cluster_size(map), doctest::Approx(8.0));
+			CHECK_EQ(navigation_server->map_get_avoidance_lod_origin(map), Vector3(1, 2, 3));
+			CHECK_EQ(navigation_server->map_get_avoidance_lod_distance(map), doctest::Approx(40.0));
+			CHECK_EQ(navigation_server->map_get_avoidance_lod_update_interval(map), 3);
 			CHECK_EQ(navigation_server->map_get_up(map), Vector3(1, 0, 0));
 			CHECK_EQ(navigation_server->map_get_use_edge_connections(map), !initial_use_edge_connections);
 		}
@@ -428,6 +437,63 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->free(map);
 	}
 
+	TEST_CASE("[NavigationServer3D] Agents beyond the avoidance LOD distance should report their current velocity") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		RID near_agent = navigation_server->agent_create();
+		RID far_agent = navigation_server->agent_create();
+
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_avoidance_lod_origin(map, Vector3(0, 0, 0));
+		navigation_server->map_set_avoidance_lod_distance(map, 10.0);
+		navigation_server->map_set_avoidance_lod_update_interval(map, 4);
+
+		bool use_3d_avoidance = false;
+		SUBCASE("2D avoidance") {
+			use_3d_avoidance = false;
+		}
+		SUBCASE("3D avoidance") {
+			use_3d_avoidance = true;
+		}
+
+		CallableMock near_agent_avoidance_callback_mock;
+		CallableMock far_agent_avoidance_callback_mock;
+		RID agents[] = { near_agent, far_agent };
+		CallableMock *callback_mocks[] = { &near_agent_avoidance_callback_mock, &far_agent_avoidance_callback_mock };
+		for (int i = 0; i < 2; i++) {
+			navigation_server->agent_set_map(agents[i], map);
+			navigation_server->agent_set_avoidance_enabled(agents[i], true);
+			navigation_server->agent_set_use_3d_avoidance(agents[i], use_3d_avoidance);
+			navigation_server->agent_set_position(agents[i], Vector3(i * 100, 0, 0));
+			navigation_server->agent_set_radius(agents[i], 1);
+			navigation_server->agent_set_max_speed(agents[i], 5);
+			navigation_server->agent_set_avoidance_callback(agents[i], callable_mp(callback_mocks[i], &CallableMock::function1));
+		}
+
+		// The far agent only computes its avoidance every 4 steps, but without neighbors
+		// it must follow each new velocity right away, whether it was updated or not.
+		const Vector3 velocities[] = { Vector3(1, 0, 0), Vector3(0, 0, -2), Vector3(-3, 0, 1), Vector3(0, 0, 0), Vector3(2, 0, 2) };
+		for (const Vector3 &velocity : velocities) {
+			navigation_server->agent_set_velocity(near_agent, velocity);
+			navigation_server->agent_set_velocity(far_agent, velocity);
+			navigation_server->physics_process(0.1);
+			CHECK(Vector3(near_agent_avoidance_callback_mock.function1_latest_arg0).is_equal_approx(velocity));
+			CHECK(Vector3(far_agent_avoidance_callback_mock.function1_latest_arg0).is_equal_approx(velocity));
+		}
+
+		// Velocities above the max speed are limited like the avoidance result would be.
+		navigation_server->agent_set_velocity(far_agent, Vector3(0, 0, 20));
+		for (int i = 0; i < 4; i++) {
+			navigation_server->physics_process(0.1);
+			CHECK(Vector3(far_agent_avoidance_callback_mock.function1_latest_arg0).is_equal_approx(Vector3(0, 0, 5)));
+		}
+
+		navigation_server->free(far_agent);
+		navigation_server->free(near_agent);
+		navigation_server->free(map);
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should make agents avoid dynamic obstacles when avoidance enabled") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
 
@@ -807,11 +873,148 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(query_result->get_path().size(), 0);
 		}
 
+		SUBCASE("Async queries should yield the same paths as synchronous ones on the next frame") {
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(10, 0, 10));
+			query_parameters->set_target_position(Vector3(0, 0, 0));
+			Ref<NavigationPathQueryResult3D> expected_result;
+			expected_result.instantiate();
+			navigation_server->query_path(query_parameters, expected_result);
+
+			LocalVector<Ref<NavigationPathQueryResult3D>> query_results;
+			for (int i = 0; i < 16; i++) {
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				navigation_server->query_path_async(query_parameters, query_result);
+				query_results.push_back(query_result);
+			}
+			CHECK_EQ(query_results[0]->get_path().size(), 0);
+
+			navigation_server->process(0.0); // Starts the batch.
+			navigation_server->process(0.0); // Delivers the results.
+			for (const Ref<NavigationPathQueryResult3D> &query_result : query_results) {
+				CHECK_EQ(query_result->get_path(), expected_result->get_path());
+			}
+		}
+
+		SUBCASE("Following a flow field should lead to its target") {
+			Ref<NavigationFlowField3D> flow_field = navigation_server->map_get_flow_field(map, Vector3(-4, 0, -4));
+			REQUIRE(flow_field.is_valid());
+			const Vector3 target = navigation_server->map_get_closest_point(map, Vector3(-4, 0, -4));
+
+			Vector3 position = navigation_server->map_get_closest_point(map, Vector3(4, 0, 4));
+			CHECK(flow_field->is_position_reachable(position));
+			CHECK_GE(flow_field->get_distance(position), position.distance_to(target) - 0.01);
+			for (int i = 0; i < 200; i++) {
+				const Vector3 direction = flow_field->get_direction(position);
+				if (direction == Vector3()) {
+					break;
+				}
+				position += direction * MIN(real_t(0.1), position.distance_to(flow_field->get_next_position(position)));
+			}
+			CHECK(position.is_equal_approx(target));
+
+			CHECK_FALSE(flow_field->is_position_reachable(Vector3(100, 0, 100)));
+			CHECK_EQ(flow_field->get_direction(Vector3(100, 0, 100)), Vector3());
+			CHECK_EQ(flow_field->get_distance(Vector3(100, 0, 100)), doctest::Approx(-1.0));
+
+			Ref<NavigationFlowField3D> other_layers_flow_field = navigation_server->map_get_flow_field(map, Vector3(-4, 0, -4), 2);
+			REQUIRE(other_layers_flow_field.is_valid());
+			CHECK_FALSE(other_layers_flow_field->is_position_reachable(Vector3(4, 0, 4)));
+		}
+
+		SUBCASE("Queries on a map with hierarchical clusters should reach the same target") {
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(-5, 0, -5));
+			query_parameters->set_target_position(Vector3(5, 0, 5));
+			Ref<NavigationPathQueryResult3D> expected_result;
+			expected_result.instantiate();
+			navigation_server->query_path(query_parameters, expected_result);
+			REQUIRE_NE(expected_result->get_path().size(), 0);
+
+			navigation_server->map_set_hierarchical_cluster_size(map, 2.0);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+			navigation_server->query_path(query_parameters, query_result);
+			REQUIRE_NE(query_result->get_path().size(), 0);
+			CHECK_EQ(query_result->get_path()[0], expected_result->get_path()[0]);
+			CHECK_EQ(query_result->get_path()[query_result->get_path().size() - 1], expected_result->get_path()[expected_result->get_path().size() - 1]);
+
+			// Region filters still apply with clusters enabled.
+			query_parameters->set_excluded_regions({ region });
+			navigation_server->query_path(query_parameters, query_result);
+			CHECK_EQ(query_result->get_path().size(), 0);
+		}
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should bake tiled navigation meshes") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(2.5);
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_GT(navigation_mesh->get_polygon_count(), 2);
+		CHECK_NE(navigation_mesh->get_vertices().size(), 0);
+
+		SUBCASE("Baking again should only rebake the tiles whose source geometry changed") {
+			// Tiles large enough that a small box and the tile border around it fit in one tile.
+			navigation_mesh->set_tile_size(5.0);
+			Array box_arr;
+			box_arr.resize(RS::ARRAY_MAX);
+			BoxMesh::create_mesh_array(box_arr, Vector3(0.2, 0.5, 0.2));
+			source_geometry->add_mesh_array(box_arr, Transform3D(Basis(), Vector3(2.5, 0.25, 2.5)));
+
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_GT(NavMeshGenerator3D::get_rebaked_tile_count(navigation_mesh), 1u);
+
+			const Vector<Vector3> vertices = navigation_mesh->get_vertices();
+			const int polygon_count = navigation_mesh->get_polygon_count();
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_rebaked_tile_count(navigation_mesh), 0u);
+			CHECK_EQ(navigation_mesh->get_vertices(), vertices);
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+
+			source_geometry->clear();
+			source_geometry->add_mesh_array(arr, Transform3D());
+			source_geometry->add_mesh_array(box_arr, Transform3D(Basis(), Vector3(2.6, 0.25, 2.4)));
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_rebaked_tile_count(navigation_mesh), 1u);
+		}
+
+		SUBCASE("Tiled navigation meshes should be usable for path queries") {
+			RID map = navigation_server->map_create();
+			RID region = navigation_server->region_create();
+			navigation_server->map_set_active(map, true);
+			navigation_server->map_set_use_async_iterations(map, false);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4.0, 0.0, -4.0), Vector3(4.0, 0.0, 4.0), true);
+			CHECK_GT(path.size(), 1);
+			CHECK(path[path.size() - 1].is_equal_approx(navigation_server->map_get_closest_point(map, Vector3(4.0, 0.0, 4.0))));
+
+			navigation_server->free(region);
+			navigation_server->free(map);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		}
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*  test_physics_server_2d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/physics_server_2d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer2D {
+
+// Circles thrown onto a static floor, in their own space.
+// Tests must have [SceneTree] in their name so a PhysicsServer2D exists.
+class ThrownCircles {
+public:
+	RID space;
+	RID floor;
+	RID floor_shape;
+	RID circle_shape;
+	LocalVector<RID> circles;
+
+	// The circles are always created in the same order, so they get the same RIDs, but can join the space in reverse.
+	ThrownCircles(int p_count, bool p_deterministic, bool p_reverse_insertion = false) {
+		PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+		space = ps->space_create();
+		if (space.is_null()) {
+			return;
+		}
+		ps->space_set_active(space, true);
+		ps->space_set_deterministic(space, p_deterministic);
+
+		floor_shape = ps->rectangle_shape_create();
+		ps->shape_set_data(floor_shape, Vector2(1000, 10));
+		floor = ps->body_create();
+		ps->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+		ps->body_add_shape(floor, floor_shape);
+		ps->body_set_state(floor, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(0, 10)));
+		ps->body_set_space(floor, space);
+
+		circle_shape = ps->circle_shape_create();
+		ps->shape_set_data(circle_shape, 8);
+
+		for (int i = 0; i < p_count; i++) {
+			RID circle = ps->body_create();
+			ps->body_set_mode(circle, PhysicsServer2D::BODY_MODE_RIGID);
+			ps->body_add_shape(circle, circle_shape);
+			ps->body_set_state(circle, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2((i % 10) * 20 - 100, -20 - (i / 10) * 20)));
+			ps->body_set_state(circle, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, Vector2((i % 7) * 15 - 45, (i % 3) * 10));
+			circles.push_back(circle);
+		}
+		for (int i = 0; i < p_count; i++) {
+			ps->body_set_space(circles[p_reverse_insertion ? p_count - 1 - i : i], space);
+		}
+	}
+
+	~ThrownCircles() {
+		if (space.is_null()) {
+			return;
+		}
+		PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+		for (const RID &circle : circles) {
+			ps->free(circle);
+		}
+		ps->free(floor);
+		ps->free(circle_shape);
+		ps->free(floor_shape);
+		ps->free(space);
+	}
+
+	LocalVector<uint32_t> record_checksums(int p_frames) {
+		LocalVector<uint32_t> checksums;
+		for (int i = 0; i < p_frames; i++) {
+			PhysicsServer2D::get_singleton()->step(1.0 / 60.0);
+			checksums.push_back(PhysicsServer2D::get_singleton()->space_get_step_checksum(space));
+		}
+		return checksums;
+	}
+};
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Deterministic space replays with the same checksums") {
+	LocalVector<uint32_t> recording;
+	{
+		ThrownCircles circles(40, true);
+		if (circles.space.is_null()) {
+			MESSAGE("No physics engine available, skipping.");
+			return;
+		}
+		CHECK(PhysicsServer2D::get_singleton()->space_is_deterministic(circles.space));
+		recording = circles.record_checksums(120);
+	}
+
+	CHECK_MESSAGE(recording[0] != recording[recording.size() - 1], "The checksum should follow the bodies as they move.");
+
+	ThrownCircles circles(40, true);
+	LocalVector<uint32_t> replay = circles.record_checksums(120);
+
+	REQUIRE(recording.size() == replay.size());
+	int first_mismatch = -1;
+	for (uint32_t i = 0; i < recording.size(); i++) {
+		if (recording[i] != replay[i]) {
+			first_mismatch = i;
+			break;
+		}
+	}
+	CHECK_MESSAGE(first_mismatch == -1, vformat("Replaying the same inputs diverged at step %d.", first_mismatch));
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Checksums are only computed in deterministic mode") {
+	ThrownCircles circles(10, false);
+	if (circles.space.is_null()) {
+		MESSAGE("No physics engine available, skipping.");
+		return;
+	}
+
+	CHECK_FALSE(PhysicsServer2D::get_singleton()->space_is_deterministic(circles.space));
+	LocalVector<uint32_t> checksums = circles.record_checksums(10);
+	CHECK(checksums[checksums.size() - 1] == 0);
+
+	PhysicsServer2D::get_singleton()->space_set_deterministic(circles.space, true);
+	checksums = circles.record_checksums(1);
+	CHECK(checksums[0] != 0);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Deterministic space doesn't depend on the broadphase insertion order") {
+	LocalVector<uint32_t> recording;
+	{
+		ThrownCircles circles(40, true);
+		if (circles.space.is_null()) {
+			MESSAGE("No physics engine available, skipping.");
+			return;
+		}
+		recording = circles.record_checksums(120);
+	}
+
+	// Reversed insertion builds another BVH, which reports the contact pairs in another order and orientation.
+	ThrownCircles circles(40, true, true);
+	LocalVector<uint32_t> replay = circles.record_checksums(120);
+
+	REQUIRE(recording.size() == replay.size());
+	int first_mismatch = -1;
+	for (uint32_t i = 0; i < recording.size(); i++) {
+		if (recording[i] != replay[i]) {
+			first_mismatch = i;
+			break;
+		}
+	}
+	CHECK_MESSAGE(first_mismatch == -1, vformat("Inserting the bodies in reverse diverged at step %d.", first_mismatch));
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Restoring a saved space state replays with the same checksums") {
+	ThrownCircles circles(40, true);
+	if (circles.space.is_null()) {
+		MESSAGE("No physics engine available, skipping.");
+		return;
+	}
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	circles.record_checksums(30);
+	const PackedByteArray state = ps->space_save_state(circles.space);
+	REQUIRE_FALSE(state.is_empty());
+	const LocalVector<uint32_t> recording = circles.record_checksums(60);
+
+	// Rolls back several times, as a rollback client would every frame.
+	for (int rollback = 0; rollback < 3; rollback++) {
+		CHECK(ps->space_restore_state(circles.space, state));
+		const LocalVector<uint32_t> replay = circles.record_checksums(60);
+
+		REQUIRE(recording.size() == replay.size());
+		int first_mismatch = -1;
+		for (uint32_t i = 0; i < recording.size(); i++) {
+			if (recording[i] != replay[i]) {
+				first_mismatch = i;
+				break;
+			}
+		}
+		CHECK_MESSAGE(first_mismatch == -1, vformat("Resimulating from the restored state diverged at step %d.", first_mismatch));
+	}
+
+	ERR_PRINT_OFF;
+	PackedByteArray truncated = state;
+	truncated.resize(truncated.size() / 2);
+	CHECK_FALSE(ps->space_restore_state(circles.space, truncated));
+	ERR_PRINT_ON;
+}
+
+} // namespace TestPhysicsServer2D
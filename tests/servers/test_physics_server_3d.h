@@ -0,0 +1,322 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+// Columns of boxes stacked on a static floor, in their own space.
+// Tests must have [SceneTree] in their name so a PhysicsServer3D exists.
+class BoxStacks {
+public:
+	RID space;
+	RID floor;
+	RID floor_shape;
+	RID box_shape;
+	LocalVector<RID> boxes;
+
+	BoxStacks(int p_columns, int p_height) {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+		space = ps->space_create();
+		if (space.is_null()) {
+			return;
+		}
+		ps->space_set_active(space, true);
+
+		floor_shape = ps->box_shape_create();
+		ps->shape_set_data(floor_shape, Vector3(p_columns * 2.0 + 10.0, 0.5, p_columns * 2.0 + 10.0));
+		floor = ps->body_create();
+		ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(floor, floor_shape);
+		ps->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -0.5, 0)));
+		ps->body_set_space(floor, space);
+
+		box_shape = ps->box_shape_create();
+		ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+		int side = MAX(1, (int)Math::ceil(Math::sqrt((double)p_columns)));
+		for (int column = 0; column < p_columns; column++) {
+			Vector3 base = Vector3((column % side) * 2.0, 0, (column / side) * 2.0);
+			for (int level = 0; level < p_height; level++) {
+				RID box = ps->body_create();
+				ps->body_set_mode(box, PhysicsServer3D::BODY_MODE_RIGID);
+				ps->body_add_shape(box, box_shape);
+				ps->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), base + Vector3(0, 0.5 + level * 1.01, 0)));
+				ps->body_set_space(box, space);
+				boxes.push_back(box);
+			}
+		}
+	}
+
+	~BoxStacks() {
+		if (space.is_null()) {
+			return;
+		}
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		for (const RID &box : boxes) {
+			ps->free(box);
+		}
+		ps->free(floor);
+		ps->free(box_shape);
+		ps->free(floor_shape);
+		ps->free(space);
+	}
+
+	LocalVector<Transform3D> get_transforms() const {
+		LocalVector<Transform3D> transforms;
+		for (const RID &box : boxes) {
+			transforms.push_back(PhysicsServer3D::get_singleton()->body_get_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM));
+		}
+		return transforms;
+	}
+};
+
+void step_frames(int p_frames) {
+	for (int i = 0; i < p_frames; i++) {
+		PhysicsServer3D::get_singleton()->step(1.0 / 60.0);
+	}
+}
+
+// Steps two spaces of stacked boxes on a new server of the given engine and returns where the boxes ended up.
+// Only call this from tests without [SceneTree] in their name, so no other physics server exists.
+LocalVector<Transform3D> simulate_two_spaces(const String &p_engine, bool p_step_spaces_in_parallel) {
+	ProjectSettings::get_singleton()->set_setting("physics/3d/step_spaces_in_parallel", p_step_spaces_in_parallel);
+	PhysicsServer3D *ps = PhysicsServer3DManager::get_singleton()->new_server(p_engine);
+	ProjectSettings::get_singleton()->set_setting("physics/3d/step_spaces_in_parallel", false);
+	if (ps == nullptr) {
+		return LocalVector<Transform3D>();
+	}
+	ps->init();
+
+	LocalVector<Transform3D> transforms;
+	{
+		BoxStacks first(9, 3);
+		BoxStacks second(4, 5);
+		if (first.space.is_valid()) {
+			step_frames(30);
+			transforms = first.get_transforms();
+			for (const Transform3D &transform : second.get_transforms()) {
+				transforms.push_back(transform);
+			}
+		}
+	}
+
+	ps->finish();
+	memdelete(ps);
+	return transforms;
+}
+
+TEST_CASE("[PhysicsServer3D] Stepping spaces in parallel matches stepping them serially") {
+	PhysicsServer3DManager *manager = PhysicsServer3DManager::get_singleton();
+	for (int i = 0; i < manager->get_servers_count(); i++) {
+		const String engine = manager->get_server_name(i);
+		const LocalVector<Transform3D> serial = simulate_two_spaces(engine, false);
+		if (serial.is_empty()) {
+			// The dummy server has no spaces.
+			continue;
+		}
+		const LocalVector<Transform3D> parallel = simulate_two_spaces(engine, true);
+
+		INFO(engine);
+		REQUIRE(serial.size() == parallel.size());
+		bool identical = true;
+		for (uint32_t j = 0; j < serial.size(); j++) {
+			identical = identical && serial[j].origin.distance_to(parallel[j].origin) < 0.001;
+		}
+		CHECK_MESSAGE(identical, "Spaces stepped in parallel should end up where they do when stepped one after the other.");
+	}
+}
+
+TEST_CASE("[PhysicsServer3D] GodotPhysics3D steps the same with and without worker threads") {
+	// Stepping spaces in parallel runs the stages within each space serially, so this compares
+	// bodies integrated, pairs set up and islands solved on worker threads against doing it in order.
+	// Each run uses a new server, so RIDs and pair order match and the results must be bit for bit equal.
+	const LocalVector<Transform3D> threaded = simulate_two_spaces("GodotPhysics3D", false);
+	if (threaded.is_empty()) {
+		MESSAGE("GodotPhysics3D is not available, skipping.");
+		return;
+	}
+	const LocalVector<Transform3D> serial = simulate_two_spaces("GodotPhysics3D", true);
+
+	REQUIRE(threaded.size() == serial.size());
+	bool identical = true;
+	for (uint32_t i = 0; i < threaded.size(); i++) {
+		identical = identical && threaded[i] == serial[i];
+	}
+	CHECK_MESSAGE(identical, "Stepping on worker threads should give exactly the same results as stepping serially.");
+
+	bool resting = true;
+	for (const Transform3D &transform : threaded) {
+		resting = resting && transform.origin.y > 0.0;
+	}
+	CHECK_MESSAGE(resting, "Boxes should rest on the floor.");
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Restoring a saved space state resimulates the same steps") {
+	BoxStacks stacks(16, 4);
+	if (stacks.space.is_null()) {
+		MESSAGE("No physics engine available, skipping.");
+		return;
+	}
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	// Saved mid-fall, so velocities and contacts both matter.
+	step_frames(10);
+	const PackedByteArray state = ps->space_save_state(stacks.space);
+	REQUIRE_FALSE(state.is_empty());
+
+	step_frames(20);
+	const LocalVector<Transform3D> first_run = stacks.get_transforms();
+
+	CHECK(ps->space_restore_state(stacks.space, state));
+	step_frames(20);
+	const LocalVector<Transform3D> second_run = stacks.get_transforms();
+
+	REQUIRE(first_run.size() == second_run.size());
+	bool identical = true;
+	for (uint32_t i = 0; i < first_run.size(); i++) {
+		identical = identical && first_run[i].origin.distance_to(second_run[i].origin) < 0.001;
+	}
+	CHECK_MESSAGE(identical, "Resimulating from a restored state should give the same results.");
+
+	ERR_PRINT_OFF;
+	CHECK_FALSE(ps->space_restore_state(stacks.space, PackedByteArray()));
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched queries match single queries") {
+	BoxStacks stacks(9, 2);
+	if (stacks.space.is_null()) {
+		MESSAGE("No physics engine available, skipping.");
+		return;
+	}
+	step_frames(1);
+
+	PhysicsDirectSpaceState3D *space_state = PhysicsServer3D::get_singleton()->space_get_direct_state(stacks.space);
+	REQUIRE(space_state != nullptr);
+
+	// A grid of downward rays, some over the boxes and some over bare floor or past its edge.
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	for (int x = -20; x <= 20; x++) {
+		for (int z = -20; z <= 20; z++) {
+			from.push_back(Vector3(x * 0.5, 10, z * 0.5));
+			to.push_back(Vector3(x * 0.5, -10, z * 0.5));
+		}
+	}
+	from.push_back(Vector3(100, 10, 100));
+	to.push_back(Vector3(100, -10, 100));
+
+	SUBCASE("Rays") {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+		results.resize(from.size());
+		int hit_count = space_state->intersect_rays(parameters, from.ptr(), to.ptr(), from.size(), results.ptr());
+
+		int single_hit_count = 0;
+		bool matching = true;
+		for (uint32_t i = 0; i < from.size(); i++) {
+			parameters.from = from[i];
+			parameters.to = to[i];
+			PhysicsDirectSpaceState3D::RayResult single;
+			if (space_state->intersect_ray(parameters, single)) {
+				single_hit_count++;
+				matching = matching && results[i].rid == single.rid && results[i].position.is_equal_approx(single.position) && results[i].normal.is_equal_approx(single.normal);
+			} else {
+				matching = matching && results[i].rid.is_null();
+			}
+		}
+
+		CHECK(hit_count == single_hit_count);
+		CHECK(hit_count < (int)from.size());
+		CHECK_MESSAGE(matching, "Every ray in a batch should hit the same point as when cast alone.");
+	}
+
+	SUBCASE("Shape casts") {
+		RID sphere = PhysicsServer3D::get_singleton()->sphere_shape_create();
+		PhysicsServer3D::get_singleton()->shape_set_data(sphere, 0.25);
+
+		PhysicsDirectSpaceState3D::ShapeParameters parameters;
+		parameters.shape_rid = sphere;
+		LocalVector<Vector3> motions;
+		for (uint32_t i = 0; i < from.size(); i++) {
+			motions.push_back(to[i] - from[i]);
+		}
+		LocalVector<real_t> closest_safe;
+		LocalVector<real_t> closest_unsafe;
+		closest_safe.resize(from.size());
+		closest_unsafe.resize(from.size());
+		CHECK(space_state->cast_motions(parameters, from.ptr(), motions.ptr(), from.size(), closest_safe.ptr(), closest_unsafe.ptr()));
+
+		bool matching = true;
+		for (uint32_t i = 0; i < from.size(); i++) {
+			parameters.transform.origin = from[i];
+			parameters.motion = motions[i];
+			real_t safe = 1.0;
+			real_t unsafe = 1.0;
+			space_state->cast_motion(parameters, safe, unsafe);
+			matching = matching && Math::is_equal_approx(closest_safe[i], safe) && Math::is_equal_approx(closest_unsafe[i], unsafe);
+		}
+		CHECK_MESSAGE(matching, "Every cast in a batch should stop where it stops when cast alone.");
+		CHECK(closest_safe[closest_safe.size() - 1] == 1.0);
+
+		PhysicsServer3D::get_singleton()->free(sphere);
+	}
+}
+
+TEST_CASE_BENCHMARK("[SceneTree][PhysicsServer3D][Benchmark] 10,000 stacked boxes step time") {
+	const int frames = 300;
+
+	BoxStacks stacks(400, 25);
+	if (stacks.space.is_null()) {
+		MESSAGE("No physics engine available, skipping.");
+		return;
+	}
+
+	const BenchmarkFrameTimes times = benchmark_frames(frames, [](int p_frame) {
+		PhysicsServer3D::get_singleton()->step(1.0 / 60.0);
+	});
+
+	print_line(vformat("%d boxes, %d islands, %d collision pairs: %s.",
+			stacks.boxes.size(),
+			PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT),
+			PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS),
+			times.to_string()));
+}
+
+} // namespace TestPhysicsServer3D
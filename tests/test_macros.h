@@ -37,6 +37,7 @@
 #include "core/core_globals.h"
 #include "core/input/input_map.h"
 #include "core/object/message_queue.h"
+#include "core/os/os.h"
 #include "core/variant/variant.h"
 
 // See documentation for doctest at:
@@ -49,6 +50,9 @@
 // The test case is marked as failed, but does not fail the entire test run.
 #define TEST_CASE_MAY_FAIL(name) TEST_CASE(name *doctest::may_fail())
 
+// The benchmark is skipped by default, run benchmarks with `--test --no-skip --test-case="*[Benchmark]*"`.
+#define TEST_CASE_BENCHMARK(name) TEST_CASE(name *doctest::skip())
+
 // Provide aliases to conform with Redot naming conventions (see error macros).
 #define TEST_COND(cond, ...) DOCTEST_CHECK_FALSE_MESSAGE(cond, __VA_ARGS__)
 #define TEST_FAIL(cond, ...) DOCTEST_FAIL(cond, __VA_ARGS__)
@@ -473,3 +477,32 @@ public:
 			CHECK(string_list[i] == m_slices[i]);                                                \
 		}                                                                                        \
 	} while (false)
+
+// Frame times collected by `benchmark_frames()`, for benchmark test cases.
+struct BenchmarkFrameTimes {
+	uint64_t min_usec = UINT64_MAX;
+	uint64_t max_usec = 0;
+	uint64_t total_usec = 0;
+	int frames = 0;
+
+	String to_string() const {
+		return vformat("min %.3f ms, avg %.3f ms, max %.3f ms", min_usec / 1000.0, total_usec / 1000.0 / MAX(frames, 1), max_usec / 1000.0);
+	}
+};
+
+// Calls `p_frame` with the index of each of `p_frames` frames and times every call.
+template <typename F>
+BenchmarkFrameTimes benchmark_frames(int p_frames, F p_frame) {
+	BenchmarkFrameTimes times;
+	for (int i = 0; i < p_frames; i++) {
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		p_frame(i);
+		uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+		times.min_usec = MIN(times.min_usec, elapsed);
+		times.max_usec = MAX(times.max_usec, elapsed);
+		times.total_usec += elapsed;
+		times.frames++;
+	}
+	return times;
+}
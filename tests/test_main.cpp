@@ -118,6 +118,7 @@
 #include "tests/core/variant/test_variant.h"
 #include "tests/core/variant/test_variant_utility.h"
 #include "tests/scene/test_animation.h"
+#include "tests/scene/test_animation_mixer.h"
 #include "tests/scene/test_audio_stream_wav.h"
 #include "tests/scene/test_bit_map.h"
 #include "tests/scene/test_button.h"
@@ -143,10 +144,13 @@
 #include "tests/scene/test_texture_progress_bar.h"
 #include "tests/scene/test_theme.h"
 #include "tests/scene/test_timer.h"
+#include "tests/scene/test_tween.h"
 #include "tests/scene/test_viewport.h"
 #include "tests/scene/test_visual_shader.h"
 #include "tests/scene/test_window.h"
+#include "tests/servers/rendering/test_render_cull.h"
 #include "tests/servers/rendering/test_shader_preprocessor.h"
+#include "tests/servers/test_audio_server.h"
 #include "tests/servers/test_nav_heap.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
@@ -178,8 +182,13 @@
 #ifndef PHYSICS_3D_DISABLED
 #include "tests/scene/test_height_map_shape_3d.h"
 #include "tests/scene/test_physics_material.h"
+#include "tests/servers/test_physics_server_3d.h"
 #endif // PHYSICS_3D_DISABLED
 
+#ifndef PHYSICS_2D_DISABLED
+#include "tests/servers/test_physics_server_2d.h"
+#endif // PHYSICS_2D_DISABLED
+
 #ifdef MODULE_NAVIGATION_2D_ENABLED
 #include "tests/scene/test_navigation_agent_2d.h"
 #include "tests/scene/test_navigation_obstacle_2d.h"